@@ -25,6 +25,7 @@
 #include "utils/md5.h"
 #include <string>
 #include <functional>
+#include <cstddef>
 
 namespace eprosima {
 namespace fastrtps {
@@ -81,6 +82,42 @@ class  TopicDataType {
          */
         RTPS_DllAPI virtual bool getKey(void* data, rtps::InstanceHandle_t* ihandle, bool force_md5 = false) = 0;
 
+        /**
+         * Serialize the key of the data as getKey does before hashing it, in big endian CDR.
+         * Implementing it lets publishers and subscribers cache the key hash of their instances, so getKey is not
+         * called on every sample.
+         * @param[in] data Pointer to the data.
+         * @param[out] key Pointer to the payload where the key is serialized. It should be reserved when too small.
+         * @param[out] requires_md5 Set to true when the maximum serialized size of the key exceeds 16 bytes.
+         * @return True if correct. False if the type does not support it.
+         */
+        RTPS_DllAPI virtual bool serializeKey(
+                void* data,
+                rtps::SerializedPayload_t* key,
+                bool* requires_md5)
+        {
+            (void)data;
+            (void)key;
+            (void)requires_md5;
+            return false;
+        }
+
+        /**
+         * Checks if the type is plain, i.e. its in-memory representation is the same as its CDR serialization on
+         * the platform endianness. Samples of plain types can be loaned from the publisher and subscriber
+         * histories, avoiding any copy. A plain type should also set m_typeSize.
+         * @return True if the type is plain.
+         */
+        RTPS_DllAPI virtual inline bool is_plain() const { return false; }
+
+        /**
+         * Alignment needed by the in-memory representation of a plain type.
+         * Loaned samples are only placed on the payload of a change when their address has this alignment, which
+         * is not always the case as they are placed after the encapsulation header. Otherwise they are copied.
+         * @return Alignment of the type, in bytes.
+         */
+        RTPS_DllAPI virtual inline size_t plain_alignment() const { return alignof(std::max_align_t); }
+
         /**
          * Set topic data type name
          * @param nam Topic data type name
@@ -37,13 +37,23 @@ class ParticipantAttributes
         //!Attributes of the associated RTPSParticipant.
         rtps::RTPSParticipantAttributes rtps;
 
-        ParticipantAttributes() {}
+        /**
+         * Number of threads calling the listeners of the subscribers. Callbacks of the same subscriber are called in
+         * order, one at a time. When zero, listeners are called from the threads receiving the data.
+         */
+        uint32_t listener_threads;
+
+        ParticipantAttributes()
+            : listener_threads(0)
+        {
+        }
 
         virtual ~ParticipantAttributes() {}
 
         bool operator==(const ParticipantAttributes& b) const
         {
-            return (this->rtps == b.rtps);
+            return (this->rtps == b.rtps) &&
+                   (this->listener_threads == b.listener_threads);
         }
 };
 
@@ -23,6 +23,7 @@
 
 #include "../rtps/common/Types.h"
 #include "../qos/QosPolicies.h"
+#include "../rtps/common/ContentFilterProperty.h"
 
 
 namespace eprosima {
@@ -67,7 +68,8 @@ public:
             return (this->topicKind == b.topicKind) &&
                    (this->topicName == b.topicName) &&
                    (this->topicDataType == b.topicDataType) &&
-                   (this->historyQos == b.historyQos);
+                   (this->historyQos == b.historyQos) &&
+                   (this->contentFilter == b.contentFilter);
         }
 
         /**
@@ -123,6 +125,12 @@ public:
         TypeIdV1 type_id;
         //!Type Object
         TypeObjectV1 type;
+        /**
+         * Content filter of a subscriber, announced to the matched publishers so they only send the samples that
+         * pass it. Ignored by publishers. Publishers that protect the payload of the topic do not evaluate it, and send
+         * every sample.
+         */
+        rtps::ContentFilterProperty_t contentFilter;
 
         /**
          * Method to check whether the defined QOS are correct.
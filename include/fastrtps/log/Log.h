@@ -18,6 +18,7 @@
 
 #include <fastrtps/utils/DBQueue.h>
 #include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/rtps/attributes/ThreadSettings.hpp>
 #include <thread>
 #include <sstream>
 #include <atomic>
@@ -104,6 +105,9 @@ class Log
         //! Sets a filter that will pattern-match against the provided error string, dropping any unmatched categories.
         RTPS_DllAPI static void SetErrorStringFilter(const std::regex&);
 
+        //! Sets the settings of the logging thread. They are applied when the thread is next launched.
+        RTPS_DllAPI static void SetThreadSettings(const rtps::ThreadSettings&);
+
         //! Returns the logging engine to configuration defaults.
         RTPS_DllAPI static void Reset();
 
@@ -163,6 +167,7 @@ class Log
             std::unique_ptr<std::regex> mCategoryFilter;
             std::unique_ptr<std::regex> mFilenameFilter;
             std::unique_ptr<std::regex> mErrorStringFilter;
+            rtps::ThreadSettings mThreadSettings;
 
             std::atomic<Log::Kind> mVerbosity;
 
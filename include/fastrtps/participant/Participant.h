@@ -21,6 +21,7 @@
 #define PARTICIPANT_H_
 
 #include "../rtps/common/Guid.h"
+#include "../rtps/common/Statistics.h"
 #include "../rtps/attributes/RTPSParticipantAttributes.h"
 
 #include <utility>
@@ -100,6 +101,15 @@ class RTPS_DllAPI Participant
          */
         void assert_liveliness();
 
+        /**
+         * Takes a snapshot of the statistics of every endpoint and transport of this participant.
+         * Statistics are only kept when the participant was created with the property "fastrtps.statistics"
+         * set to "true".
+         * @param stats Structure to be filled.
+         * @return false if statistics are not enabled on this participant.
+         */
+        bool get_statistics(rtps::ParticipantStatistics& stats) const;
+
     private:
         Participant();
 
@@ -80,6 +80,28 @@ public:
             void* sample,
             rtps::WriteParams& wparams);
 
+    /**
+     * @brief Loans a sample from the publisher.
+     * For plain types (see TopicDataType::is_plain) the sample is placed on the payload of a change reserved
+     * from the history, so writing it does not involve any serialization nor copy. This needs the payload to have
+     * the alignment of the type (see TopicDataType::plain_alignment).
+     * For other types, or when the payload is not aligned, a sample is created with TopicDataType::createData.
+     * A loaned sample is given back by writing it, or by calling discard_loan.
+     * Writing, disposing or unregistering a loaned sample consumes the loan, even if the operation fails. The only
+     * exception is an operation that could not lock the publisher within the reliability max_blocking_time. Then
+     * the sample stays loaned and can be written again or discarded. discard_loan returns false for a consumed loan.
+     * @param[out] sample Pointer to the loaned sample.
+     * @return true when a sample could be loaned.
+     */
+    bool loan_sample(void*& sample);
+
+    /**
+     * @brief Gives back a loaned sample without writing it.
+     * @param[in,out] sample Pointer to the loaned sample. It is set to nullptr on success.
+     * @return true when the sample was loaned by this publisher.
+     */
+    bool discard_loan(void*& sample);
+
     /**
      * Dispose of a previously written data.
      * @param Data Pointer to the data.
@@ -106,6 +128,12 @@ public:
      */
     bool removeAllChange(size_t* removed = nullptr);
 
+    /**
+     * Send the samples grouped in the current batch without waiting for the batch limits.
+     * It does nothing when the batch QoS is not enabled.
+     */
+    void flush();
+
     /**
     * Waits until all changes were acknowledged or max_wait.
     * @param max_wait Maximum time to wait until all changes are acknowledged.
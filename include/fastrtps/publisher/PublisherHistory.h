@@ -27,6 +27,9 @@
 #include "../qos/QosPolicies.h"
 #include "../common/KeyedChanges.h"
 
+#include <chrono>
+#include <set>
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -121,6 +124,8 @@ private:
         t_m_Inst_Caches keyed_changes_;
         //!Time point when the next deadline will occur (only used for topics with no key)
         std::chrono::steady_clock::time_point next_deadline_us_;
+        //!Instances with a deadline set, ordered by the time they will miss it (only used for topics with key)
+        std::set<std::pair<std::chrono::steady_clock::time_point, rtps::InstanceHandle_t>> deadlines_;
         //!HistoryQosPolicy values.
         HistoryQosPolicy m_historyQos;
         //!ResourceLimitsQosPolicy values.
@@ -21,6 +21,8 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 #include "../rtps/common/all_common.h"
 #include "../rtps/common/Token.h"
+#include "../rtps/common/TopicInterestFilter.h"
+#include "../rtps/common/ContentFilterProperty.h"
 
 #include "../utils/fixed_size_string.hpp"
 
@@ -116,6 +118,7 @@ enum ParameterId_t	: uint16_t
     PID_DATA_REPRESENTATION = 0x0073,
     PID_TYPE_CONSISTENCY_ENFORCEMENT = 0x0074,
     PID_DISABLE_POSITIVE_ACKS = 0x8005,
+    PID_TOPIC_INTEREST = 0x8010,
 };
 
 //!Base Parameter class with parameter PID and parameter length in bytes.
@@ -578,6 +581,56 @@ class ParameterSampleIdentity_t : public Parameter_t
         bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
 };
 
+/**
+ * Topic interest filter of a participant.
+ */
+class ParameterTopicInterest_t : public Parameter_t
+{
+    public:
+        rtps::TopicInterestFilter filter;
+
+        ParameterTopicInterest_t() : Parameter_t(PID_TOPIC_INTEREST, rtps::TopicInterestFilter::size) {}
+
+        /**
+         * Constructor using a parameter PID and the parameter length
+         * @param pid Pid of the parameter
+         * @param in_length Its associated length
+         */
+        ParameterTopicInterest_t(ParameterId_t pid, uint16_t in_length) : Parameter_t(pid,in_length) {}
+
+        /**
+         * Add the parameter to a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message where the parameter should be added.
+         * @return True if the parameter was correctly added.
+         */
+        bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+};
+
+/**
+ * Content filter of a reader.
+ */
+class ParameterContentFilterProperty_t : public Parameter_t
+{
+    public:
+        rtps::ContentFilterProperty_t filter;
+
+        ParameterContentFilterProperty_t() : Parameter_t(PID_CONTENT_FILTER_PROPERTY, 0) {}
+
+        /**
+         * Constructor using a parameter PID and the parameter length
+         * @param pid Pid of the parameter
+         * @param in_length Its associated length
+         */
+        ParameterContentFilterProperty_t(ParameterId_t pid, uint16_t in_length) : Parameter_t(pid,in_length) {}
+
+        /**
+         * Add the parameter to a CDRMessage_t message.
+         * @param[in,out] msg Pointer to the message where the parameter should be added.
+         * @return True if the parameter was correctly added.
+         */
+        bool addToCDRMessage(rtps::CDRMessage_t* msg) override;
+};
+
 #if HAVE_SECURITY
 
 /**
@@ -464,7 +464,10 @@ private:
 
 /**
  * Class TimeBasedFilterQosPolicy, to indicate the Time Based Filter Qos.
- * This QosPolicy can be defined and is transmitted to the rest of the network but is not implemented in this version.
+ * Set on a subscriber, it is enforced by the matched writers: a sample is not sent to the reader when its source
+ * timestamp is closer than minimum_separation to the last sample of the same instance sent to it.
+ * Reliable readers are sent a GAP for the samples filtered out. Filtered out samples are not sent later, so the last
+ * sample of a burst shorter than minimum_separation only reaches the reader if a newer sample passes the filter.
  * minimum_separation: Default value c_TimeZero
  */
 class TimeBasedFilterQosPolicy : public Parameter_t, public QosPolicy
@@ -955,6 +958,46 @@ class PublishModeQosPolicy : public QosPolicy {
         virtual RTPS_DllAPI ~PublishModeQosPolicy(){};
 };
 
+/**
+ * Class BatchQosPolicy, groups consecutive samples of a writer so they are sent together in the same messages.
+ * A batch is sent when it reaches max_data_bytes or max_samples, when max_flush_delay expires or when the
+ * publisher is flushed.
+ * enabled: Default value false.
+ */
+class BatchQosPolicy : public QosPolicy
+{
+public:
+
+    RTPS_DllAPI BatchQosPolicy()
+        : enabled(false)
+        , max_data_bytes(32768)
+        , max_samples(0)
+        , max_flush_delay(c_TimeInfinite)
+    {}
+
+    virtual RTPS_DllAPI ~BatchQosPolicy()
+    {}
+
+    bool operator==(const BatchQosPolicy& b) const
+    {
+        return enabled == b.enabled &&
+                max_data_bytes == b.max_data_bytes &&
+                max_samples == b.max_samples &&
+                max_flush_delay == b.max_flush_delay &&
+                QosPolicy::operator==(b);
+    }
+
+public:
+    //! True if samples are batched
+    bool enabled;
+    //! Serialized bytes that make a batch be sent. Zero means no limit.
+    uint32_t max_data_bytes;
+    //! Number of samples that make a batch be sent. Zero means no limit.
+    uint32_t max_samples;
+    //! Maximum time a sample waits in a batch. Infinite means it waits for one of the limits or a flush.
+    Duration_t max_flush_delay;
+};
+
 /**
 * Enum DataRepresentationId, different kinds of topic data representation
 */
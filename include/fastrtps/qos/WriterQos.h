@@ -58,7 +58,8 @@ public:
                (this->m_topicData == b.m_topicData) &&
                (this->m_groupData == b.m_groupData) &&
                (this->m_publishMode == b.m_publishMode) &&
-               (this->m_disablePositiveACKs == b.m_disablePositiveACKs);
+               (this->m_disablePositiveACKs == b.m_disablePositiveACKs) &&
+               (this->m_batch == b.m_batch);
     }
 
     //!Durability Qos, implemented in the library.
@@ -97,6 +98,8 @@ public:
     PublishModeQosPolicy m_publishMode;
     //!Disable positive acks QoS, implemented in the library.
     DisablePositiveACKsQosPolicy m_disablePositiveACKs;
+    //!Batch Qos, implemented in the library.
+    BatchQosPolicy m_batch;
     /**
      * Set Qos from another class
      * @param qos Reference from a WriterQos object.
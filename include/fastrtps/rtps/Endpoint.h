@@ -27,12 +27,15 @@
 #include "attributes/EndpointAttributes.h"
 #include "../utils/TimedMutex.hpp"
 
+#include <memory>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
 class RTPSParticipantImpl;
 class ResourceEvent;
+struct EndpointStatisticsCounters;
 
 
 /**
@@ -86,6 +89,12 @@ class Endpoint
     bool supports_rtps_protection() { return supports_rtps_protection_; }
 #endif
 
+    /**
+     * Get the statistics counters of this endpoint.
+     * @return nullptr when statistics are disabled on the participant.
+     */
+    inline EndpointStatisticsCounters* statistics() const { return statistics_.get(); }
+
     protected:
 
     //!Pointer to the RTPSParticipant containing this endpoint.
@@ -100,6 +109,9 @@ class Endpoint
     //!Endpoint Mutex
     mutable RecursiveTimedMutex mp_mutex;
 
+    //!Statistics counters, assigned by the participant on creation when statistics are enabled.
+    std::shared_ptr<EndpointStatisticsCounters> statistics_;
+
     private:
 
     Endpoint& operator=(const Endpoint&) = delete;
@@ -29,6 +29,7 @@
 #include "../../utils/fixed_size_string.hpp"
 #include "RTPSParticipantAllocationAttributes.hpp"
 #include "ServerAttributes.h"
+#include "ThreadSettings.hpp"
 
 #include <memory>
 #include <sstream>
@@ -99,6 +100,13 @@ public:
     //!Default value true.
     bool use_PublicationReaderANDSubscriptionWriter;
 
+    /**
+     * Advertise the topics of the local endpoints on the participant announcement, and only exchange
+     * endpoint discovery data about topics the remote participant has endpoints on.
+     * Default value false.
+     */
+    bool use_topic_interest_filter;
+
 #if HAVE_SECURITY
     bool enable_builtin_secure_publications_writer_and_subscriptions_reader;
 
@@ -108,6 +116,7 @@ public:
     SimpleEDPAttributes()
         : use_PublicationWriterANDSubscriptionReader(true)
         , use_PublicationReaderANDSubscriptionWriter(true)
+        , use_topic_interest_filter(false)
 #if HAVE_SECURITY
         , enable_builtin_secure_publications_writer_and_subscriptions_reader(true)
         , enable_builtin_secure_subscriptions_writer_and_publications_reader(true)
@@ -124,6 +133,7 @@ public:
                 (this->enable_builtin_secure_subscriptions_writer_and_publications_reader ==
                 b.enable_builtin_secure_subscriptions_writer_and_publications_reader) &&
 #endif
+                (this->use_topic_interest_filter == b.use_topic_interest_filter) &&
                 (this->use_PublicationReaderANDSubscriptionWriter == b.use_PublicationReaderANDSubscriptionWriter);
     }
 };
@@ -314,6 +324,9 @@ class RTPSParticipantAttributes
                    (this->participantID == b.participantID) &&
                    (this->throughputController == b.throughputController) &&
                    (this->useBuiltinTransports == b.useBuiltinTransports) &&
+                   (this->timed_events_thread == b.timed_events_thread) &&
+                   (this->async_writer_thread == b.async_writer_thread) &&
+                   (this->flow_controller_thread == b.flow_controller_thread) &&
                    (this->properties == b.properties &&
                    (this->prefix == b.prefix));
         }
@@ -375,6 +388,18 @@ class RTPSParticipantAttributes
         //! Property policies
         PropertyPolicy properties;
 
+        //! Settings of the thread processing the timed events of the participant.
+        ThreadSettings timed_events_thread;
+
+        //! Settings of the thread sending the data of the asynchronous writers of the participant.
+        ThreadSettings async_writer_thread;
+
+        /**
+         * Settings of the thread of the throughput controllers. The thread is shared by all the participants of the
+         * process, and the settings of the participant creating it are the ones applied.
+         */
+        ThreadSettings flow_controller_thread;
+
         //!Set the name of the participant.
         inline void setName(const char* nam) { name = nam; }
 
@@ -0,0 +1,80 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadSettings.hpp
+ */
+
+#ifndef _FASTRTPS_RTPS_THREADSETTINGS_HPP_
+#define _FASTRTPS_RTPS_THREADSETTINGS_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Value of ThreadSettings::scheduling_policy and ThreadSettings::priority that keeps the inherited one.
+const int32_t c_ThreadSettingInherited = std::numeric_limits<int32_t>::min();
+
+/**
+ * @brief Scheduling settings applied to a thread created by the library.
+ *
+ * Every field has a default value that keeps what the thread inherits from the thread creating it.
+ * Settings that cannot be applied are reported with a warning and the thread keeps its inherited ones.
+ * The stack size cannot be configured, as the settings are applied by the thread itself once it is running: threads
+ * use the default stack size of the platform.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct ThreadSettings
+{
+    /**
+     * Scheduling policy of the thread, as given to pthread_setschedparam (i.e. SCHED_OTHER, SCHED_FIFO or
+     * SCHED_RR). Ignored on Windows.
+     */
+    int32_t scheduling_policy = c_ThreadSettingInherited;
+
+    /**
+     * Priority of the thread. On POSIX systems it is the priority of the scheduling policy, which is used in place
+     * of the inherited policy when scheduling_policy is not given. On Windows it is given to SetThreadPriority.
+     */
+    int32_t priority = c_ThreadSettingInherited;
+
+    /**
+     * Mask of the CPUs the thread is allowed to run on, where bit i stands for CPU i. Zero keeps the inherited one.
+     * Only the first 64 CPUs can be selected. Ignored on platforms other than Linux and Windows.
+     */
+    uint64_t affinity = 0;
+
+    bool operator ==(
+            const ThreadSettings& b) const
+    {
+        return scheduling_policy == b.scheduling_policy &&
+               priority == b.priority &&
+               affinity == b.affinity;
+    }
+
+    bool operator !=(
+            const ThreadSettings& b) const
+    {
+        return !(*this == b);
+    }
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* _FASTRTPS_RTPS_THREADSETTINGS_HPP_ */
@@ -55,14 +55,24 @@ struct WriterTimes
     Duration_t nackResponseDelay;
     //!This time allows the RTPSWriter to ignore nack messages too soon after the data as sent, default value 0s.
     Duration_t nackSupressionDuration;
+    /**
+     * Adapts the heartbeat period, the nack supression duration and the nack response delay to the
+     * unacknowledged data and to the round trip time measured for each reader, default value false.
+     * The configured times are then used as bounds.
+     */
+    bool adaptiveReliability;
+    //!Minimum periodic HB period when adaptiveReliability is enabled, default value 10ms.
+    Duration_t minHeartbeatPeriod;
 
     WriterTimes()
+        : adaptiveReliability(false)
     {
         //initialHeartbeatDelay.fraction = 50*1000*1000;
         initialHeartbeatDelay.nanosec = 12*1000*1000;
         heartbeatPeriod.seconds = 3;
         //nackResponseDelay.fraction = 20*1000*1000;
         nackResponseDelay.nanosec = 5*1000*1000;
+        minHeartbeatPeriod.nanosec = 10*1000*1000;
     }
 
     virtual ~WriterTimes() {}
@@ -72,7 +82,9 @@ struct WriterTimes
         return (this->initialHeartbeatDelay == b.initialHeartbeatDelay) &&
                (this->heartbeatPeriod == b.heartbeatPeriod) &&
                (this->nackResponseDelay == b.nackResponseDelay) &&
-               (this->nackSupressionDuration == b.nackSupressionDuration);
+               (this->nackSupressionDuration == b.nackSupressionDuration) &&
+               (this->adaptiveReliability == b.adaptiveReliability) &&
+               (this->minHeartbeatPeriod == b.minHeartbeatPeriod);
     }
 };
 
@@ -92,6 +104,11 @@ class WriterAttributes
             , disable_heartbeat_piggyback(false)
             , disable_positive_acks(false)
             , keep_duration(c_TimeInfinite)
+            , max_instances(0)
+            , batching(false)
+            , batch_max_data_bytes(0)
+            , batch_max_samples(0)
+            , batch_max_flush_delay(c_TimeInfinite)
         {
             endpoint.endpointKind = WRITER;
             endpoint.durabilityKind = TRANSIENT_LOCAL;
@@ -132,6 +149,21 @@ class WriterAttributes
 
         //! Keep duration to keep a sample before considering it has been acked
         Duration_t keep_duration;
+
+        //! Maximum number of instances of the changes written (0 means no limit)
+        uint32_t max_instances;
+
+        //! Group consecutive changes and send them together
+        bool batching;
+
+        //! Serialized bytes that make a batch be sent (0 means no limit)
+        uint32_t batch_max_data_bytes;
+
+        //! Number of changes that make a batch be sent (0 means no limit)
+        uint32_t batch_max_samples;
+
+        //! Maximum time a change waits in a batch before being sent
+        Duration_t batch_max_flush_delay;
 };
 
 } /* namespace rtps */
@@ -123,6 +123,8 @@ class ParticipantProxyData
         ParameterPropertyList_t m_properties;
         //!
         std::vector<octet> m_userData;
+        //!Topics the participant has endpoints on. Only active when topic interest filtering is enabled.
+        TopicInterestFilter m_topicInterest;
         //!
         TimedEvent* lease_duration_event;
         //!
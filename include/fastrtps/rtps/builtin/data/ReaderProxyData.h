@@ -32,6 +32,7 @@
 #endif
 
 #include "../../common/RemoteLocators.hpp"
+#include "../../common/ContentFilterProperty.h"
 
 namespace eprosima {
 namespace fastrtps{
@@ -287,6 +288,21 @@ class ReaderProxyData
             return m_qos.m_disablePositiveACKs.enabled;
         }
 
+        RTPS_DllAPI void content_filter(const ContentFilterProperty_t& content_filter)
+        {
+            content_filter_ = content_filter;
+        }
+
+        RTPS_DllAPI const ContentFilterProperty_t& content_filter() const
+        {
+            return content_filter_;
+        }
+
+        RTPS_DllAPI ContentFilterProperty_t& content_filter()
+        {
+            return content_filter_;
+        }
+
         /**
          * Write as a parameter list on a CDRMessage_t
          * @return True on success
@@ -366,6 +382,8 @@ class ReaderProxyData
         TypeIdV1 m_type_id;
         //!Type Object
         TypeObjectV1 m_type;
+        //!Content filter
+        ContentFilterProperty_t content_filter_;
 };
 
 }
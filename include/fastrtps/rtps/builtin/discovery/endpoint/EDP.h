@@ -25,6 +25,7 @@
 #include "../../../builtin/data/ReaderProxyData.h"
 #include "../../../builtin/data/WriterProxyData.h"
 #include "../../../common/Guid.h"
+#include "../../../common/TopicInterestFilter.h"
 
 namespace eprosima {
 namespace fastrtps{
@@ -83,6 +84,34 @@ class EDP
         //! Verify if the given participant EDP enpoints are matched with us
         virtual bool areRemoteEndpointsMatched(const ParticipantProxyData* ) { return false; };
 
+        /**
+         * Called when the topic interest filter announced by a remote participant may have changed.
+         * @param participant_prefix GuidPrefix of the remote participant.
+         * @param interest Topic interest filter announced by the participant.
+         */
+        virtual void update_remote_topic_interest(
+                const GuidPrefix_t& participant_prefix,
+                const TopicInterestFilter& interest)
+        {
+            (void)participant_prefix;
+            (void)interest;
+        }
+
+        /**
+         * Check whether the information about a remote endpoint should be kept.
+         * @param participant_prefix GuidPrefix of the participant the endpoint belongs to.
+         * @param topic_name Topic of the endpoint.
+         * @return false when the endpoint can be ignored, true otherwise.
+         */
+        virtual bool is_relevant_remote_endpoint(
+                const GuidPrefix_t& participant_prefix,
+                const string_255& topic_name)
+        {
+            (void)participant_prefix;
+            (void)topic_name;
+            return true;
+        }
+
         /**
          * Abstract method that removes a local Reader from the discovery method
          * @param R Pointer to the Reader to remove.
@@ -233,6 +262,13 @@ class EDP
          */
         bool pairingWriter(RTPSWriter* W, const GUID_t& participant_guid, const WriterProxyData& wdata);
 
+        /**
+         * Copy the content filter of a local reader to its ReaderProxyData, filling the topic names if not set.
+         * @param rdata ReaderProxyData of the local reader.
+         * @param att Attributes of the associated topic.
+         */
+        static void set_content_filter(ReaderProxyData& rdata, const TopicAttributes& att);
+
         static bool checkTypeIdentifier(const WriterProxyData* wdata, const ReaderProxyData* rdata);
 
         static bool checkTypeIdentifier(const eprosima::fastrtps::types::TypeIdentifier * wti,
@@ -25,6 +25,10 @@
 
 #include <fastrtps/rtps/builtin/data/WriterProxyData.h>
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/writer/IReaderDataFilter.h>
+
+#include <map>
+#include <mutex>
 
 namespace eprosima {
 namespace fastrtps{
@@ -46,7 +50,7 @@ class EDPListener;
  * Inherits from EDP class.
  *@ingroup DISCOVERY_MODULE
  */
-class EDPSimple : public EDP  
+class EDPSimple : public EDP, public IReaderDataFilter
 {
     typedef std::pair<StatefulWriter*,WriterHistory*> t_p_StatefulWriter;
     typedef std::pair<StatefulReader*,ReaderHistory*> t_p_StatefulReader;
@@ -134,6 +138,25 @@ public:
      */
     bool removeLocalWriter(RTPSWriter*W) override;
 
+    void update_remote_topic_interest(
+            const GuidPrefix_t& participant_prefix,
+            const TopicInterestFilter& interest) override;
+
+    bool is_relevant_remote_endpoint(
+            const GuidPrefix_t& participant_prefix,
+            const string_255& topic_name) override;
+
+    /**
+     * Decide whether the data of a local endpoint should be sent to a remote builtin reader.
+     * Only used when topic interest filtering is enabled.
+     * @param change Change with the data of the local endpoint.
+     * @param reader_guid GUID of the remote builtin reader.
+     * @return false when the participant of the reader has no endpoints on the topic of the local endpoint.
+     */
+    bool is_relevant(
+            const CacheChange_t& change,
+            const GUID_t& reader_guid) const override;
+
 protected:
 
     /**
@@ -185,6 +208,41 @@ private:
     std::mutex temp_data_lock_;
     ReaderProxyData temp_reader_proxy_data_;
     WriterProxyData temp_writer_proxy_data_;
+
+    /**
+     * Add the topic of a local endpoint to the topic interest filter of the local participant,
+     * announcing the participant again when the filter changes.
+     * @param endpoint_guid GUID of the local endpoint.
+     * @param topic_name Topic of the local endpoint.
+     */
+    void add_local_topic_interest(
+            const GUID_t& endpoint_guid,
+            const string_255& topic_name);
+
+    //! Forget the topic of a removed local endpoint.
+    void remove_local_topic_interest(const GUID_t& endpoint_guid);
+
+    /**
+     * Write again the data of a local endpoint with a new sequence number, so it reaches the readers
+     * it was filtered out for.
+     * @param writer Builtin writer holding the data of the endpoint.
+     * @param endpoint_guid GUID of the local endpoint.
+     * @return true if the endpoint data was found on the history of the writer.
+     */
+    bool republish_local_endpoint(
+            t_p_StatefulWriter& writer,
+            const GUID_t& endpoint_guid);
+
+    //! Whether topic interest filtering is in use.
+    bool topic_interest_enabled_;
+    //! Protects the topic interest collections. No other lock is taken while holding it.
+    mutable std::mutex topic_interest_mutex_;
+    //! Topics of every local endpoint created on this participant.
+    TopicInterestFilter local_topic_interest_;
+    //! Hash of the topic name of each alive local endpoint.
+    std::map<GUID_t, uint64_t> local_endpoint_topics_;
+    //! Topic interest filter announced by each remote participant, indexed by participant GUID.
+    std::map<GUID_t, TopicInterestFilter> remote_topic_interest_;
 };
 
 } /* namespace rtps */
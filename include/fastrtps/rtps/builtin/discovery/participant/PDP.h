@@ -286,8 +286,9 @@ public:
     /**
      * Assert the liveliness of a Remote Participant.
      * @param guidP GuidPrefix_t of the participant whose liveliness is being asserted.
+     * @return true if the participant is known.
      */
-    void assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP);
+    bool assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP);
 
     /**
      * Get the RTPS participant
@@ -335,7 +336,7 @@ protected:
     //!Variable to indicate if any parameter has changed.
     std::atomic_bool m_hasChangedLocalPDP;
     //!Listener for the SPDP messages.
-    ReaderListener* mp_listener;
+    PDPListener* mp_listener;
     //!WriterHistory
     WriterHistory* mp_PDPWriterHistory;
     //!Reader History
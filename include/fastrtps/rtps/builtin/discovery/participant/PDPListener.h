@@ -24,7 +24,9 @@
 #include "../../../reader/ReaderListener.h"
 #include "../../data/ParticipantProxyData.h"
 
+#include <map>
 #include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -57,6 +59,18 @@ public:
             RTPSReader* reader,
             const CacheChange_t* const change) override;
 
+    /**
+     * Forget the last announcement received from a remote participant.
+     * @param participant_guid GUID of the remote participant.
+     *
+     * @remarks This should be always called with the pdp_reader lock taken
+     */
+    void forget_announcement(
+            const GUID_t& participant_guid)
+    {
+        announcements_.erase(participant_guid);
+    }
+
 protected:
 
     /**
@@ -75,6 +89,22 @@ protected:
      * @remarks This should be always accessed with the pdp_reader lock taken
      */
     ParticipantProxyData temp_participant_data_;
+
+    //! Last announcement received from a remote participant.
+    struct Announcement
+    {
+        //! Hash of the payload, to avoid comparing it byte by byte when it has changed.
+        uint64_t fingerprint;
+        std::vector<octet> payload;
+    };
+
+    /**
+     * @brief Last announcement received from each known remote participant.
+     * An announcement equal to it only refreshes the liveliness of the participant.
+     *
+     * @remarks This should be always accessed with the pdp_reader lock taken
+     */
+    std::map<GUID_t, Announcement> announcements_;
 };
 
 
@@ -361,6 +361,11 @@ namespace eprosima
                    }
                 }
 
+                void markAllFragmentsAsSent()
+                {
+                    unsent_fragments_.clear();
+                }
+
                 void markFragmentsAsSent(const FragmentNumber_t& sentFragment)
                 {
                     unsent_fragments_.erase(sentFragment);
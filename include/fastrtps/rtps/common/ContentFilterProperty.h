@@ -0,0 +1,86 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterProperty.h
+ */
+#ifndef _FASTRTPS_RTPS_COMMON_CONTENTFILTERPROPERTY_H_
+#define _FASTRTPS_RTPS_COMMON_CONTENTFILTERPROPERTY_H_
+
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Name of the SQL-like filter class defined by the DDS specification. It is the only one supported.
+const char* const c_DDSSQL_filter_class_name = "DDSSQL";
+
+/**
+ * Content filter of a reader, announced on PID_CONTENT_FILTER_PROPERTY.
+ *
+ * The expression is a subset of the DDS SQL filter grammar: comparisons (=, <>, !=, <, <=, >, >=, LIKE) between
+ * fields, literals and parameters (%0 to %99), combined with AND, OR, NOT and parentheses.
+ * Fields of nested structures are accessed with '.'.
+ * @ingroup COMMON_MODULE
+ */
+struct ContentFilterProperty_t
+{
+    ContentFilterProperty_t()
+        : filter_class_name(c_DDSSQL_filter_class_name)
+    {
+    }
+
+    //! @return true when no filter is set.
+    bool empty() const
+    {
+        return filter_expression.empty();
+    }
+
+    bool operator==(const ContentFilterProperty_t& b) const
+    {
+        return (content_filtered_topic_name == b.content_filtered_topic_name) &&
+               (related_topic_name == b.related_topic_name) &&
+               (filter_class_name == b.filter_class_name) &&
+               (filter_expression == b.filter_expression) &&
+               (expression_parameters == b.expression_parameters);
+    }
+
+    bool operator!=(const ContentFilterProperty_t& b) const
+    {
+        return !(*this == b);
+    }
+
+    //! Name of the content filtered topic.
+    std::string content_filtered_topic_name;
+
+    //! Name of the topic being filtered.
+    std::string related_topic_name;
+
+    //! Class of the filter.
+    std::string filter_class_name;
+
+    //! Filter expression. No filter is applied when empty.
+    std::string filter_expression;
+
+    //! Values of the parameters of the expression, in order.
+    std::vector<std::string> expression_parameters;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTRTPS_RTPS_COMMON_CONTENTFILTERPROPERTY_H_
@@ -46,6 +46,9 @@ namespace eprosima{
             //!@ingroup COMMON_MODULE
             struct RTPS_DllAPI SerializedPayload_t
             {
+                //!Size in bytes of the representation header (encapsulation and options) at the start of the data.
+                static constexpr uint32_t representation_header_size = 4u;
+
                 //!Encapsulation of the data as suggested in the RTPS 2.1 specification chapter 10.
                 uint16_t encapsulation;
                 //!Actual length of the data
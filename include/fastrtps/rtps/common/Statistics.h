@@ -0,0 +1,226 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Statistics.h
+ */
+#ifndef _FASTRTPS_RTPS_COMMON_STATISTICS_H_
+#define _FASTRTPS_RTPS_COMMON_STATISTICS_H_
+
+#include "Guid.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Snapshot of a base 2 logarithmic histogram.
+ * Bucket 0 counts values equal to zero and bucket i counts values in [2^(i-1), 2^i).
+ * The last bucket also counts every value above its lower bound.
+ * @ingroup COMMON_MODULE
+ */
+struct HistogramData
+{
+    //! Number of buckets of the histogram.
+    static const uint32_t num_buckets = 32;
+
+    HistogramData()
+        : buckets()
+        , count(0)
+        , sum(0)
+        , max(0)
+    {
+    }
+
+    //! Number of values on each bucket.
+    uint64_t buckets[num_buckets];
+
+    //! Total number of values.
+    uint64_t count;
+
+    //! Sum of every value.
+    uint64_t sum;
+
+    //! Maximum value.
+    uint64_t max;
+};
+
+/**
+ * Counters of a local writer.
+ * @ingroup COMMON_MODULE
+ */
+struct WriterStatistics
+{
+    WriterStatistics()
+        : data_sent(0)
+        , data_frags_sent(0)
+        , bytes_sent(0)
+        , heartbeats_sent(0)
+        , gaps_sent(0)
+        , acknacks_received(0)
+        , nackfrags_received(0)
+        , samples_resent(0)
+        , history_depth(0)
+        , pool_exhausted(0)
+    {
+    }
+
+    //! Writer GUID.
+    GUID_t guid;
+
+    //! DATA submessages sent.
+    uint64_t data_sent;
+
+    //! DATA_FRAG submessages sent.
+    uint64_t data_frags_sent;
+
+    //! Serialized payload bytes sent on DATA and DATA_FRAG submessages.
+    uint64_t bytes_sent;
+
+    //! HEARTBEAT submessages sent.
+    uint64_t heartbeats_sent;
+
+    //! GAP submessages sent.
+    uint64_t gaps_sent;
+
+    //! ACKNACK submessages received from matched readers.
+    uint64_t acknacks_received;
+
+    //! NACK_FRAG submessages received from matched readers.
+    uint64_t nackfrags_received;
+
+    //! Samples scheduled for retransmission after being requested by a reader.
+    uint64_t samples_resent;
+
+    //! Number of changes on the history when the snapshot was taken.
+    uint64_t history_depth;
+
+    //! Times a change could not be obtained from the history pool.
+    uint64_t pool_exhausted;
+
+    //! Size in bytes of the RTPS messages flushed to the transports.
+    HistogramData message_sizes;
+};
+
+/**
+ * Counters of a local reader.
+ * @ingroup COMMON_MODULE
+ */
+struct ReaderStatistics
+{
+    ReaderStatistics()
+        : samples_received(0)
+        , bytes_received(0)
+        , fragments_reassembled(0)
+        , heartbeats_received(0)
+        , gaps_received(0)
+        , acknacks_sent(0)
+        , nackfrags_sent(0)
+        , history_depth(0)
+        , pool_exhausted(0)
+    {
+    }
+
+    //! Reader GUID.
+    GUID_t guid;
+
+    //! Samples added to the history.
+    uint64_t samples_received;
+
+    //! Serialized payload bytes of the samples added to the history.
+    uint64_t bytes_received;
+
+    //! Samples completed from DATA_FRAG submessages.
+    uint64_t fragments_reassembled;
+
+    //! HEARTBEAT submessages received from matched writers.
+    uint64_t heartbeats_received;
+
+    //! GAP submessages received from matched writers.
+    uint64_t gaps_received;
+
+    //! ACKNACK submessages sent.
+    uint64_t acknacks_sent;
+
+    //! NACK_FRAG submessages sent.
+    uint64_t nackfrags_sent;
+
+    //! Number of changes on the history when the snapshot was taken.
+    uint64_t history_depth;
+
+    //! Times a change could not be obtained from the history pool.
+    uint64_t pool_exhausted;
+
+    //! Size in bytes of the RTPS messages flushed to the transports.
+    HistogramData message_sizes;
+
+    /**
+     * Microseconds between the source timestamp of a sample and its addition to the history.
+     * Only meaningful when the clocks of both hosts are synchronized.
+     */
+    HistogramData reception_latency_us;
+};
+
+/**
+ * Counters of a transport.
+ * @ingroup COMMON_MODULE
+ */
+struct TransportStatistics
+{
+    TransportStatistics()
+        : kind(0)
+        , datagrams_sent(0)
+        , bytes_sent(0)
+        , send_errors(0)
+        , would_block(0)
+    {
+    }
+
+    //! Locator kind handled by the transport.
+    int32_t kind;
+
+    //! Datagrams successfully sent.
+    uint64_t datagrams_sent;
+
+    //! Bytes successfully sent.
+    uint64_t bytes_sent;
+
+    //! Send operations that failed.
+    uint64_t send_errors;
+
+    //! Datagrams dropped because the send operation would have blocked.
+    uint64_t would_block;
+};
+
+/**
+ * Statistics of a participant and its endpoints, builtin endpoints included.
+ * @ingroup COMMON_MODULE
+ */
+struct ParticipantStatistics
+{
+    std::vector<WriterStatistics> writers;
+
+    std::vector<ReaderStatistics> readers;
+
+    std::vector<TransportStatistics> transports;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTRTPS_RTPS_COMMON_STATISTICS_H_
@@ -0,0 +1,181 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicInterestFilter.h
+ */
+#ifndef _FASTRTPS_RTPS_COMMON_TOPICINTERESTFILTER_H_
+#define _FASTRTPS_RTPS_COMMON_TOPICINTERESTFILTER_H_
+
+#include "Types.h"
+
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Bloom filter summarizing the topic names a participant has endpoints on.
+ * It is sent on the participant announcement so remote participants can avoid sending endpoint
+ * discovery data the participant does not care about. False positives are possible, false
+ * negatives are not.
+ * @ingroup COMMON_MODULE
+ */
+class TopicInterestFilter
+{
+    public:
+
+        //! Size in bytes of the filter bit array.
+        static const uint32_t size = 256;
+
+        TopicInterestFilter()
+            : active_(false)
+        {
+            std::memset(bits_, 0, size);
+        }
+
+        /**
+         * Compute the hash used to add or look up a topic name.
+         * @param topic_name Topic name.
+         * @return 64 bit FNV-1a hash of the topic name.
+         */
+        static uint64_t topic_hash(
+                const char* topic_name)
+        {
+            uint64_t hash = 14695981039346656037ULL;
+            for (const char* c = topic_name; *c != '\0'; ++c)
+            {
+                hash ^= static_cast<uint8_t>(*c);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        /**
+         * Add a topic to the filter.
+         * @param hash Hash of the topic name, as returned by topic_hash.
+         * @return true if the filter has changed.
+         */
+        bool add(
+                uint64_t hash)
+        {
+            bool changed = !active_;
+            active_ = true;
+            for (uint32_t i = 0; i < num_hashes; ++i)
+            {
+                uint32_t bit = bit_index(hash, i);
+                octet mask = static_cast<octet>(1u << (bit & 7u));
+                if ((bits_[bit >> 3] & mask) == 0)
+                {
+                    bits_[bit >> 3] |= mask;
+                    changed = true;
+                }
+            }
+            return changed;
+        }
+
+        /**
+         * Check whether a topic may have been added to the filter.
+         * An inactive filter matches every topic.
+         * @param hash Hash of the topic name, as returned by topic_hash.
+         * @return true if the topic may be of interest.
+         */
+        bool contains(
+                uint64_t hash) const
+        {
+            if (!active_)
+            {
+                return true;
+            }
+
+            for (uint32_t i = 0; i < num_hashes; ++i)
+            {
+                uint32_t bit = bit_index(hash, i);
+                if ((bits_[bit >> 3] & (1u << (bit & 7u))) == 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Whether the filter is in use. A participant that does not advertise a filter is
+         * considered to be interested on every topic.
+         */
+        bool active() const
+        {
+            return active_;
+        }
+
+        //! Mark the filter as used, without adding any topic.
+        void activate()
+        {
+            active_ = true;
+        }
+
+        //! Remove every topic and mark the filter as not used.
+        void clear()
+        {
+            active_ = false;
+            std::memset(bits_, 0, size);
+        }
+
+        octet* data()
+        {
+            return bits_;
+        }
+
+        const octet* data() const
+        {
+            return bits_;
+        }
+
+        bool operator==(
+                const TopicInterestFilter& other) const
+        {
+            return (active_ == other.active_) && (std::memcmp(bits_, other.bits_, size) == 0);
+        }
+
+        bool operator!=(
+                const TopicInterestFilter& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+
+        static const uint32_t num_hashes = 4;
+
+        //! Double hashing: the i-th index is h1 + i * h2, where h1 and h2 are both halves of the hash.
+        static uint32_t bit_index(
+                uint64_t hash,
+                uint32_t i)
+        {
+            uint32_t h1 = static_cast<uint32_t>(hash);
+            uint32_t h2 = static_cast<uint32_t>(hash >> 32) | 1u;
+            return (h1 + i * h2) % (size * 8u);
+        }
+
+        bool active_;
+
+        octet bits_[size];
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTRTPS_RTPS_COMMON_TOPICINTERESTFILTER_H_
@@ -23,6 +23,7 @@
 #define CACHECHANGEPOOL_H_
 
 #include "../resources/ResourceManagement.h"
+#include "../common/Types.h"
 
 #include <vector>
 #include <functional>
@@ -57,8 +58,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param calculateSizeFunc Function that returns the size of the data which will go into the CacheChange.
-         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE and
-         * PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
+         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE,
+         * PREALLOCATED_WITH_REALLOC_MEMORY_MODE and SLAB_MEMORY_MODE)
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, const std::function<uint32_t()>& calculateSizeFunc);
@@ -67,13 +68,22 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param dataSize Size of the data which will go into the CacheChange if it is necessary (on memory management
-         * policy DYNAMIC_RESERVE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE). In other case this variable is not used.
+         * policy DYNAMIC_RESERVE_MEMORY_MODE, PREALLOCATED_WITH_REALLOC_MEMORY_MODE and SLAB_MEMORY_MODE). In other case this variable is not used.
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, uint32_t dataSize);
 
         //!Release a Cache back to the pool.
         void release_Cache(CacheChange_t*);
+
+        /*!
+         * @brief Ensures the payload of a CacheChange reserved from this pool can hold at least the given size.
+         * Current contents are kept. On PREALLOCATED_MEMORY_MODE the payload cannot grow.
+         * @param change CacheChange previously reserved from this pool.
+         * @param dataSize Required size.
+         * @return True if the payload can hold dataSize bytes.
+         */
+        bool reserve_payload(CacheChange_t* change, uint32_t dataSize);
         //!Get the size of the cache vector; all of them (reserved and not reserved).
         size_t get_allCachesSize(){return m_allCaches.size();}
         //!Get the number of frre caches.
@@ -90,6 +100,23 @@ class CacheChangePool {
         bool allocateGroup(uint32_t pool_size);
         CacheChange_t* allocateSingle(uint32_t dataSize);
         MemoryManagementPolicy_t memoryMode;
+
+        //!Free blocks of one size class on SLAB_MEMORY_MODE.
+        struct SizeClass
+        {
+            std::vector<octet*> free_blocks;
+            uint32_t total_blocks = 0;
+            uint32_t next_arena_blocks = 0;
+        };
+
+        //!Size classes, indexed by log2(block size) - slab_min_class_shift.
+        std::vector<SizeClass> m_sizeClasses;
+        //!Arenas the slab blocks are carved from.
+        std::vector<void*> m_arenas;
+        static void reset_change(CacheChange_t* ch);
+        octet* allocateBlock(uint32_t dataSize, uint32_t& blockSize);
+        void releaseBlock(octet* block, uint32_t blockSize);
+        bool allocateArena(size_t class_index);
 };
 }
 } /* namespace rtps */
@@ -86,6 +86,18 @@ public:
     RTPS_DllAPI bool get_min_change_from(CacheChange_t** min_change, const GUID_t& writerGuid);
 
 protected:
+
+    /**
+     * Remove a specific change from the history.
+     * @param a_change Pointer to the CacheChange_t.
+     * @param release Whether the change is returned to the pool. When false, the caller is responsible for
+     * returning it with release_Cache.
+     * @return True if removed.
+     */
+    bool remove_change(
+            CacheChange_t* a_change,
+            bool release);
+
     //!Pointer to the reader
     RTPSReader* mp_reader;
 };
@@ -153,6 +153,13 @@ class RTPSWriter;
          */
         bool add_gap(std::set<SequenceNumber_t>& changes_seq_numbers);
 
+        /**
+         * Adds the GAP messages for a list of sequence numbers to the group, without allocating memory.
+         * @param changes_seq_numbers Sorted list of missed sequence numbers, without duplicates.
+         * @return True when message was added to the group.
+         */
+        bool add_gap(const std::vector<SequenceNumber_t>& changes_seq_numbers);
+
         /**
          * Adds a ACKNACK message to the group.
          * @param seq_num_set Set of missing sequence numbers.
@@ -204,6 +211,17 @@ class RTPSWriter;
 
         bool add_info_ts_in_buffer(const Time_t& timestamp);
 
+        //! Adds the GAP messages for a sorted range of sequence numbers.
+        template<class SequenceIterator>
+        bool add_gaps(
+                SequenceIterator first,
+                SequenceIterator last);
+
+        //! Adds a single GAP message.
+        bool add_gap(
+                const SequenceNumber_t& gap_start,
+                const SequenceNumberSet_t& gap_list);
+
         const RTPSMessageSenderInterface& sender_;
             
         Endpoint* endpoint_;
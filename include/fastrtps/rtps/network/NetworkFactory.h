@@ -171,6 +171,12 @@ class NetworkFactory
         */
         void Shutdown();
 
+        /**
+         * Collects the counters of every registered transport that keeps statistics.
+         * @param stats Vector where the statistics of each transport are appended.
+         */
+        void get_transport_statistics(std::vector<TransportStatistics>& stats) const;
+
     private:
 
         std::vector<std::unique_ptr<TransportInterface> > mRegisteredTransports;
@@ -24,6 +24,7 @@
 #include <memory>
 #include "../../fastrtps_dll.h"
 #include "../common/Guid.h"
+#include "../common/Statistics.h"
 #include <fastrtps/rtps/reader/StatefulReader.h>
 
 #include <fastrtps/rtps/attributes/RTPSParticipantAttributes.h>
@@ -203,6 +204,15 @@ public:
      */
     WLP* wlp() const;
 
+    /**
+     * Takes a snapshot of the statistics of every endpoint and transport of this participant.
+     * Statistics are only kept when the participant was created with the property "fastrtps.statistics"
+     * set to "true".
+     * @param stats Structure to be filled.
+     * @return false if statistics are not enabled on this participant.
+     */
+    bool get_statistics(ParticipantStatistics& stats) const;
+
 private:
 
     //!Pointer to the implementation.
@@ -210,6 +210,25 @@ public:
             CacheChange_t** change,
             WriterProxy** wp) = 0;
 
+    /**
+     * Check whether a CacheChange_t of the history can be read or taken, i.e. the previous changes of its writer
+     * are available. Must be called with the reader mutex locked.
+     * @param change Pointer to the CacheChange_t.
+     * @param wp Pointer to pointer to the WriterProxy. Set to nullptr when the reader does not keep one.
+     * @param unpaired Set to true when the writer of the change is no longer matched, so it will never be available.
+     * @return True if it can be read or taken.
+     */
+    virtual bool is_change_available(
+            CacheChange_t* change,
+            WriterProxy** wp,
+            bool& unpaired) = 0;
+
+    /**
+     * Mark a CacheChange_t as read by the user. Must be called with the reader mutex locked.
+     * @param change Pointer to the CacheChange_t.
+     */
+    void change_read_by_user(CacheChange_t* change);
+
     RTPS_DllAPI bool wait_for_unread_cache(
             const eprosima::fastrtps::Duration_t &timeout);
 
@@ -311,6 +330,12 @@ protected:
             const GUID_t& persistence_guid,
             const SequenceNumber_t& seq);
 
+    /*!
+     * @brief Account a sample added to the history on the statistics counters, when they are enabled.
+     * @param change Sample added to the history.
+     */
+    void statistics_sample_received(const CacheChange_t* change);
+
     //!ReaderHistory
     ReaderHistory* mp_history;
     //!Listener
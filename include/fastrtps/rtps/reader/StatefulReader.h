@@ -23,6 +23,7 @@
 
 #include "RTPSReader.h"
 #include "../../utils/collections/ResourceLimitedVector.hpp"
+#include "../../utils/collections/GuidIndex.hpp"
 #include "../common/CDRMessage_t.h"
 #include "../messages/RTPSMessageGroup.h"
 
@@ -177,6 +178,18 @@ class StatefulReader : public RTPSReader
                 CacheChange_t** change,
                 WriterProxy** wpout = nullptr) override;
 
+        /**
+         * Check whether a CacheChange_t of the history can be read or taken.
+         * @param change Pointer to the CacheChange_t.
+         * @param wpout Pointer to pointer the matched writer proxy
+         * @param unpaired Set to true when the writer of the change is no longer matched.
+         * @return True if its writer is matched and every previous change of the writer is available.
+         */
+        bool is_change_available(
+                CacheChange_t* change,
+                WriterProxy** wpout,
+                bool& unpaired) override;
+
         /**
          * Update the times parameters of the Reader.
          * @param times ReaderTimes reference.
@@ -270,6 +283,8 @@ class StatefulReader : public RTPSReader
         ResourceLimitedVector<WriterProxy*> matched_writers_;
         //! Vector containing pointers to all the inactive, ready for reuse, WriterProxies.
         ResourceLimitedVector<WriterProxy*> matched_writers_pool_;
+        //! Index of the active WriterProxies by their GUID.
+        GuidIndex<WriterProxy*> matched_writers_index_;
         //!
         ResourceLimitedContainerConfig proxy_changes_config_;
         //! True to disable positive ACKs
@@ -24,6 +24,7 @@
 
 #include "RTPSReader.h"
 #include "../../utils/collections/ResourceLimitedVector.hpp"
+#include "../../utils/collections/GuidIndex.hpp"
 
 #include <mutex>
 #include <map>
@@ -152,6 +153,18 @@ public:
             CacheChange_t** change,
             WriterProxy** wpout = nullptr) override;
 
+    /**
+     * Check whether a CacheChange_t of the history can be read or taken. Every change is available.
+     * @param change Pointer to the CacheChange_t.
+     * @param wpout Pointer to pointer of the matched writer proxy. Set to nullptr.
+     * @param unpaired Set to false.
+     * @return True.
+     */
+    bool is_change_available(
+            CacheChange_t* change,
+            WriterProxy** wpout,
+            bool& unpaired) override;
+
     /**
      * Get the number of matched writers
      * @return Number of matched writers
@@ -201,6 +214,8 @@ private:
     //!List of GUID_t os matched writers.
     //!Is only used in the Discovery, to correctly notify the user using SubscriptionListener::onSubscriptionMatched();
     ResourceLimitedVector<RemoteWriterInfo_t> matched_writers_;
+    //!Position of each matched writer on matched_writers_, by its GUID.
+    GuidIndex<size_t> matched_writers_index_;
 };
 
 } /* namespace rtps */
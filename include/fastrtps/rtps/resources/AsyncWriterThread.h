@@ -22,8 +22,10 @@
 #include <thread>
 #include <atomic>
 #include <list>
+#include <string>
 
 #include <fastrtps/rtps/resources/AsyncInterestTree.h>
+#include <fastrtps/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
@@ -73,6 +75,16 @@ public:
             RTPSWriter* interested_writer,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /*!
+     * Sets the settings of the thread, which is started on the first wake up.
+     * @param settings Scheduling settings of the thread.
+     * @param name Name given to the thread.
+     * @note Should be called before any writer wakes the thread up.
+     */
+    void thread_settings(
+            const ThreadSettings& settings,
+            const std::string& name);
+
 private:
 
     AsyncWriterThread(const AsyncWriterThread&) = delete;
@@ -82,6 +94,8 @@ private:
     void run();
 
     std::thread* thread_ = nullptr;
+    ThreadSettings thread_settings_;
+    std::string thread_name_ = "dds.asyncw";
     RecursiveTimedMutex condition_variable_mutex_;
 
     //! List of asynchronous writers.
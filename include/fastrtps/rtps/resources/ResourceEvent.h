@@ -23,9 +23,11 @@
 
 #include "../../utils/TimedMutex.hpp"
 #include "../../utils/TimedConditionVariable.hpp"
+#include "../attributes/ThreadSettings.hpp"
 
 #include <thread>
 #include <atomic>
+#include <string>
 #include <vector>
 #include <asio.hpp>
 
@@ -50,8 +52,12 @@ class ResourceEvent
 
         /*!
          * @brief Method to initialize the internal thread.
+         * @param settings Scheduling settings of the thread.
+         * @param name Name given to the thread.
          */
-        void init_thread();
+        void init_thread(
+                const ThreadSettings& settings = ThreadSettings(),
+                const std::string& name = "dds.ev");
 
         /*!
          * @brief This method removes a TimedEventImpl object in case it is waiting to be processed by ResourceEvent's
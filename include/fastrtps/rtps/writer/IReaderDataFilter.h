@@ -0,0 +1,87 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IReaderDataFilter.h
+ */
+#ifndef _RTPS_WRITER_IREADERDATAFILTER_H_
+#define _RTPS_WRITER_IREADERDATAFILTER_H_
+
+#include "../common/CacheChange.h"
+#include "../common/Guid.h"
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ReaderProxyData;
+
+/**
+ * Interface used by a RTPSWriter to decide whether a change should be sent to a matched reader.
+ * Changes that are not relevant for a reliable reader are announced to it as a GAP.
+ * @ingroup WRITER_MODULE
+ */
+class IReaderDataFilter
+{
+    public:
+
+        virtual ~IReaderDataFilter() = default;
+
+        /**
+         * Check whether a change is relevant for a matched reader.
+         * Called with the writer mutex taken, so implementations should not block.
+         * @param change Change being added to the writer history.
+         * @param reader_guid GUID of the matched reader.
+         * @return true if the change should be sent to the reader.
+         */
+        virtual bool is_relevant(
+                const CacheChange_t& change,
+                const GUID_t& reader_guid) const = 0;
+
+        /**
+         * Check whether the filter may currently consider a change not relevant for some reader.
+         * Writers skip the per reader selection while this returns false.
+         * @return true if is_relevant may return false.
+         */
+        virtual bool is_active() const
+        {
+            return true;
+        }
+
+        /**
+         * Called with the writer mutex taken when a reader is matched, or its information is updated.
+         * @param reader_data Information of the matched reader.
+         */
+        virtual void reader_matched(
+                const ReaderProxyData& reader_data)
+        {
+            (void)reader_data;
+        }
+
+        /**
+         * Called with the writer mutex taken when a reader is unmatched.
+         * @param reader_guid GUID of the unmatched reader.
+         */
+        virtual void reader_unmatched(
+                const GUID_t& reader_guid)
+        {
+            (void)reader_guid;
+        }
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_WRITER_IREADERDATAFILTER_H_
@@ -37,7 +37,9 @@ using LivelinessCallback = std::function<void(
 
 /**
  * @brief A class managing the liveliness of a set of writers. Writers are represented by their LivelinessData
- * @details Uses a shared timed event and informs outside classes on liveliness changes
+ * @details Uses a shared timed event and informs outside classes on liveliness changes.
+ * Leases are tracked lazily: asserting liveliness of an alive writer only renews its lease, and expired leases are
+ * looked for when the timer reaches the earliest deadline it was armed with
  * @ingroup WRITER_MODULE
  */
 class LivelinessManager
@@ -130,12 +132,9 @@ private:
     //!
     void assert_writer_liveliness(LivelinessData& writer);
 
-    /**
-     * @brief A method to calculate the time when the next writer is going to lose liveliness
-     * @details This method is public for testing purposes but it should not be used from outside this class
-     * @return True if at least one writer is alive
-     */
-    bool calculate_next();
+    //! @brief Arms the timer so that it expires at the given deadline
+    //! @param deadline Time when the next writer could lose its liveliness
+    void schedule_timer(const std::chrono::steady_clock::time_point& deadline);
 
     //! @brief A method to find a writer from a guid, liveliness kind and lease duration
     //! @param guid The guid of the writer
@@ -151,6 +150,7 @@ private:
 
 
     //! @brief A method called if the timer expires
+    //! @details Marks as not alive the writers whose lease has run out and computes the next deadline
     //! @return True if the timer should be restarted
     bool timer_expired();
 
@@ -166,10 +166,13 @@ private:
     //! A mutex to protect the liveliness data
     std::mutex mutex_;
 
-    //! The timer owner, i.e. the writer which is next due to lose its liveliness
-    LivelinessData* timer_owner_;
+    //! The time when the timer will expire. Leases may have been renewed since it was armed
+    std::chrono::steady_clock::time_point timer_deadline_;
+
+    //! Whether the timer is waiting for a deadline
+    bool timer_armed_;
 
-    //! A timed callback expiring when a writer (the timer owner) loses its liveliness
+    //! A timed callback expiring when the earliest lease could have run out
     TimedEvent timer_;
 };
 
@@ -26,6 +26,7 @@
 #include "../../utils/collections/ResourceLimitedVector.hpp"
 #include "../common/LocatorSelector.hpp"
 #include "../messages/RTPSMessageSenderInterface.hpp"
+#include "IReaderDataFilter.h"
 
 #include <vector>
 #include <memory>
@@ -40,6 +41,7 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class TimedEvent;
 struct CacheChange_t;
 
 
@@ -169,6 +171,12 @@ public:
      */
     RTPS_DllAPI inline bool isAsync() const { return is_async_; }
 
+    /**
+     * Send the changes grouped in the current batch without waiting for the batch limits.
+     * It does nothing when batching is not enabled.
+     */
+    RTPS_DllAPI void flush();
+
     /**
      * Remove an specified max number of changes
      * @param max Maximum number of changes to remove.
@@ -261,6 +269,28 @@ public:
         return writer_guid == m_guid;
     }
 
+    /**
+     * Set the filter deciding which changes are sent to each matched reader.
+     * It should be set before any reader is matched, as it is notified of the readers being matched.
+     * @param filter Pointer to the filter. nullptr sends every change to every reader.
+     */
+    void reader_data_filter(IReaderDataFilter* filter)
+    {
+        reader_data_filter_ = filter;
+    }
+
+    //! @return The filter deciding which changes are sent to each matched reader.
+    const IReaderDataFilter* reader_data_filter() const
+    {
+        return reader_data_filter_;
+    }
+
+    //! @return Maximum number of instances of the changes written, 0 if it is not limited.
+    uint32_t max_instances() const
+    {
+        return max_instances_;
+    }
+
     /**
      * @brief A method to retrieve the liveliness kind
      * @return Liveliness kind
@@ -336,6 +366,8 @@ protected:
     bool is_async_;
     //!Separate sending activated
     bool m_separateSendingEnabled;
+    //!Filter deciding which changes are sent to each matched reader
+    IReaderDataFilter* reader_data_filter_;
 
     LocatorSelector locator_selector_;
 
@@ -369,6 +401,36 @@ protected:
      */
     virtual bool change_removed_by_history(CacheChange_t* a_change)=0;
 
+    /**
+     * Add a change to a message group. Fragmented changes are added as a DATA_FRAG submessage per fragment.
+     * @param group Message group where the change is added.
+     * @param change Change to add.
+     * @param expects_inline_qos Whether the destinations expect inline QoS.
+     * @return True if all the submessages were added.
+     */
+    bool add_data_to_group(
+            RTPSMessageGroup& group,
+            const CacheChange_t& change,
+            bool expects_inline_qos);
+
+    /**
+     * Whether the changes added to the history are grouped in batches before being sent.
+     * @return True if batching is enabled.
+     */
+    inline bool is_batching() const { return batching_; }
+
+    /**
+     * Account a change added to the unsent list in the current batch, sending the batch when a limit is reached.
+     * Must be called with the writer mutex locked.
+     * @param change Change added to the batch.
+     */
+    void add_to_batch_nts(const CacheChange_t& change);
+
+    /**
+     * Send the unsent changes of the current batch. Must be called with the writer mutex locked.
+     */
+    void flush_batch_nts();
+
 #if HAVE_SECURITY
     SerializedPayload_t encrypt_payload_;
 
@@ -382,6 +444,22 @@ protected:
     //! The liveliness announcement period
     Duration_t liveliness_announcement_period_;
 
+    //! Maximum number of instances of the changes written (0 means no limit)
+    uint32_t max_instances_;
+
+    //! Whether changes are grouped in batches
+    bool batching_;
+    //! Serialized bytes that make a batch be sent
+    uint32_t batch_max_data_bytes_;
+    //! Number of changes that make a batch be sent
+    uint32_t batch_max_samples_;
+    //! Serialized bytes in the current batch
+    uint32_t batch_data_bytes_;
+    //! Number of changes in the current batch
+    uint32_t batch_samples_;
+    //! Sends the current batch when its maximum flush delay expires. Deleted by child classes.
+    TimedEvent* batch_flush_event_;
+
 private:
 
     RTPSWriter& operator=(const RTPSWriter&) = delete;
@@ -28,6 +28,7 @@
 #include "../common/SequenceNumber.h"
 #include "../messages/RTPSMessageGroup.h"
 #include "../common/LocatorSelectorEntry.hpp"
+#include "TimeBasedFilter.h"
 
 
 namespace eprosima {
@@ -74,6 +75,12 @@ class ReaderLocator : public RTPSMessageSenderInterface
             return &locator_info_;
         }
 
+        //! @return The time based filter requested by the remote reader.
+        TimeBasedFilter& time_based_filter()
+        {
+            return time_based_filter_;
+        }
+
         /**
          * Try to start using this object for a new matched reader.
          *
@@ -170,6 +177,7 @@ class ReaderLocator : public RTPSMessageSenderInterface
         RTPSParticipantImpl* owner_;
         LocatorSelectorEntry locator_info_;
         bool expects_inline_qos_;
+        TimeBasedFilter time_based_filter_;
         std::vector<GuidPrefix_t> guid_prefix_as_vector_;
         std::vector<GUID_t> guid_as_vector_;
 };
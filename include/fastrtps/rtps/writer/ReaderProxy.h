@@ -22,6 +22,7 @@
 #include <mutex>
 #include <set>
 #include <atomic>
+#include <chrono>
 
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
 #include <fastrtps/rtps/writer/ReaderLocator.h>
@@ -204,9 +205,9 @@ public:
 
     /**
      * Turns all REQUESTED changes into UNSENT.
-     * @return true if at least one change changed its status, false otherwise.
+     * @return Number of changes that changed their status.
      */
-    bool perform_acknack_response();
+    uint32_t perform_acknack_response();
 
     /**
      * Call this to inform a change was removed from history.
@@ -296,14 +297,13 @@ public:
             const FragmentNumberSet_t& fragments_state);
 
     /**
-     * Filter a CacheChange_t, in this version always returns true.
+     * Filter a CacheChange_t using the reader data filter of the writer, if any, and the time based filter
+     * requested by the reader.
+     * Changes are expected to be checked in sequence number order.
      * @param change
      * @return true if the change is relevant, false otherwise.
      */
-    inline bool rtps_is_relevant(CacheChange_t* change)
-    {
-        (void)change; return true;
-    };
+    bool rtps_is_relevant(CacheChange_t* change);
 
     /**
      * Get the highest fully acknowledged sequence number.
@@ -326,6 +326,46 @@ public:
      */
     bool are_there_gaps();
 
+    /**
+     * Called when a HEARTBEAT requiring a response is sent to the reader.
+     * Sending a HEARTBEAT with a new count while another one is waiting for a response makes the
+     * next ACKNACK ambiguous, so it will not be used to sample the round trip time (Karn's rule).
+     * @param count Count of the HEARTBEAT.
+     * @param time Time the HEARTBEAT was sent.
+     */
+    void heartbeat_sent(
+            Count_t count,
+            const std::chrono::steady_clock::time_point& time);
+
+    /**
+     * Called when an ACKNACK from the reader is accepted.
+     * Updates the round trip time estimation only when it answers the single HEARTBEAT sent since the
+     * previous ACKNACK. As the ACKNACK does not carry the count of the HEARTBEAT it answers, any
+     * other HEARTBEAT sent in between discards the sample.
+     * @param time Time the ACKNACK was received.
+     * @return true if the estimation was updated, false otherwise.
+     */
+    bool acknack_received(const std::chrono::steady_clock::time_point& time);
+
+    /**
+     * Get the smoothed round trip time to the reader.
+     * @return Smoothed round trip time, zero while it has not been measured.
+     */
+    std::chrono::microseconds round_trip_time() const
+    {
+        return srtt_;
+    }
+
+    /**
+     * Get the time after which a response from the reader should have been received:
+     * the smoothed round trip time plus four times its mean deviation.
+     * @return Retransmission timeout, zero while the round trip time has not been measured.
+     */
+    std::chrono::microseconds retransmission_timeout() const
+    {
+        return srtt_ + 4 * rttvar_;
+    }
+
     LocatorSelectorEntry* locator_selector_entry()
     {
         return locator_info_.locator_selector_entry();
@@ -359,6 +399,18 @@ private:
 
     SequenceNumber_t changes_low_mark_;
 
+    //! Whether a HEARTBEAT sent at heartbeat_sent_time_ is waiting for a response.
+    bool heartbeat_pending_;
+    //! Whether another HEARTBEAT was sent while heartbeat_count_ was waiting for a response.
+    bool heartbeat_resent_;
+    //! Count of the HEARTBEAT waiting for a response.
+    Count_t heartbeat_count_;
+    std::chrono::steady_clock::time_point heartbeat_sent_time_;
+    //! Smoothed round trip time.
+    std::chrono::microseconds srtt_;
+    //! Mean deviation of the round trip time.
+    std::chrono::microseconds rttvar_;
+
     using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
     using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
 
@@ -368,9 +420,9 @@ private:
      * Converts all changes with a given status to a different status.
      * @param previous Status to change.
      * @param next Status to adopt.
-     * @return true when at least one change has been modified, false otherwise.
+     * @return Number of changes that have been modified.
      */
-    bool convert_status_on_all_changes(
+    uint32_t convert_status_on_all_changes(
             ChangeForReaderStatus_t previous,
             ChangeForReaderStatus_t next);
 
@@ -23,6 +23,7 @@
 
 #include "RTPSWriter.h"
 #include "../../utils/collections/ResourceLimitedVector.hpp"
+#include "../../utils/collections/GuidIndex.hpp"
 #include <condition_variable>
 #include <mutex>
 
@@ -33,6 +34,9 @@ namespace rtps {
 
 class ReaderProxy;
 class TimedEvent;
+class StatefulWriterOrganizer;
+template<class T> class RTPSWriterCollector;
+template<class T> class RepairPlanner;
 
 /**
  * Class StatefulWriter, specialization of RTPSWriter that maintains information of each matched Reader.
@@ -77,6 +81,8 @@ private:
     ResourceLimitedVector<ReaderProxy*> matched_readers_;
     //! Vector containing all the inactive, ready for reuse, ReaderProxies.
     ResourceLimitedVector<ReaderProxy*> matched_readers_pool_;
+    //! Index of the active ReaderProxies by their GUID.
+    GuidIndex<ReaderProxy*> matched_readers_index_;
 
     using ReaderProxyIterator = ResourceLimitedVector<ReaderProxy*>::iterator;
     using ReaderProxyConstIterator = ResourceLimitedVector<ReaderProxy*>::const_iterator;
@@ -281,12 +287,31 @@ private:
             RTPSMessageGroup& message_group,
             uint32_t& last_bytes_processed);
 
-    void send_heartbeat_nts_(
+    bool send_heartbeat_nts_(
             size_t number_of_readers,
             RTPSMessageGroup& message_group,
             bool final,
             bool liveliness = false);
 
+    /**
+     * Informs the reliable readers that a HEARTBEAT requiring a response has been sent to them,
+     * in order to measure their round trip time. Only used if adaptiveReliability is enabled.
+     * @param reader Reader the HEARTBEAT was sent to. nullptr when it was sent to all of them.
+     */
+    void heartbeat_sent_nts_(ReaderProxy* reader);
+
+    /**
+     * Recalculates the periodic HB period from the unacknowledged data and the round trip time of the readers.
+     * Only used if adaptiveReliability is enabled.
+     */
+    void update_heartbeat_period_nts_();
+
+    /**
+     * Recalculates the nack response delay so that ACKNACKs from readers with different round trip times
+     * answering the same HEARTBEAT are responded together. Only used if adaptiveReliability is enabled.
+     */
+    void update_nack_response_delay_nts_();
+
     void check_acked_status();
 
     /**
@@ -310,6 +335,21 @@ private:
 
     std::vector<std::unique_ptr<FlowController> > m_controllers;
 
+    //! Changes to be sent by send_any_unsent_changes, kept between calls to reuse its memory.
+    RTPSWriterCollector<ReaderProxy*>* relevant_changes_;
+
+    //! Irrelevant changes to be notified with GAPs by send_any_unsent_changes, kept between calls.
+    StatefulWriterOrganizer* not_relevant_changes_;
+
+    //! Planner of the changes sent by send_any_unsent_changes, kept between calls.
+    RepairPlanner<ReaderProxy*>* repair_planner_;
+
+    //! Irrelevant changes of a reader when the separate sending is enabled, kept between calls.
+    std::vector<SequenceNumber_t> irrelevant_changes_;
+
+    //! Relevance of the change being sent for each matched reader, kept between calls.
+    std::vector<bool> readers_relevance_;
+
     StatefulWriter& operator=(const StatefulWriter&) = delete;
 };
 
@@ -32,6 +32,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+template<class T> class RTPSWriterCollector;
 
 /**
  * Class StatelessWriter, specialization of RTPSWriter that manages writers that don't keep state of the matched readers.
@@ -143,11 +144,48 @@ private:
 
     void update_reader_info(bool create_sender_resources);
 
+    //! @return true when changes may not be relevant for every matched reader.
+    bool has_reader_filters() const
+    {
+        return (reader_data_filter_ != nullptr && reader_data_filter_->is_active()) || has_time_based_filters_;
+    }
+
+    /**
+     * Check whether a change should be sent to a matched reader, according to the reader data filter of the writer
+     * and the time based filter of the reader.
+     */
+    bool is_relevant(
+            const CacheChange_t& change,
+            ReaderLocator& reader);
+
+    /**
+     * Enable on the locator selector only the matched readers a change is relevant for.
+     * The group is flushed when the selection changes. restore_reader_selection enables again every reader.
+     * @param change Change to be sent.
+     * @param group Message group the change will be added to.
+     * @return true when the change is relevant for any matched reader.
+     */
+    bool select_relevant_readers(
+            const CacheChange_t& change,
+            RTPSMessageGroup& group);
+
+    //! Enable again every matched reader, if select_relevant_readers changed the selection.
+    void restore_reader_selection();
+
     bool is_inline_qos_expected_ = false;
+    //! Whether select_relevant_readers changed the selection since it was last restored
+    bool reader_selection_changed_ = false;
+    //! Whether any matched reader requested a time based filter
+    bool has_time_based_filters_ = false;
     LocatorList_t fixed_locators_;
     ResourceLimitedVector<ReaderLocator> matched_readers_;
     ResourceLimitedVector<ChangeForReader_t, std::true_type> unsent_changes_;
     std::vector<std::unique_ptr<FlowController> > flow_controllers_;
+
+    //! Changes to be sent by send_any_unsent_changes, kept between calls to reuse its memory.
+    RTPSWriterCollector<ReaderLocator*>* changes_to_send_;
+    //! Whether changes_to_send_ is being used by send_any_unsent_changes.
+    bool sending_changes_ = false;
 };
 }
 } /* namespace rtps */
@@ -0,0 +1,200 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimeBasedFilter.h
+ */
+#ifndef _FASTRTPS_RTPS_WRITER_TIMEBASEDFILTER_H_
+#define _FASTRTPS_RTPS_WRITER_TIMEBASEDFILTER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "../common/CacheChange.h"
+#include "../common/InstanceHandle.h"
+#include "../common/Time_t.h"
+
+#include <map>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Writer side implementation of the TIME_BASED_FILTER QoS of a matched reader.
+ * A change is filtered out when its source timestamp is closer than the minimum separation to the last change of
+ * the same instance that passed the filter.
+ * Filtered out changes are never sent later, so the last change of a burst shorter than the minimum separation is
+ * not sent to the reader until a newer change of its instance passes the filter.
+ * @ingroup WRITER_MODULE
+ */
+class TimeBasedFilter
+{
+    public:
+
+        TimeBasedFilter()
+            : minimum_separation_ns_(0)
+            , max_instances_(0)
+        {
+        }
+
+        /**
+         * Set the maximum number of instances whose last change is kept.
+         * When it is reached, the instances that would not filter out a new change are forgotten first, and then the
+         * instance that passed the filter the longest time ago.
+         * @param max_instances Maximum number of instances. Zero means no limit.
+         */
+        void max_instances(
+                size_t max_instances)
+        {
+            max_instances_ = max_instances;
+        }
+
+        /**
+         * Set the minimum separation requested by the reader.
+         * @param minimum_separation Minimum separation. Zero disables the filter.
+         * @return true if the minimum separation has changed.
+         */
+        bool minimum_separation(
+                const Duration_t& minimum_separation)
+        {
+            int64_t ns = minimum_separation.to_ns();
+            if (ns == minimum_separation_ns_)
+            {
+                return false;
+            }
+
+            minimum_separation_ns_ = ns;
+            last_passed_.clear();
+            return true;
+        }
+
+        //! @return true when the filter may discard changes.
+        bool enabled() const
+        {
+            return minimum_separation_ns_ > 0;
+        }
+
+        /**
+         * Check whether a change passes the filter, recording it as the last change sent of its instance.
+         * Changes disposing or unregistering an instance always pass, and its last change is forgotten.
+         * Checking the same change again gives the same result while its instance is not forgotten.
+         * @param change Change added to the writer history.
+         * @return true if the change should be sent to the reader.
+         */
+        bool pass(
+                const CacheChange_t& change)
+        {
+            if (!enabled())
+            {
+                return true;
+            }
+
+            if (change.kind != ALIVE)
+            {
+                last_passed_.erase(change.instanceHandle);
+                return true;
+            }
+
+            auto it = last_passed_.find(change.instanceHandle);
+            if (it == last_passed_.end())
+            {
+                if (max_instances_ > 0 && last_passed_.size() >= max_instances_)
+                {
+                    make_room(change.sourceTimestamp.to_ns());
+                }
+
+                last_passed_.emplace(change.instanceHandle, LastPassed{change.sourceTimestamp.to_ns(),
+                        change.sequenceNumber});
+                return true;
+            }
+
+            if (it->second.sequence_number == change.sequenceNumber)
+            {
+                return true;
+            }
+
+            int64_t timestamp = change.sourceTimestamp.to_ns();
+            if (change.sequenceNumber < it->second.sequence_number ||
+                    timestamp - it->second.timestamp < minimum_separation_ns_)
+            {
+                return false;
+            }
+
+            it->second.timestamp = timestamp;
+            it->second.sequence_number = change.sequenceNumber;
+            return true;
+        }
+
+        //! Forget the changes that passed the filter.
+        void clear()
+        {
+            last_passed_.clear();
+        }
+
+        //! @return Number of instances whose last change is kept.
+        size_t instance_count() const
+        {
+            return last_passed_.size();
+        }
+
+    private:
+
+        struct LastPassed
+        {
+            int64_t timestamp;
+            SequenceNumber_t sequence_number;
+        };
+
+        /**
+         * Forget instances to make room for a new one.
+         * @param timestamp Source timestamp of the change of the new instance.
+         */
+        void make_room(
+                int64_t timestamp)
+        {
+            auto oldest = last_passed_.end();
+            for (auto it = last_passed_.begin(); it != last_passed_.end();)
+            {
+                if (timestamp - it->second.timestamp >= minimum_separation_ns_)
+                {
+                    it = last_passed_.erase(it);
+                }
+                else
+                {
+                    if (oldest == last_passed_.end() || it->second.timestamp < oldest->second.timestamp)
+                    {
+                        oldest = it;
+                    }
+                    ++it;
+                }
+            }
+
+            if (last_passed_.size() >= max_instances_ && oldest != last_passed_.end())
+            {
+                last_passed_.erase(oldest);
+            }
+        }
+
+        int64_t minimum_separation_ns_;
+
+        size_t max_instances_;
+
+        std::map<InstanceHandle_t, LastPassed> last_passed_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // _FASTRTPS_RTPS_WRITER_TIMEBASEDFILTER_H_
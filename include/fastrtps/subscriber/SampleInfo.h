@@ -30,6 +30,36 @@
 namespace eprosima {
 namespace fastrtps {
 
+/**
+ * Whether a sample was returned before by a read. They can be combined in a mask to select the samples returned by
+ * Subscriber::read, Subscriber::take and Subscriber::take_loans.
+ * @ingroup FASTRTPS_MODULE
+ */
+enum SampleStateMask : uint32_t
+{
+    //! The sample was returned before.
+    READ_SAMPLE_STATE = 0x01,
+    //! The sample was not returned before.
+    NOT_READ_SAMPLE_STATE = 0x02,
+    //! Every sample.
+    ANY_SAMPLE_STATE = 0x03
+};
+
+/**
+ * Kinds of sample, one for each rtps::ChangeKind_t. They can be combined in a mask to select the samples returned by
+ * Subscriber::read, Subscriber::take and Subscriber::take_loans.
+ * @ingroup FASTRTPS_MODULE
+ */
+enum SampleKindMask : uint32_t
+{
+    ALIVE_SAMPLE_KIND = 0x01 << rtps::ALIVE,
+    NOT_ALIVE_DISPOSED_SAMPLE_KIND = 0x01 << rtps::NOT_ALIVE_DISPOSED,
+    NOT_ALIVE_UNREGISTERED_SAMPLE_KIND = 0x01 << rtps::NOT_ALIVE_UNREGISTERED,
+    NOT_ALIVE_DISPOSED_UNREGISTERED_SAMPLE_KIND = 0x01 << rtps::NOT_ALIVE_DISPOSED_UNREGISTERED,
+    //! Every kind.
+    ANY_SAMPLE_KIND = 0x0F
+};
+
 /**
  * Class SampleInfo_t with information that is provided along a sample when reading data from a Subscriber.
  * @ingroup FASTRTPS_MODULE
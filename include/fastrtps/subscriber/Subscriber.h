@@ -25,12 +25,12 @@
 #include "../attributes/SubscriberAttributes.h"
 #include "../qos/DeadlineMissedStatus.h"
 #include "../qos/LivelinessChangedStatus.h"
+#include "SampleInfo.h"
 
 namespace eprosima {
 namespace fastrtps {
 
 class SubscriberImpl;
-class SampleInfo_t;
 
 /**
  * Class Subscriber, contains the public API that allows the user to control the reception of messages.
@@ -42,6 +42,7 @@ class SampleInfo_t;
 class RTPS_DllAPI Subscriber
 {
     friend class SubscriberImpl;
+    friend class WaitSet;
 
     virtual ~Subscriber() {}
 
@@ -90,6 +91,94 @@ public:
             void* sample,
             SampleInfo_t* info);
 
+    /**
+     * @brief Reads up to max_samples samples from the Subscriber with a single access to its history.
+     * The samples are kept in the Subscriber and marked as read.
+     * @param samples Array of max_samples pointers to the objects where you want the samples stored.
+     * @param infos Array of max_samples SampleInfo_t structures that inform you about your samples. May be nullptr.
+     * @param max_samples Maximum number of samples to read.
+     * @param instance Instance of the samples. c_InstanceHandle_Unknown selects the samples of every instance.
+     * @param sample_states Mask of SampleStateMask values selecting the samples by whether they were read before.
+     * @param sample_kinds Mask of SampleKindMask values selecting the samples by their kind.
+     * @return Number of samples read.
+     * @note This method is blocked for a period of time.
+     * ReliabilityQosPolicy.max_blocking_time on SubscriberAttributes defines this period of time.
+     */
+    uint32_t read(
+            void** samples,
+            SampleInfo_t* infos,
+            uint32_t max_samples,
+            const rtps::InstanceHandle_t& instance = rtps::c_InstanceHandle_Unknown,
+            uint32_t sample_states = ANY_SAMPLE_STATE,
+            uint32_t sample_kinds = ANY_SAMPLE_KIND);
+
+    /**
+     * @brief Takes up to max_samples samples from the Subscriber with a single access to its history.
+     * The samples are removed from the Subscriber.
+     * @param samples Array of max_samples pointers to the objects where you want the samples stored.
+     * @param infos Array of max_samples SampleInfo_t structures that inform you about your samples. May be nullptr.
+     * @param max_samples Maximum number of samples to take.
+     * @param instance Instance of the samples. c_InstanceHandle_Unknown selects the samples of every instance.
+     * @param sample_states Mask of SampleStateMask values selecting the samples by whether they were read before.
+     * @param sample_kinds Mask of SampleKindMask values selecting the samples by their kind.
+     * @return Number of samples taken.
+     * @note This method is blocked for a period of time.
+     * ReliabilityQosPolicy.max_blocking_time on SubscriberAttributes defines this period of time.
+     */
+    uint32_t take(
+            void** samples,
+            SampleInfo_t* infos,
+            uint32_t max_samples,
+            const rtps::InstanceHandle_t& instance = rtps::c_InstanceHandle_Unknown,
+            uint32_t sample_states = ANY_SAMPLE_STATE,
+            uint32_t sample_kinds = ANY_SAMPLE_KIND);
+
+    /**
+     * @brief Takes up to max_samples samples from the Subscriber without copying them to user memory, with a
+     * single access to its history. See take_loan.
+     * Every loaned sample must be given back with return_loan.
+     * @param[out] samples Array of max_samples pointers where the loaned samples are stored.
+     * @param infos Array of max_samples SampleInfo_t structures that inform you about your samples. May be nullptr.
+     * @param max_samples Maximum number of samples to take.
+     * @param instance Instance of the samples. c_InstanceHandle_Unknown selects the samples of every instance.
+     * @param sample_states Mask of SampleStateMask values selecting the samples by whether they were read before.
+     * @param sample_kinds Mask of SampleKindMask values selecting the samples by their kind.
+     * @return Number of samples taken.
+     * @note This method is blocked for a period of time.
+     * ReliabilityQosPolicy.max_blocking_time on SubscriberAttributes defines this period of time.
+     */
+    uint32_t take_loans(
+            const void** samples,
+            SampleInfo_t* infos,
+            uint32_t max_samples,
+            const rtps::InstanceHandle_t& instance = rtps::c_InstanceHandle_Unknown,
+            uint32_t sample_states = ANY_SAMPLE_STATE,
+            uint32_t sample_kinds = ANY_SAMPLE_KIND);
+
+    /**
+     * @brief Takes next sample from the Subscriber without copying it to user memory.
+     * The sample is removed from the subscriber. For plain types (see TopicDataType::is_plain) the returned
+     * pointer refers to the received payload, which is kept out of the history pool until the sample is returned.
+     * Other samples, and samples whose payload does not have the alignment of the type (see
+     * TopicDataType::plain_alignment), are deserialized on a sample created with TopicDataType::createData.
+     * Every loaned sample must be given back with return_loan.
+     * @param[out] sample Pointer to the loaned sample.
+     * @param info Pointer to a SampleInfo_t structure that informs you about your sample.
+     * @return True if a sample was taken.
+     * @note This method is blocked for a period of time.
+     * ReliabilityQosPolicy.max_blocking_time on SubscriberAttributes defines this period of time.
+     */
+    bool take_loan(
+            const void*& sample,
+            SampleInfo_t* info);
+
+    /**
+     * @brief Gives back a sample loaned with take_loan.
+     * @param[in,out] sample Pointer to the loaned sample. It is set to nullptr on success.
+     * @return True if the sample was loaned by this subscriber.
+     */
+    bool return_loan(const void*& sample);
+
     /**
      * Update the Attributes of the subscriber;
      * @param att Reference to a SubscriberAttributes object to update the parameters;
@@ -28,6 +28,9 @@
 #include "SampleInfo.h"
 
 #include <chrono>
+#include <functional>
+#include <memory>
+#include <set>
 
 namespace eprosima {
 namespace fastrtps {
@@ -37,6 +40,7 @@ class WriterProxy;
 }
 
 class SubscriberImpl;
+class KeyHashCache;
 
 /**
  * Class SubscriberHistory, container of the different CacheChanges of a subscriber
@@ -93,6 +97,79 @@ class SubscriberHistory: public rtps::ReaderHistory
                 std::chrono::steady_clock::time_point& max_blocking_time);
         ///@}
 
+        /**
+         * Takes the next sample without copying it when possible.
+         * ALIVE samples of plain types, received with the platform endianness, are left on the payload of their
+         * change, which is removed from the history but not returned to the pool. Other samples are deserialized on
+         * a sample created with TopicDataType::createData.
+         * @param[out] sample Pointer to the sample.
+         * @param[out] change Change holding the sample, to be released with release_Cache when the sample is no
+         * longer used. nullptr when the sample was created with TopicDataType::createData.
+         * @param info Pointer to a SampleInfo_t object where the information about the sample is stored.
+         * @param max_blocking_time Maximum time the function can be blocked.
+         * @return True if a sample was taken.
+         */
+        bool take_next_loan(
+                void*& sample,
+                rtps::CacheChange_t*& change,
+                SampleInfo_t* info,
+                std::chrono::steady_clock::time_point& max_blocking_time);
+
+        /** @name Read or take several samples methods.
+         * Methods to read or take up to max_samples samples with a single access to the History.
+         * @param samples Array of max_samples pointers to the objects where the samples are stored.
+         * @param infos Array of max_samples SampleInfo_t objects where the information about the samples is stored.
+         * May be nullptr.
+         * @param max_samples Maximum number of samples returned.
+         * @param instance Instance of the samples. c_InstanceHandle_Unknown selects every instance.
+         * @param sample_states Mask of SampleStateMask values the samples must match.
+         * @param sample_kinds Mask of SampleKindMask values the samples must match.
+         * @param max_blocking_time Maximum time the function can be blocked.
+         * @return Number of samples returned.
+         */
+        ///@{
+        uint32_t read(
+                void** samples,
+                SampleInfo_t* infos,
+                uint32_t max_samples,
+                const rtps::InstanceHandle_t& instance,
+                uint32_t sample_states,
+                uint32_t sample_kinds,
+                std::chrono::steady_clock::time_point& max_blocking_time);
+
+        uint32_t take(
+                void** samples,
+                SampleInfo_t* infos,
+                uint32_t max_samples,
+                const rtps::InstanceHandle_t& instance,
+                uint32_t sample_states,
+                uint32_t sample_kinds,
+                std::chrono::steady_clock::time_point& max_blocking_time);
+        ///@}
+
+        /**
+         * Takes up to max_samples samples without copying them when possible. See take_next_loan.
+         * @param[out] samples Array of max_samples pointers where the loaned samples are stored.
+         * @param[out] changes Array of max_samples pointers where the changes holding the samples are stored.
+         * @param infos Array of max_samples SampleInfo_t objects where the information about the samples is stored.
+         * May be nullptr.
+         * @param max_samples Maximum number of samples returned.
+         * @param instance Instance of the samples. c_InstanceHandle_Unknown selects every instance.
+         * @param sample_states Mask of SampleStateMask values the samples must match.
+         * @param sample_kinds Mask of SampleKindMask values the samples must match.
+         * @param max_blocking_time Maximum time the function can be blocked.
+         * @return Number of samples returned.
+         */
+        uint32_t take_loans(
+                void** samples,
+                rtps::CacheChange_t** changes,
+                SampleInfo_t* infos,
+                uint32_t max_samples,
+                const rtps::InstanceHandle_t& instance,
+                uint32_t sample_states,
+                uint32_t sample_kinds,
+                std::chrono::steady_clock::time_point& max_blocking_time);
+
         bool readNextBuffer(rtps::SerializedPayload_t* data, SampleInfo_t* info);
         bool takeNextBuffer(rtps::SerializedPayload_t* data, SampleInfo_t* info);
 
@@ -132,6 +209,8 @@ class SubscriberHistory: public rtps::ReaderHistory
         t_m_Inst_Caches keyed_changes_;
         //!Time point when the next deadline will occur (only used for topics with no key)
         std::chrono::steady_clock::time_point next_deadline_us_;
+        //!Instances with a deadline set, ordered by the time they will miss it (only used for topics with key)
+        std::set<std::pair<std::chrono::steady_clock::time_point, rtps::InstanceHandle_t>> deadlines_;
         //!HistoryQosPolicy values.
         HistoryQosPolicy m_historyQos;
         //!ResourceLimitsQosPolicy values.
@@ -142,6 +221,49 @@ class SubscriberHistory: public rtps::ReaderHistory
         //!Type object to deserialize Key
         void * mp_getKeyObject;
 
+        //!Instance handles of the last received keys
+        std::unique_ptr<KeyHashCache> key_hash_cache_;
+
+        bool remove_change_sub(
+                rtps::CacheChange_t* change,
+                bool release);
+
+        void get_sample_info(
+                rtps::CacheChange_t* change,
+                rtps::WriterProxy* wp,
+                void* data,
+                SampleInfo_t* info);
+
+        //! Reads or takes samples deserializing them on the given objects.
+        uint32_t get_sample_copies(
+                void** samples,
+                SampleInfo_t* infos,
+                uint32_t max_samples,
+                const rtps::InstanceHandle_t& instance,
+                uint32_t sample_states,
+                uint32_t sample_kinds,
+                bool take,
+                std::chrono::steady_clock::time_point& max_blocking_time);
+
+        //! Whether the sample of a change can be loaned directly from its payload.
+        bool is_payload_loanable(const rtps::CacheChange_t* change) const;
+
+        /**
+         * Selects up to max_samples available changes matching the given instance and masks, under a single
+         * acquisition of the mutex.
+         * @param process Called for each selected change with its position in the output. When taking, its result
+         * tells whether the change is returned to the pool once it is removed from the History.
+         * @return Number of selected changes.
+         */
+        uint32_t get_samples(
+                uint32_t max_samples,
+                const rtps::InstanceHandle_t& instance,
+                uint32_t sample_states,
+                uint32_t sample_kinds,
+                bool take,
+                std::chrono::steady_clock::time_point& max_blocking_time,
+                const std::function<bool(rtps::CacheChange_t*, rtps::WriterProxy*, uint32_t)>& process);
+
         /**
          * @brief Method that finds a key in m_keyedChanges or tries to add it if not found
          * @param a_change The change to get the key from
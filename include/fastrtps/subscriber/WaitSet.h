@@ -0,0 +1,164 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSet.h
+ */
+
+#ifndef WAITSET_H_
+#define WAITSET_H_
+
+#include "../fastrtps_dll.h"
+#include "../rtps/common/Time_t.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+class Subscriber;
+class WaitSetRegistration;
+
+/**
+ * Statuses of a Subscriber a WaitSet can wait for. They can be combined in a mask.
+ * @ingroup FASTRTPS_MODULE
+ */
+enum SubscriberStatus : uint32_t
+{
+    //! The subscriber has unread samples.
+    DATA_AVAILABLE_STATUS = 0x01,
+    //! A publisher has been matched or unmatched.
+    SUBSCRIPTION_MATCHED_STATUS = 0x02,
+    //! The liveliness of a matched publisher has changed.
+    LIVELINESS_CHANGED_STATUS = 0x04,
+    //! An instance has missed its requested deadline.
+    REQUESTED_DEADLINE_MISSED_STATUS = 0x08,
+    //! Every status.
+    ALL_SUBSCRIBER_STATUSES = 0x0F
+};
+
+/**
+ * Class WaitSet, allows a single thread to block until any of several subscribers has new data or a status change.
+ *
+ * DATA_AVAILABLE_STATUS is reported as long as the subscriber has unread samples, as notified by the subscriber when
+ * samples are received, read or taken. It may be reported once more after unread samples are removed without being
+ * read, for example when their lifespan expires. The other statuses are reported once for each time they change.
+ * Subscribers are detached automatically when they are removed.
+ * Subscribers can be attached and detached, and the WaitSet destroyed, from their listener callbacks.
+ * @ingroup FASTRTPS_MODULE
+ */
+class RTPS_DllAPI WaitSet
+{
+    public:
+
+        //! A subscriber with triggered statuses.
+        struct ActiveSubscriber
+        {
+            //! The subscriber.
+            Subscriber* subscriber;
+            //! Mask of the statuses that have triggered.
+            uint32_t statuses;
+        };
+
+        WaitSet();
+
+        //! Detaches every subscriber.
+        ~WaitSet();
+
+        WaitSet(
+                const WaitSet&) = delete;
+
+        WaitSet& operator =(
+                const WaitSet&) = delete;
+
+        /**
+         * Attach a subscriber, or change the statuses waited for on an attached one.
+         * @param subscriber Subscriber to attach.
+         * @param status_mask Mask of SubscriberStatus values to wait for.
+         * @return True if the subscriber was attached.
+         */
+        bool attach(
+                Subscriber* subscriber,
+                uint32_t status_mask = ALL_SUBSCRIBER_STATUSES);
+
+        /**
+         * Detach a subscriber.
+         * @param subscriber Subscriber to detach.
+         * @return True if the subscriber was attached.
+         */
+        bool detach(
+                Subscriber* subscriber);
+
+        /**
+         * Blocks the current thread until an attached subscriber has a triggered status, wake_up is called or the
+         * timeout expires.
+         * @param[out] active Subscribers with triggered statuses.
+         * @param timeout Maximum time the function will be blocked.
+         * @return False if the timeout expired.
+         */
+        bool wait(
+                std::vector<ActiveSubscriber>& active,
+                const Duration_t& timeout);
+
+        //! Makes a blocked wait return without active subscribers, or the next one if none is blocked.
+        void wake_up();
+
+    private:
+
+        friend class WaitSetRegistration;
+
+        struct Attachment
+        {
+            Subscriber* subscriber;
+            std::shared_ptr<WaitSetRegistration> registration;
+            uint32_t status_mask;
+            uint32_t pending;
+            bool data_available;
+        };
+
+        //! Called through the registration of an attached subscriber when one of its statuses changes.
+        void notify(
+                const WaitSetRegistration* registration,
+                uint32_t status);
+
+        //! Called through the registration of an attached subscriber when its unread samples change.
+        void data_available(
+                const WaitSetRegistration* registration,
+                bool available);
+
+        //! Called through the registration of an attached subscriber when it is being removed.
+        void subscriber_removed(
+                const WaitSetRegistration* registration);
+
+        std::mutex mutex_;
+
+        //! Signaled when a status changes or the set of subscribers changes.
+        std::condition_variable cv_;
+
+        std::vector<Attachment> attachments_;
+
+        //! Incremented on every change that could trigger a blocked wait.
+        uint64_t generation_;
+
+        bool woken_up_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* WAITSET_H_ */
@@ -16,6 +16,7 @@
 #define SOCKET_TRANSPORT_DESCRIPTOR_H
 
 #include "./TransportDescriptorInterface.h"
+#include "../rtps/attributes/ThreadSettings.hpp"
 
 #ifdef _WIN32
 #include <cstdint>
@@ -51,6 +52,7 @@ struct SocketTransportDescriptor : public TransportDescriptorInterface
         , sendBufferSize(t.sendBufferSize)
         , receiveBufferSize(t.receiveBufferSize)
         , TTL(t.TTL)
+        , reception_threads(t.reception_threads)
     {}
 
     virtual ~SocketTransportDescriptor(){}
@@ -65,6 +67,8 @@ struct SocketTransportDescriptor : public TransportDescriptorInterface
     std::vector<std::string> interfaceWhiteList;
     //! Specified time to live (8bit - 255 max TTL)
     uint8_t TTL;
+    //! Settings of the threads listening on the input channels.
+    ThreadSettings reception_threads;
 };
 
 } // namespace rtps
@@ -20,6 +20,7 @@
 #include "../rtps/common/Locator.h"
 #include "../rtps/common/LocatorSelector.hpp"
 #include "../rtps/common/PortParameters.h"
+#include "../rtps/common/Statistics.h"
 #include "TransportDescriptorInterface.h"
 #include "TransportReceiverInterface.h"
 #include "../rtps/network/SenderResource.h"
@@ -177,6 +178,17 @@ public:
     */
     virtual void shutdown() {};
 
+    /**
+     * Retrieves the counters of the transport.
+     * @param stats Structure to be filled.
+     * @return false if the transport does not keep statistics.
+     */
+    virtual bool get_statistics(TransportStatistics& stats) const
+    {
+        (void)stats;
+        return false;
+    }
+
     int32_t kind() const { return transport_kind_; }
 
 protected:
@@ -27,6 +27,7 @@
 #include <memory>
 #include <map>
 #include <mutex>
+#include <atomic>
 
 namespace eprosima{
 namespace fastrtps{
@@ -130,6 +131,8 @@ public:
 
     virtual bool fillUnicastLocator(Locator_t &locator, uint32_t well_known_port) const override;
 
+    virtual bool get_statistics(TransportStatistics& stats) const override;
+
 protected:
 
     friend class UDPChannelResource;
@@ -144,6 +147,12 @@ protected:
     uint32_t mSendBufferSize;
     uint32_t mReceiveBufferSize;
 
+    // Counters updated on send.
+    std::atomic<uint64_t> datagrams_sent_;
+    std::atomic<uint64_t> bytes_sent_;
+    std::atomic<uint64_t> send_errors_;
+    std::atomic<uint64_t> would_block_;
+
     UDPTransportInterface(int32_t transport_kind);
 
     virtual bool compare_locator_ip(const Locator_t& lh, const Locator_t& rh) const = 0;
@@ -55,6 +55,11 @@ public:
             eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
             bool force_md5 = false) override;
 
+    RTPS_DllAPI bool serializeKey(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* key,
+            bool* requires_md5) override;
+
     RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(void* data) override;
 
     RTPS_DllAPI bool serialize(
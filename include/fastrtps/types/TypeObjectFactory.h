@@ -20,6 +20,7 @@
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <mutex>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -28,16 +29,66 @@ namespace types {
 class TypeObjectFactory
 {
 private:
-    mutable std::recursive_mutex m_MutexIdentifiers;
-    mutable std::recursive_mutex m_MutexObjects;
+    //! Name under which a stored TypeIdentifier is reported.
+    struct TypeEntry
+    {
+        const TypeIdentifier* identifier;
+        std::string name;
+    };
+
+    typedef std::unordered_map<std::string, const TypeIdentifier*> IdentifierMap;
+    typedef std::unordered_map<const TypeIdentifier*, const TypeObject*> ObjectMap;
+    typedef std::unordered_multimap<size_t, TypeEntry> NameIndex;
+
+    //! Registered types. Stored identifiers and objects are only freed with the factory.
+    struct Registry
+    {
+        IdentifierMap identifiers; // Basic, builtin and EK_MINIMAL
+        IdentifierMap complete_identifiers; // Only EK_COMPLETE
+        ObjectMap objects; // EK_MINIMAL
+        ObjectMap complete_objects; // EK_COMPLETE
+        std::unordered_map<std::string, std::string> aliases; // Aliases
+        std::unordered_map<const TypeIdentifier*, size_t> hashes; // Hash of each stored TypeIdentifier
+        NameIndex names; // Hash of the TypeIdentifier -> lowest name registered with it (identifiers)
+        NameIndex complete_names; // Hash of the TypeIdentifier -> lowest name registered with it (complete)
+    };
+
+    Registry registry_;
+
+    //! Protects registry_. Lookups only hold it while searching, as the pointers they return remain valid.
+    mutable std::mutex m_MutexRegistry;
+
+    static size_t hash_identifier(const TypeIdentifier& identifier);
+
+    static size_t get_hash(
+            const Registry& registry,
+            const TypeIdentifier& identifier);
+
+    static const TypeEntry* find_entry(
+            const Registry& registry,
+            const TypeIdentifier* identifier);
+
+    static const TypeIdentifier* find_identifier(
+            const Registry& registry,
+            const std::string& type_name,
+            bool complete);
+
+    static void index_name(
+            Registry& registry,
+            const std::string& type_name,
+            const TypeIdentifier* identifier);
+
+    static void reindex(
+            Registry& registry,
+            const TypeIdentifier* identifier);
+
+    static const TypeIdentifier* store_type_identifier(
+            Registry& registry,
+            const std::string& type_name,
+            const TypeIdentifier* identifier);
 
 protected:
     TypeObjectFactory();
-    std::map<const std::string, const TypeIdentifier*> identifiers_; // Basic, builtin and EK_MINIMAL
-    std::map<const std::string, const TypeIdentifier*> complete_identifiers_; // Only EK_COMPLETE
-    std::map<const TypeIdentifier*, const TypeObject*> objects_; // EK_MINIMAL
-    std::map<const TypeIdentifier*, const TypeObject*> complete_objects_; // EK_COMPLETE
-    std::map<std::string, std::string> aliases_; // Aliases
 
     DynamicType_ptr build_dynamic_type(
             TypeDescriptor& descriptor,
@@ -48,8 +99,6 @@ protected:
 
     const TypeIdentifier* get_stored_type_identifier(const TypeIdentifier* identifier) const;
 
-    void nullify_all_entries(const TypeIdentifier* identifier);
-
     void create_builtin_annotations();
 
     void apply_type_annotations(
@@ -126,13 +175,9 @@ public:
             const TypeIdentifier* identifier,
             const TypeObject* object);
 
-    RTPS_DllAPI inline void add_alias(
+    RTPS_DllAPI void add_alias(
             const std::string& alias_name,
-            const std::string& target_type)
-    {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-        aliases_.emplace(std::pair<std::string, std::string>(alias_name, target_type));
-    }
+            const std::string& target_type);
 };
 
 } // namespace types
@@ -63,8 +63,21 @@ class IPFinder
         IPFinder();
         virtual ~IPFinder();
 
+        /**
+         * Get the addresses of all running interfaces.
+         * Results come from a process-wide table that, on Linux, is only rebuilt when the kernel
+         * notifies a change on the interfaces or their addresses.
+         * @param[out] vec_name Vector where the addresses are appended.
+         * @param return_loopback Whether loopback addresses should be returned.
+         */
         RTPS_DllAPI static bool getIPs(std::vector<info_IP>* vec_name, bool return_loopback = false);
 
+        /**
+         * Get the version of the interface table returned by getIPs.
+         * It changes every time the table is rebuilt, so callers can detect changes on the interfaces.
+         */
+        RTPS_DllAPI static uint32_t getIPsVersion();
+
         /**
          * Get the IP4Adresses in all interfaces.
          * @param[out] locators List of locators to be populated with the IP4 addresses.
@@ -93,6 +106,11 @@ class IPFinder
 
         RTPS_DllAPI static std::string getIPv4Address(const std::string &name);
         RTPS_DllAPI static std::string getIPv6Address(const std::string &name);
+
+    private:
+
+        //! Queries the operating system for all addresses of the running interfaces, loopback included.
+        static bool queryIPs(std::vector<info_IP>* vec_name);
 };
 
 }
@@ -0,0 +1,269 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GuidIndex.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_GUIDINDEX_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_GUIDINDEX_HPP_
+
+#include "ResourceLimitedContainerConfig.hpp"
+#include "../../rtps/common/Guid.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Open addressing hash table from GUID_t to a value, used to find matched endpoints without scanning their
+ * collections.
+ *
+ * It uses linear probing and keeps its load factor under one half. The table is preallocated for the initial number
+ * of elements of a \ref ResourceLimitedContainerConfig, and only grows when that number is exceeded.
+ *
+ * @tparam _Ty   Value type. Should be cheap to copy, like a pointer or an index.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <typename _Ty>
+class GuidIndex
+{
+public:
+
+    using value_type = _Ty;
+    using size_type = size_t;
+
+    /**
+     * Construct a GuidIndex.
+     *
+     * @param cfg   Resource limits of the indexed collection. Room for cfg.initial elements is allocated.
+     */
+    GuidIndex(
+            const ResourceLimitedContainerConfig& cfg = ResourceLimitedContainerConfig())
+        : size_(0)
+    {
+        if (cfg.initial > 0)
+        {
+            slots_.resize(table_size_for(cfg.initial));
+        }
+    }
+
+    /**
+     * Add an element.
+     *
+     * @param guid    Key of the element.
+     * @param value   Value of the element.
+     *
+     * @return false if an element with the same key already exists.
+     */
+    bool insert(
+            const fastrtps::rtps::GUID_t& guid,
+            const value_type& value)
+    {
+        if (find(guid) != nullptr)
+        {
+            return false;
+        }
+
+        if ((size_ + 1) * 2 > slots_.size())
+        {
+            rehash(table_size_for(size_ + 1));
+        }
+
+        place(guid, value);
+        ++size_;
+        return true;
+    }
+
+    /**
+     * Find an element.
+     *
+     * @param guid   Key of the element.
+     *
+     * @return pointer to the value of the element, nullptr if it does not exist.
+     */
+    value_type* find(
+            const fastrtps::rtps::GUID_t& guid)
+    {
+        size_type pos = find_slot(guid);
+        return pos < slots_.size() ? &slots_[pos].value : nullptr;
+    }
+
+    const value_type* find(
+            const fastrtps::rtps::GUID_t& guid) const
+    {
+        size_type pos = find_slot(guid);
+        return pos < slots_.size() ? &slots_[pos].value : nullptr;
+    }
+
+    /**
+     * Remove an element.
+     *
+     * @param guid   Key of the element.
+     *
+     * @return true if an element was removed, false otherwise.
+     */
+    bool erase(
+            const fastrtps::rtps::GUID_t& guid)
+    {
+        size_type hole = find_slot(guid);
+        if (hole == slots_.size())
+        {
+            return false;
+        }
+
+        // Entries after the removed one are moved back so probing does not need tombstones.
+        size_type mask = slots_.size() - 1;
+        for (size_type pos = (hole + 1) & mask; slots_[pos].used; pos = (pos + 1) & mask)
+        {
+            size_type home = hash(slots_[pos].guid) & mask;
+            if (((pos - home) & mask) >= ((pos - hole) & mask))
+            {
+                slots_[hole] = slots_[pos];
+                hole = pos;
+            }
+        }
+
+        slots_[hole].used = false;
+        --size_;
+        return true;
+    }
+
+    //! Remove all the elements, keeping the allocated table.
+    void clear()
+    {
+        for (Slot& slot : slots_)
+        {
+            slot.used = false;
+        }
+        size_ = 0;
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+private:
+
+    struct Slot
+    {
+        fastrtps::rtps::GUID_t guid;
+        value_type value;
+        bool used = false;
+    };
+
+    static size_type table_size_for(
+            size_type elements)
+    {
+        size_type table_size = 8;
+        while (table_size < elements * 2)
+        {
+            table_size *= 2;
+        }
+        return table_size;
+    }
+
+    static size_type hash(
+            const fastrtps::rtps::GUID_t& guid)
+    {
+        uint32_t words[4];
+        memcpy(words, guid.guidPrefix.value, 12);
+        memcpy(&words[3], guid.entityId.value, 4);
+
+        uint32_t h = words[0];
+        for (size_t i = 1; i < 4; ++i)
+        {
+            h = (h * 0x9E3779B1u) ^ words[i];
+        }
+
+        // Final mix of MurmurHash3, as endpoints of a participant only differ on the last word.
+        h ^= h >> 16;
+        h *= 0x85EBCA6Bu;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+    //! @return position of the slot holding the key, or the size of the table if it does not exist.
+    size_type find_slot(
+            const fastrtps::rtps::GUID_t& guid) const
+    {
+        if (size_ == 0)
+        {
+            return slots_.size();
+        }
+
+        size_type mask = slots_.size() - 1;
+        for (size_type pos = hash(guid) & mask; slots_[pos].used; pos = (pos + 1) & mask)
+        {
+            if (slots_[pos].guid == guid)
+            {
+                return pos;
+            }
+        }
+
+        return slots_.size();
+    }
+
+    void place(
+            const fastrtps::rtps::GUID_t& guid,
+            const value_type& value)
+    {
+        size_type mask = slots_.size() - 1;
+        size_type pos = hash(guid) & mask;
+        while (slots_[pos].used)
+        {
+            pos = (pos + 1) & mask;
+        }
+
+        slots_[pos].value = value;
+        slots_[pos].guid = guid;
+        slots_[pos].used = true;
+    }
+
+    void rehash(
+            size_type table_size)
+    {
+        std::vector<Slot> old_slots(table_size);
+        old_slots.swap(slots_);
+        for (const Slot& slot : old_slots)
+        {
+            if (slot.used)
+            {
+                place(slot.guid, slot.value);
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+
+    size_type size_;
+};
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_GUIDINDEX_HPP_ */
@@ -513,6 +513,16 @@ class XMLParser
         DisablePositiveACKsQosPolicy& disablePositiveAcks,
         uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLBatchQos(
+        tinyxml2::XMLElement* elem,
+        BatchQosPolicy& batch,
+        uint8_t ident);
+
+    RTPS_DllAPI static XMLP_ret getXMLThreadSettings(
+        tinyxml2::XMLElement* elem,
+        rtps::ThreadSettings& settings,
+        uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLguidPrefix(
         tinyxml2::XMLElement *elem,
         rtps::GuidPrefix_t &prefix,
@@ -69,6 +69,9 @@ extern const char* METADATA_LOGICAL_PORT;
 extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
 extern const char* CHECK_CRC;
+extern const char* RECEPTION_THREADS;
+extern const char* ACCEPT_THREAD;
+extern const char* KEEP_ALIVE_THREAD;
 
 extern const char* QOS_PROFILE;
 extern const char* APPLICATION;
@@ -97,6 +100,9 @@ extern const char* THROUGHPUT_CONT;
 extern const char* USER_TRANS;
 extern const char* USE_BUILTIN_TRANS;
 extern const char* PROPERTIES_POLICY;
+extern const char* TIMED_EVENTS_THREAD;
+extern const char* ASYNC_WRITER_THREAD;
+extern const char* FLOW_CONTROLLER_THREAD;
 extern const char* NAME;
 extern const char* REMOTE_LOCATORS;
 extern const char* MAX_UNICAST_LOCATORS;
@@ -130,6 +136,7 @@ extern const char* PROPAGATE;
 extern const char* PREALLOCATED;
 extern const char* PREALLOCATED_WITH_REALLOC;
 extern const char* DYNAMIC;
+extern const char* SLAB;
 extern const char* LOCATOR;
 extern const char* UDPv4_LOCATOR;
 extern const char* UDPv6_LOCATOR;
@@ -150,6 +157,8 @@ extern const char* INIT_HEARTB_DELAY;
 extern const char* HEARTB_PERIOD;
 extern const char* NACK_RESP_DELAY;
 extern const char* NACK_SUPRESSION;
+extern const char* ADAPTIVE_RELIABILITY;
+extern const char* MIN_HEARTB_PERIOD;
 extern const char* BY_NAME;
 extern const char* BY_VAL;
 extern const char* DURATION_INFINITY;
@@ -178,6 +187,9 @@ extern const char* TOPIC_DATA;
 extern const char* GROUP_DATA;
 extern const char* PUB_MODE;
 extern const char* DISABLE_POSITIVE_ACKS;
+extern const char* BATCH;
+extern const char* MAX_DATA_BYTES;
+extern const char* MAX_FLUSH_DELAY;
 
 extern const char* SYNCHRONOUS;
 extern const char* ASYNCHRONOUS;
@@ -249,6 +261,7 @@ extern const char* SIMPLE;
 extern const char* STATIC;
 extern const char* PUBWRITER_SUBREADER;
 extern const char* PUBREADER_SUBWRITER;
+extern const char* TOPIC_INTEREST_FILTER;
 extern const char* STATIC_ENDPOINT_XML;
 extern const char* READER_HIST_MEM_POLICY;
 extern const char* WRITER_HIST_MEM_POLICY;
@@ -339,6 +352,12 @@ extern const char* BASE_TYPE;
 extern const char* USE_DEFAULT;
 extern const char* CONSUMER;
 extern const char* CLASS;
+extern const char* THREAD_SETTINGS;
+
+// Thread settings
+extern const char* THREAD_SCHEDULING_POLICY;
+extern const char* THREAD_PRIORITY;
+extern const char* THREAD_AFFINITY;
 
 // Allocation config
 extern const char* INITIAL;
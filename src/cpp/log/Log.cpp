@@ -5,6 +5,7 @@
 #include <fastrtps/log/Log.h>
 #include <fastrtps/log/StdoutConsumer.h>
 #include <fastrtps/log/Colors.h>
+#include "../utils/Threading.h"
 #include <iostream>
 
 using namespace std;
@@ -53,6 +54,7 @@ void Log::Reset()
     mResources.mFilenames = false;
     mResources.mFunctions = true;
     mResources.mVerbosity = Log::Error;
+    mResources.mThreadSettings = rtps::ThreadSettings();
     mResources.mConsumers.clear();
     mResources.mConsumers.emplace_back(new StdoutConsumer);
 }
@@ -77,6 +79,13 @@ void Log::Flush()
 
 void Log::Run()
 {
+    rtps::ThreadSettings settings;
+    {
+        std::unique_lock<std::mutex> configGuard(mResources.mConfigMutex);
+        settings = mResources.mThreadSettings;
+    }
+    set_current_thread_settings("dds.log", settings);
+
     std::unique_lock<std::mutex> guard(mResources.mCvMutex);
     while (mResources.mLogging)
     {
@@ -108,6 +117,12 @@ void Log::Run()
     }
 }
 
+void Log::SetThreadSettings(const rtps::ThreadSettings& settings)
+{
+    std::unique_lock<std::mutex> configGuard(mResources.mConfigMutex);
+    mResources.mThreadSettings = settings;
+}
+
 void Log::ReportFilenames(bool report)
 {
     std::unique_lock<std::mutex> configGuard(mResources.mConfigMutex);
@@ -75,3 +75,8 @@ void Participant::assert_liveliness()
 {
     mp_impl->assert_liveliness();
 }
+
+bool Participant::get_statistics(ParticipantStatistics& stats) const
+{
+    return mp_impl->get_statistics(stats);
+}
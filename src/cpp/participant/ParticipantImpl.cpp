@@ -31,6 +31,7 @@
 #include <fastrtps/attributes/PublisherAttributes.h>
 #include "../publisher/PublisherImpl.h"
 #include <fastrtps/publisher/Publisher.h>
+#include <fastrtps/rtps/writer/RTPSWriter.h>
 
 #include <fastrtps/attributes/SubscriberAttributes.h>
 #include "../subscriber/SubscriberImpl.h"
@@ -60,6 +61,11 @@ ParticipantImpl::ParticipantImpl(
     , m_rtps_listener(this)
     {
         mp_participant->mp_impl = this;
+
+        if (m_att.listener_threads > 0)
+        {
+            listener_executor_.reset(new ListenerExecutor(m_att.listener_threads));
+        }
     }
 
 ParticipantImpl::~ParticipantImpl()
@@ -73,6 +79,8 @@ ParticipantImpl::~ParticipantImpl()
         this->removeSubscriber(m_subscribers.begin()->first);
     }
 
+    listener_executor_.reset();
+
     if(this->mp_rtpsParticipant != nullptr)
     {
         RTPSDomain::removeRTPSParticipant(this->mp_rtpsParticipant);
@@ -218,6 +226,21 @@ Publisher* ParticipantImpl::createPublisher(
         watt.disable_positive_acks = true;
         watt.keep_duration = att.qos.m_disablePositiveACKs.duration;
     }
+    if (att.topic.getTopicKind() == NO_KEY)
+    {
+        watt.max_instances = 1;
+    }
+    else if (att.topic.resourceLimitsQos.max_instances > 0)
+    {
+        watt.max_instances = static_cast<uint32_t>(att.topic.resourceLimitsQos.max_instances);
+    }
+    if (att.qos.m_batch.enabled)
+    {
+        watt.batching = true;
+        watt.batch_max_data_bytes = att.qos.m_batch.max_data_bytes;
+        watt.batch_max_samples = att.qos.m_batch.max_samples;
+        watt.batch_max_flush_delay = att.qos.m_batch.max_flush_delay;
+    }
 
     RTPSWriter* writer = RTPSDomain::createRTPSWriter(
                 this->mp_rtpsParticipant,
@@ -231,6 +254,10 @@ Publisher* ParticipantImpl::createPublisher(
         return nullptr;
     }
     pubimpl->mp_writer = writer;
+#if HAVE_SECURITY
+    pubimpl->content_filter_.payload_protected(writer->getAttributes().security_attributes().is_payload_protected);
+#endif
+    writer->reader_data_filter(&pubimpl->content_filter_);
     //SAVE THE PUBLISHER PAIR
     t_p_PublisherPair pubpair;
     pubpair.first = pub;
@@ -520,6 +547,11 @@ ResourceEvent& ParticipantImpl::get_resource_event() const
     return mp_rtpsParticipant->get_resource_event();
 }
 
+bool ParticipantImpl::get_statistics(ParticipantStatistics& stats) const
+{
+    return mp_rtpsParticipant->get_statistics(stats);
+}
+
 void ParticipantImpl::assert_liveliness()
 {
     if (mp_rtpsParticipant->wlp() != nullptr)
@@ -25,6 +25,10 @@
 #include <fastrtps/attributes/ParticipantAttributes.h>
 #include <fastrtps/rtps/reader/StatefulReader.h>
 
+#include "../utils/ListenerExecutor.h"
+
+#include <memory>
+
 namespace eprosima{
 namespace fastrtps{
 
@@ -160,11 +164,22 @@ class ParticipantImpl
 
     rtps::ResourceEvent& get_resource_event() const;
 
+    /**
+     * Get the executor calling the listeners of the subscribers.
+     * @return Pointer to the executor, or nullptr when listeners are called from the threads receiving the data.
+     */
+    ListenerExecutor* listener_executor() const
+    {
+        return listener_executor_.get();
+    }
+
     /**
      * @brief Asserts liveliness of manual by participant readers
      */
     void assert_liveliness();
 
+    bool get_statistics(rtps::ParticipantStatistics& stats) const;
+
     private:
     //!Participant Attributes
     ParticipantAttributes m_att;
@@ -180,6 +195,8 @@ class ParticipantImpl
     t_v_SubscriberPairs m_subscribers;
     //!TOpicDatType vector
     std::vector<TopicDataType*> m_types;
+    //!Executor calling the listeners of the subscribers
+    std::unique_ptr<ListenerExecutor> listener_executor_;
 
     bool getRegisteredType(const char* typeName, TopicDataType** type);
 
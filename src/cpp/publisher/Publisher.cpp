@@ -44,6 +44,16 @@ bool Publisher::write(void* Data, WriteParams &wparams) {
     return mp_impl->create_new_change_with_params(ALIVE, Data, wparams);
 }
 
+bool Publisher::loan_sample(void*& sample)
+{
+    return mp_impl->loan_sample(sample);
+}
+
+bool Publisher::discard_loan(void*& sample)
+{
+    return mp_impl->discard_loan(sample);
+}
+
 bool Publisher::dispose(void* Data)
 {
     logInfo(PUBLISHER,"Disposing of Data");
@@ -69,6 +79,11 @@ bool Publisher::removeAllChange(size_t* removed )
     return mp_impl->removeAllChange(removed);
 }
 
+void Publisher::flush()
+{
+    mp_impl->flush();
+}
+
 bool Publisher::wait_for_all_acked(const eprosima::fastrtps::Time_t& max_wait)
 {
     logInfo(PUBLISHER,"Waiting for all samples acknowledged");
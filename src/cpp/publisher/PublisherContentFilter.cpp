@@ -0,0 +1,174 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PublisherContentFilter.cpp
+ */
+
+#include "PublisherContentFilter.h"
+
+#include <fastrtps/TopicDataType.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+#include <fastrtps/log/Log.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+PublisherContentFilter::PublisherContentFilter(
+        TopicDataType* type)
+    : type_(type)
+    , payload_protected_(false)
+    , type_resolved_(false)
+    , sample_(nullptr)
+    , sample_change_(nullptr)
+    , sample_valid_(false)
+{
+}
+
+PublisherContentFilter::~PublisherContentFilter()
+{
+    if (sample_ != nullptr)
+    {
+        types::DynamicDataFactory::get_instance()->delete_data(sample_);
+    }
+}
+
+bool PublisherContentFilter::is_relevant(
+        const CacheChange_t& change,
+        const GUID_t& reader_guid) const
+{
+    if (filters_.empty() || change.kind != ALIVE)
+    {
+        return true;
+    }
+
+    auto filter = filters_.find(reader_guid);
+    if (filter == filters_.end())
+    {
+        return true;
+    }
+
+    // Samples that cannot be deserialized are not filtered.
+    types::DynamicData* data = sample(change);
+    return data == nullptr || filter->second->evaluate(data);
+}
+
+void PublisherContentFilter::reader_matched(
+        const ReaderProxyData& reader_data)
+{
+    const ContentFilterProperty_t& content_filter = reader_data.content_filter();
+    filters_.erase(reader_data.guid());
+
+    if (content_filter.empty())
+    {
+        return;
+    }
+
+    if (payload_protected_)
+    {
+        logWarning(PUBLISHER, "Content filter requested by " << reader_data.guid() <<
+                " cannot be evaluated on a protected payload. Every sample will be sent to it");
+        return;
+    }
+
+    if (content_filter.filter_class_name != c_DDSSQL_filter_class_name)
+    {
+        logWarning(PUBLISHER, "Unsupported filter class " << content_filter.filter_class_name << " requested by "
+                << reader_data.guid() << ". Every sample will be sent to it");
+        return;
+    }
+
+    if (!resolve_type())
+    {
+        return;
+    }
+
+    std::unique_ptr<types::ContentFilterExpression> expression(new types::ContentFilterExpression());
+    if (!expression->compile(content_filter.filter_expression, content_filter.expression_parameters, dynamic_type_))
+    {
+        logWarning(PUBLISHER, "Invalid filter expression '" << content_filter.filter_expression << "' requested by "
+                << reader_data.guid() << ". Every sample will be sent to it");
+        return;
+    }
+
+    filters_[reader_data.guid()] = std::move(expression);
+}
+
+void PublisherContentFilter::reader_unmatched(
+        const GUID_t& reader_guid)
+{
+    filters_.erase(reader_guid);
+}
+
+bool PublisherContentFilter::resolve_type()
+{
+    if (type_resolved_)
+    {
+        return dynamic_type_ != nullptr;
+    }
+
+    type_resolved_ = true;
+
+    types::DynamicPubSubType* dynamic_pubsub_type = dynamic_cast<types::DynamicPubSubType*>(type_);
+    if (dynamic_pubsub_type != nullptr)
+    {
+        dynamic_type_ = dynamic_pubsub_type->GetDynamicType();
+    }
+    else
+    {
+        types::TypeObjectFactory* factory = types::TypeObjectFactory::get_instance();
+        const types::TypeIdentifier* identifier = factory->get_type_identifier_trying_complete(type_->getName());
+        if (identifier != nullptr)
+        {
+            dynamic_type_ = factory->build_dynamic_type(type_->getName(), identifier,
+                    factory->get_type_object(identifier));
+        }
+    }
+
+    if (dynamic_type_ == nullptr)
+    {
+        logWarning(PUBLISHER, "Content filters on topics of type " << type_->getName() <<
+                " need a DynamicType or a registered TypeObject. Every sample will be sent to every reader");
+        return false;
+    }
+
+    dynamic_pubsub_type_.reset(new types::DynamicPubSubType(dynamic_type_));
+    return true;
+}
+
+types::DynamicData* PublisherContentFilter::sample(
+        const CacheChange_t& change) const
+{
+    if (sample_change_ == &change && sample_sequence_number_ == change.sequenceNumber)
+    {
+        return sample_valid_ ? sample_ : nullptr;
+    }
+
+    types::DynamicDataFactory* factory = types::DynamicDataFactory::get_instance();
+    if (sample_ != nullptr)
+    {
+        factory->delete_data(sample_);
+    }
+
+    sample_ = factory->create_data(dynamic_type_);
+    sample_change_ = &change;
+    sample_sequence_number_ = change.sequenceNumber;
+
+    // Deserialization only updates the encapsulation of the payload with the value it already has.
+    SerializedPayload_t* payload = const_cast<SerializedPayload_t*>(&change.serializedPayload);
+    sample_valid_ = sample_ != nullptr && dynamic_pubsub_type_->deserialize(payload, sample_);
+    return sample_valid_ ? sample_ : nullptr;
+}
@@ -0,0 +1,116 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PublisherContentFilter.h
+ */
+
+#ifndef _PUBLISHER_PUBLISHERCONTENTFILTER_H_
+#define _PUBLISHER_PUBLISHERCONTENTFILTER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/rtps/writer/IReaderDataFilter.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+
+#include "../types/ContentFilterExpression.h"
+
+#include <map>
+#include <memory>
+
+namespace eprosima {
+namespace fastrtps {
+
+class TopicDataType;
+
+/**
+ * Evaluates on the publisher the content filters announced by the matched subscribers.
+ *
+ * Filters are compiled against the DynamicType of the topic, which is taken from the registered type when it is a
+ * DynamicPubSubType, or built from its TypeObject otherwise. When no type information is available, or a filter
+ * cannot be compiled, every change is sent to the reader.
+ * Each change is deserialized once, no matter how many readers have a filter.
+ * Protected payloads are encrypted before the filters are evaluated, so readers of those topics are not filtered.
+ */
+class PublisherContentFilter : public rtps::IReaderDataFilter
+{
+    public:
+
+        PublisherContentFilter(
+                TopicDataType* type);
+
+        ~PublisherContentFilter();
+
+        bool is_relevant(
+                const rtps::CacheChange_t& change,
+                const rtps::GUID_t& reader_guid) const override;
+
+        //! @return true while any matched reader has a compiled filter.
+        bool is_active() const override
+        {
+            return !filters_.empty();
+        }
+
+        void reader_matched(
+                const rtps::ReaderProxyData& reader_data) override;
+
+        void reader_unmatched(
+                const rtps::GUID_t& reader_guid) override;
+
+        /**
+         * Set whether the payload of the changes is protected.
+         * Filters requested afterwards are not compiled, and every change is sent to their readers.
+         * @param payload_protected True if the writer encrypts the payload of its changes.
+         */
+        void payload_protected(
+                bool payload_protected)
+        {
+            payload_protected_ = payload_protected;
+        }
+
+    private:
+
+        //! @return true if the DynamicType of the topic is available.
+        bool resolve_type();
+
+        //! @return The deserialized sample of a change, or nullptr if it could not be deserialized.
+        types::DynamicData* sample(
+                const rtps::CacheChange_t& change) const;
+
+        TopicDataType* type_;
+
+        bool payload_protected_;
+
+        bool type_resolved_;
+
+        types::DynamicType_ptr dynamic_type_;
+
+        std::unique_ptr<types::DynamicPubSubType> dynamic_pubsub_type_;
+
+        std::map<rtps::GUID_t, std::unique_ptr<types::ContentFilterExpression>> filters_;
+
+        //! Last deserialized sample, reused while the same change is checked for every reader.
+        mutable types::DynamicData* sample_;
+
+        mutable const rtps::CacheChange_t* sample_change_;
+
+        mutable rtps::SequenceNumber_t sample_sequence_number_;
+
+        mutable bool sample_valid_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // _PUBLISHER_PUBLISHERCONTENTFILTER_H_
@@ -176,6 +176,7 @@ bool PublisherHistory::find_key(
         {
             if (vit->second.cache_changes.size() == 0)
             {
+                deadlines_.erase(std::make_pair(vit->second.next_deadline_us, vit->first));
                 keyed_changes_.erase(vit);
                 *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
                 return true;
@@ -294,12 +295,15 @@ bool PublisherHistory::set_next_deadline(
     }
     else if(mp_pubImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        deadlines_.erase(std::make_pair(vit->second.next_deadline_us, handle));
+        deadlines_.emplace(next_deadline_us, handle);
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -319,15 +323,13 @@ bool PublisherHistory::get_next_deadline(
 
     if(mp_pubImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                                    keyed_changes_.end(),
-                                    [](
-                                    const std::pair<InstanceHandle_t, KeyedChanges> &lhs,
-                                    const std::pair<InstanceHandle_t, KeyedChanges> &rhs)
-        { return lhs.second.next_deadline_us < rhs.second.next_deadline_us; });
-
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        if (deadlines_.empty())
+        {
+            return false;
+        }
+
+        handle = deadlines_.begin()->second;
+        next_deadline_us = deadlines_.begin()->first;
         return true;
     }
     else if (mp_pubImpl->getAttributes().topic.getTopicKind() == NO_KEY)
@@ -73,6 +73,8 @@ PublisherImpl::PublisherImpl(
     , deadline_duration_us_(m_att.qos.m_deadline.period.to_ns() * 1e-3)
     , timer_owner_()
     , deadline_missed_status_()
+    , content_filter_(pdatatype)
+    , key_hash_cache_(pdatatype)
     , lifespan_duration_us_(m_att.qos.m_lifespan.duration.to_ns() * 1e-3)
 {
     deadline_timer_ = new TimedEvent(mp_participant->get_resource_event(),
@@ -110,10 +112,105 @@ PublisherImpl::~PublisherImpl()
         logInfo(PUBLISHER, this->getGuid().entityId << " in topic: " << this->m_att.topic.topicName);
     }
 
+    for (auto& loan : loans_)
+    {
+        if (loan.second != nullptr)
+        {
+            m_history.release_Cache(loan.second);
+        }
+        else
+        {
+            mp_type->deleteData(loan.first);
+        }
+    }
+    loans_.clear();
+
     RTPSDomain::removeRTPSWriter(mp_writer);
     delete(this->mp_userPublisher);
 }
 
+bool PublisherImpl::loan_sample(void*& sample)
+{
+    sample = nullptr;
+
+    if (mp_type->is_plain() && mp_type->m_typeSize > SerializedPayload_t::representation_header_size)
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_writer->getMutex());
+        CacheChange_t* ch = nullptr;
+        if (!m_history.reserve_Cache(&ch, mp_type->m_typeSize))
+        {
+            logWarning(PUBLISHER, "Cannot loan a sample, no change available on the history");
+            return false;
+        }
+
+        // The sample is placed just after the encapsulation header, as the serialization would do.
+        octet* payload_sample = ch->serializedPayload.data + SerializedPayload_t::representation_header_size;
+        if (reinterpret_cast<uintptr_t>(payload_sample) % mp_type->plain_alignment() == 0)
+        {
+            ch->serializedPayload.encapsulation = DEFAULT_ENDIAN == LITTLEEND ? CDR_LE : CDR_BE;
+            ch->serializedPayload.data[0] = 0;
+            ch->serializedPayload.data[1] = static_cast<octet>(ch->serializedPayload.encapsulation);
+            ch->serializedPayload.data[2] = 0;
+            ch->serializedPayload.data[3] = 0;
+            ch->serializedPayload.length = mp_type->m_typeSize;
+
+            sample = payload_sample;
+            loans_[sample] = ch;
+            return true;
+        }
+
+        // The payload does not have the alignment of the type, so the sample is loaned as for non plain types.
+        m_history.release_Cache(ch);
+    }
+
+    sample = mp_type->createData();
+    if (sample == nullptr)
+    {
+        return false;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> guard(mp_writer->getMutex());
+    loans_[sample] = nullptr;
+    return true;
+}
+
+bool PublisherImpl::discard_loan(void*& sample)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_writer->getMutex());
+    CacheChange_t* ch = nullptr;
+    if (!consume_loan(sample, ch))
+    {
+        return false;
+    }
+
+    if (ch != nullptr)
+    {
+        m_history.release_Cache(ch);
+    }
+    else
+    {
+        mp_type->deleteData(sample);
+    }
+
+    sample = nullptr;
+    return true;
+}
+
+bool PublisherImpl::consume_loan(
+        void* sample,
+        CacheChange_t*& change)
+{
+    auto it = loans_.find(sample);
+    if (it == loans_.end())
+    {
+        return false;
+    }
+
+    change = it->second;
+    loans_.erase(it);
+    return true;
+}
+
 
 
 bool PublisherImpl::create_new_change(
@@ -147,16 +244,6 @@ bool PublisherImpl::create_new_change_with_params(
         }
     }
 
-    InstanceHandle_t handle;
-    if(m_att.topic.topicKind == WITH_KEY)
-    {
-        bool is_key_protected = false;
-#if HAVE_SECURITY
-        is_key_protected = mp_writer->getAttributes().security_attributes().is_key_protected;
-#endif
-        mp_type->getKey(data,&handle,is_key_protected);
-    }
-
     // Block lowlevel writer
     auto max_blocking_time = std::chrono::steady_clock::now() +
         std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
@@ -164,10 +251,55 @@ bool PublisherImpl::create_new_change_with_params(
 
     if(lock.try_lock_until(max_blocking_time))
     {
-        CacheChange_t* ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+        InstanceHandle_t handle;
+        if(m_att.topic.topicKind == WITH_KEY)
+        {
+            bool is_key_protected = false;
+#if HAVE_SECURITY
+            is_key_protected = mp_writer->getAttributes().security_attributes().is_key_protected;
+#endif
+            key_hash_cache_.get_key(data, handle, is_key_protected);
+        }
+
+        // Loaned samples of non plain types are serialized as usual and released when leaving.
+        struct LoanDeleter
+        {
+            TopicDataType* type;
+            void* sample;
+
+            ~LoanDeleter()
+            {
+                if (sample != nullptr)
+                {
+                    type->deleteData(sample);
+                }
+            }
+        };
+        LoanDeleter deleter{mp_type, nullptr};
+
+        CacheChange_t* ch = nullptr;
+        CacheChange_t* loaned_change = nullptr;
+        bool loaned = !loans_.empty() && consume_loan(data, loaned_change);
+        if (loaned_change != nullptr)
+        {
+            // Loaned samples of plain types are already on the payload of the change.
+            ch = loaned_change;
+            ch->kind = changeKind;
+            ch->instanceHandle = handle;
+            ch->writerGUID = mp_writer->getGuid();
+        }
+        else
+        {
+            if (loaned)
+            {
+                deleter.sample = data;
+            }
+            ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+        }
+
         if(ch != nullptr)
         {
-            if(changeKind == ALIVE)
+            if(changeKind == ALIVE && loaned_change == nullptr)
             {
                 //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
                 if(!mp_type->serialize(data, &ch->serializedPayload))
@@ -207,17 +339,7 @@ bool PublisherImpl::create_new_change_with_params(
             // If it is big data, fragment it.
             if(ch->serializedPayload.length > final_high_mark_for_frag)
             {
-                // Check ASYNCHRONOUS_PUBLISH_MODE is being used, but it is an error case.
-                if( m_att.qos.m_publishMode.kind != ASYNCHRONOUS_PUBLISH_MODE)
-                {
-                    logError(PUBLISHER, "Data cannot be sent. It's serialized size is " <<
-                            ch->serializedPayload.length << "' which exceeds the maximum payload size of '" <<
-                            final_high_mark_for_frag << "' and therefore ASYNCHRONOUS_PUBLISH_MODE must be used.");
-                    m_history.release_Cache(ch);
-                    return false;
-                }
-
-                /// Fragment the data.
+                /// Fragment the data. Synchronous writers send every fragment before returning.
                 // Set the fragment size to the cachechange.
                 // Note: high_mark will always be a value that can be casted to uint16_t)
                 ch->setFragmentSize((uint16_t)final_high_mark_for_frag);
@@ -252,9 +374,14 @@ bool PublisherImpl::create_new_change_with_params(
 
             if (m_att.qos.m_lifespan.duration != c_TimeInfinite)
             {
-                lifespan_duration_us_ = std::chrono::duration<double, std::ratio<1, 1000000>>(m_att.qos.m_lifespan.duration.to_ns() * 1e-3);
-                lifespan_timer_->update_interval_millisec(m_att.qos.m_lifespan.duration.to_ns() * 1e-6);
-                lifespan_timer_->restart_timer();
+                // Only the earliest change arms the timer. Otherwise it is already armed for an older change,
+                // and lifespan_expired will re-arm it for the following ones.
+                CacheChange_t* earliest_change;
+                if (m_history.get_earliest_change(&earliest_change) && earliest_change == ch)
+                {
+                    lifespan_timer_->update_interval_millisec(m_att.qos.m_lifespan.duration.to_ns() * 1e-6);
+                    lifespan_timer_->restart_timer();
+                }
             }
 
             return true;
@@ -425,8 +552,15 @@ void PublisherImpl::PublisherWriterListener::on_liveliness_lost(
     }
 }
 
+void PublisherImpl::flush()
+{
+    mp_writer->flush();
+}
+
 bool PublisherImpl::wait_for_all_acked(const eprosima::fastrtps::Time_t& max_wait)
 {
+    // Samples waiting in a batch would never be acknowledged
+    mp_writer->flush();
     return mp_writer->wait_for_all_acked(max_wait);
 }
 
@@ -501,22 +635,23 @@ bool PublisherImpl::lifespan_expired()
         return true;
     }
 
-    // The earliest change has expired
-    m_history.remove_change_pub(earliest_change);
-
-    // Set the timer for the next change if there is one
-    if (!m_history.get_earliest_change(&earliest_change))
+    // Remove every expired change, as the timer may have fired after several of them expired
+    do
     {
-        return false;
+        m_history.remove_change_pub(earliest_change);
+
+        // Set the timer for the next change if there is one
+        if (!m_history.get_earliest_change(&earliest_change))
+        {
+            return false;
+        }
+
+        source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
     }
+    while (now - source_timestamp >= lifespan_duration_us_);
 
     // Calculate when the next change is due to expire and restart
-    source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
-    now = system_clock::now();
     auto interval = source_timestamp - now + lifespan_duration_us_;
-
-    assert(interval.count() > 0);
-
     lifespan_timer_->update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
     return true;
 }
@@ -32,6 +32,11 @@
 #include <fastrtps/rtps/writer/WriterListener.h>
 #include <fastrtps/qos/DeadlineMissedStatus.h>
 
+#include "PublisherContentFilter.h"
+#include "../utils/KeyHashCache.h"
+
+#include <map>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps
@@ -90,6 +95,20 @@ class PublisherImpl
         void* Data,
         rtps::WriteParams& wparams);
 
+    /**
+     * Loans a sample. See Publisher::loan_sample.
+     * @param[out] sample Pointer to the loaned sample.
+     * @return true when a sample could be loaned.
+     */
+    bool loan_sample(void*& sample);
+
+    /**
+     * Gives back a loaned sample without writing it.
+     * @param[in,out] sample Pointer to the loaned sample.
+     * @return true when the sample was loaned by this publisher.
+     */
+    bool discard_loan(void*& sample);
+
     /**
      * Removes the cache change with the minimum sequence number
      * @return True if correct.
@@ -127,6 +146,8 @@ class PublisherImpl
      */
     TopicDataType* getType() {return mp_type;};
 
+    void flush();
+
     bool wait_for_all_acked(const Time_t& max_wait);
 
     /**
@@ -192,11 +213,30 @@ class PublisherImpl
     //! The offered deadline missed status
     OfferedDeadlineMissedStatus deadline_missed_status_;
 
+    //! Loaned samples. Samples of plain types point to the payload of the mapped change, others map to nullptr.
+    std::map<void*, rtps::CacheChange_t*> loans_;
+
+    //! Content filters of the matched subscribers, evaluated by the writer
+    PublisherContentFilter content_filter_;
+
+    //! Instance handles of the last written keys. Protected by the writer mutex.
+    KeyHashCache key_hash_cache_;
+
     //! A timed callback to remove expired samples for lifespan QoS
     rtps::TimedEvent* lifespan_timer_;
     //! The lifespan duration, in microseconds
     std::chrono::duration<double, std::ratio<1, 1000000>> lifespan_duration_us_;
 
+    /**
+     * Takes a loaned sample out of the loans.
+     * @param sample Pointer to the sample.
+     * @param[out] change Change holding the sample, nullptr for samples of non plain types.
+     * @return true if the sample was loaned. Writer mutex should be locked.
+     */
+    bool consume_loan(
+            void* sample,
+            rtps::CacheChange_t*& change);
+
     /**
      * @brief A method called when an instance misses the deadline
      */
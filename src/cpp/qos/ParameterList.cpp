@@ -629,8 +629,32 @@ bool ParameterList::readParameterListfromCDRMsg(CDRMessage_t& msg, std::function
                     {
                         return false;
                     }
-                    msg.pos += plength;
+
+                    uint32_t pos_ref = msg.pos;
+                    ParameterContentFilterProperty_t p(pid, plength);
+                    valid &= CDRMessage::readString(&msg, &p.filter.content_filtered_topic_name);
+                    valid &= CDRMessage::readString(&msg, &p.filter.related_topic_name);
+                    valid &= CDRMessage::readString(&msg, &p.filter.filter_class_name);
+                    valid &= CDRMessage::readString(&msg, &p.filter.filter_expression);
+                    uint32_t num_parameters = 0;
+                    valid &= CDRMessage::readUInt32(&msg, &num_parameters);
+                    for (uint32_t n_param = 0; valid && n_param < num_parameters && msg.pos < pos_ref + plength;
+                            ++n_param)
+                    {
+                        std::string parameter;
+                        valid &= CDRMessage::readString(&msg, &parameter);
+                        p.filter.expression_parameters.push_back(parameter);
+                    }
+
+                    // Malformed filters are ignored, as the reader would get every sample anyway.
+                    bool well_formed = valid && msg.pos <= pos_ref + plength &&
+                        p.filter.expression_parameters.size() == num_parameters;
+                    msg.pos = pos_ref + plength;
                     qos_size += plength;
+                    if (well_formed)
+                    {
+                        if(!processor(&p)) return false;
+                    }
                     break;
                 }
                 case PID_PARTICIPANT_ENTITYID:
@@ -677,6 +701,27 @@ bool ParameterList::readParameterListfromCDRMsg(CDRMessage_t& msg, std::function
                     }
                 }
 
+                case PID_TOPIC_INTEREST:
+                {
+                    if (plength == TopicInterestFilter::size)
+                    {
+                        ParameterTopicInterest_t p(pid, plength);
+                        valid &= CDRMessage::readData(&msg, p.filter.data(), TopicInterestFilter::size);
+                        p.filter.activate();
+                        IF_VALID_CALL
+                    }
+                    else if (plength > msg.length - msg.pos)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        msg.pos += plength;
+                        qos_size += plength;
+                        break;
+                    }
+                }
+
                 case PID_DATA_REPRESENTATION:
                 {
                     DataRepresentationQosPolicy p;
@@ -202,6 +202,38 @@ bool ParameterPropertyList_t::addToCDRMessage(CDRMessage_t*msg)
     return valid;
 }
 
+bool ParameterTopicInterest_t::addToCDRMessage(CDRMessage_t*msg)
+{
+    bool valid = CDRMessage::addUInt16(msg, this->Pid);
+    this->length = (uint16_t)rtps::TopicInterestFilter::size;
+    valid &= CDRMessage::addUInt16(msg, this->length);
+    valid &= CDRMessage::addData(msg, filter.data(), rtps::TopicInterestFilter::size);
+    return valid;
+}
+
+bool ParameterContentFilterProperty_t::addToCDRMessage(CDRMessage_t*msg)
+{
+    bool valid = CDRMessage::addUInt16(msg, this->Pid);
+    uint16_t pos_str = (uint16_t)msg->pos;
+    valid &= CDRMessage::addUInt16(msg, this->length);
+    valid &= CDRMessage::addString(msg, filter.content_filtered_topic_name);
+    valid &= CDRMessage::addString(msg, filter.related_topic_name);
+    valid &= CDRMessage::addString(msg, filter.filter_class_name);
+    valid &= CDRMessage::addString(msg, filter.filter_expression);
+    valid &= CDRMessage::addUInt32(msg, (uint32_t)filter.expression_parameters.size());
+    for (const std::string& parameter : filter.expression_parameters)
+    {
+        valid &= CDRMessage::addString(msg, parameter);
+    }
+    uint16_t pos_param_end = (uint16_t)msg->pos;
+    this->length = pos_param_end-pos_str-2;
+    msg->pos = pos_str;
+    valid &= CDRMessage::addUInt16(msg, this->length);
+    msg->pos = pos_param_end;
+    msg->length-=2;
+    return valid;
+}
+
 bool ParameterSampleIdentity_t::addToCDRMessage(CDRMessage_t*msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -130,6 +130,9 @@ void WriterQos::setQos(const WriterQos& qos, bool first_time)
     {
         m_disablePositiveACKs = qos.m_disablePositiveACKs;
         m_disablePositiveACKs.hasChanged = true;
+
+        m_batch = qos.m_batch;
+        m_batch.hasChanged = true;
     }
 }
 
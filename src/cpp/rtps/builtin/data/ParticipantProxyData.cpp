@@ -77,6 +77,7 @@ ParticipantProxyData::ParticipantProxyData(const ParticipantProxyData& pdata)
     , isAlive(pdata.isAlive)
     , m_properties(pdata.m_properties)
     , m_userData(pdata.m_userData)
+    , m_topicInterest(pdata.m_topicInterest)
     , lease_duration_event(nullptr)
     , should_check_lease_duration(false)
 
@@ -183,6 +184,13 @@ bool ParticipantProxyData::writeToCDRMessage(CDRMessage_t* msg, bool write_encap
         if (!p.addToCDRMessage(msg)) return false;
     }
 
+    if(this->m_topicInterest.active())
+    {
+        ParameterTopicInterest_t p;
+        p.filter = m_topicInterest;
+        if (!p.addToCDRMessage(msg)) return false;
+    }
+
 #if HAVE_SECURITY
     if(!this->identity_token_.class_id().empty())
     {
@@ -325,6 +333,13 @@ bool ParticipantProxyData::readFromCDRMessage(CDRMessage_t* msg, bool use_encaps
                 this->m_userData = p->getDataVec();
                 break;
             }
+            case PID_TOPIC_INTEREST:
+            {
+                const ParameterTopicInterest_t* p = dynamic_cast<const ParameterTopicInterest_t*>(param);
+                assert(p != nullptr);
+                this->m_topicInterest = p->filter;
+                break;
+            }
             case PID_IDENTITY_TOKEN:
             {
 #if HAVE_SECURITY
@@ -399,6 +414,7 @@ void ParticipantProxyData::clear()
     m_properties.properties.clear();
     m_properties.length = 0;
     m_userData.clear();
+    m_topicInterest.clear();
 }
 
 void ParticipantProxyData::copy(const ParticipantProxyData& pdata)
@@ -417,6 +433,7 @@ void ParticipantProxyData::copy(const ParticipantProxyData& pdata)
     isAlive = pdata.isAlive;
     m_properties = pdata.m_properties;
     m_userData = pdata.m_userData;
+    m_topicInterest = pdata.m_topicInterest;
 
     // This method is only called when a new participant is discovered.The destination of the copy
     // will always be a new ParticipantProxyData or one from the pool, so there is no need for
@@ -438,6 +455,7 @@ bool ParticipantProxyData::updateData(ParticipantProxyData& pdata)
     m_properties = pdata.m_properties;
     m_leaseDuration = pdata.m_leaseDuration;
     m_userData = pdata.m_userData;
+    m_topicInterest = pdata.m_topicInterest;
     isAlive = true;
 #if HAVE_SECURITY
     identity_token_ = pdata.identity_token_;
@@ -70,6 +70,7 @@ ReaderProxyData::ReaderProxyData(const ReaderProxyData& readerInfo)
     , m_topicDiscoveryKind(readerInfo.m_topicDiscoveryKind)
     , m_type_id(readerInfo.m_type_id)
     , m_type(readerInfo.m_type)
+    , content_filter_(readerInfo.content_filter_)
 {
     m_qos.setQos(readerInfo.m_qos, true);
 }
@@ -95,6 +96,7 @@ ReaderProxyData& ReaderProxyData::operator=(const ReaderProxyData& readerInfo)
     m_topicDiscoveryKind = readerInfo.m_topicDiscoveryKind;
     m_type_id = readerInfo.m_type_id;
     m_type = readerInfo.m_type;
+    content_filter_ = readerInfo.content_filter_;
 
     return *this;
 }
@@ -180,7 +182,8 @@ bool ReaderProxyData::writeToCDRMessage(CDRMessage_t* msg, bool write_encapsulat
     {
         if (!m_qos.m_userData.addToCDRMessage(msg)) return false;
     }
-    if(m_qos.m_timeBasedFilter.sendAlways() || m_qos.m_timeBasedFilter.hasChanged)
+    if(m_qos.m_timeBasedFilter.sendAlways() || m_qos.m_timeBasedFilter.hasChanged ||
+            m_qos.m_timeBasedFilter.minimum_separation != c_TimeZero)
     {
         if (!m_qos.m_timeBasedFilter.addToCDRMessage(msg)) return false;
     }
@@ -208,10 +211,6 @@ bool ReaderProxyData::writeToCDRMessage(CDRMessage_t* msg, bool write_encapsulat
     {
         if (!m_qos.m_groupData.addToCDRMessage(msg)) return false;
     }
-    if(m_qos.m_timeBasedFilter.sendAlways() || m_qos.m_timeBasedFilter.hasChanged)
-    {
-        if (!m_qos.m_timeBasedFilter.addToCDRMessage(msg)) return false;
-    }
     if(m_qos.m_disablePositiveACKs.sendAlways() || m_qos.m_disablePositiveACKs.hasChanged)
     {
         if (!m_qos.m_disablePositiveACKs.addToCDRMessage(msg))
@@ -231,6 +230,12 @@ bool ReaderProxyData::writeToCDRMessage(CDRMessage_t* msg, bool write_encapsulat
             if (!m_type.addToCDRMessage(msg)) return false;
         }
     }
+    if (!content_filter_.empty())
+    {
+        ParameterContentFilterProperty_t p;
+        p.filter = content_filter_;
+        if (!p.addToCDRMessage(msg)) return false;
+    }
 #if HAVE_SECURITY
     if ((this->security_attributes_ != 0UL) || (this->plugin_security_attributes_ != 0UL))
     {
@@ -482,6 +487,14 @@ bool ReaderProxyData::readFromCDRMessage(
                 m_qos.m_disablePositiveACKs = *p;
                 break;
             }
+            case PID_CONTENT_FILTER_PROPERTY:
+            {
+                const ParameterContentFilterProperty_t* p =
+                    dynamic_cast<const ParameterContentFilterProperty_t*>(param);
+                assert(p != nullptr);
+                content_filter_ = p->filter;
+                break;
+            }
 #if HAVE_SECURITY
             case PID_ENDPOINT_SECURITY_INFO:
             {
@@ -537,6 +550,7 @@ void ReaderProxyData::clear()
     m_topicDiscoveryKind = NO_CHECK;
     m_type_id = TypeIdV1();
     m_type = TypeObjectV1();
+    content_filter_ = ContentFilterProperty_t();
 }
 
 bool ReaderProxyData::is_update_allowed(const ReaderProxyData& rdata) const
@@ -561,6 +575,7 @@ void ReaderProxyData::update(ReaderProxyData* rdata)
     m_qos.setQos(rdata->m_qos,false);
     m_isAlive = rdata->m_isAlive;
     m_expectsInlineQos = rdata->m_expectsInlineQos;
+    content_filter_ = rdata->content_filter_;
 }
 
 void ReaderProxyData::copy(ReaderProxyData* rdata)
@@ -578,6 +593,7 @@ void ReaderProxyData::copy(ReaderProxyData* rdata)
     m_isAlive = rdata->m_isAlive;
     m_topicKind = rdata->m_topicKind;
     m_topicDiscoveryKind = rdata->m_topicDiscoveryKind;
+    content_filter_ = rdata->content_filter_;
     if (m_topicDiscoveryKind != NO_CHECK)
     {
         m_type_id = rdata->m_type_id;
@@ -110,6 +110,7 @@ bool EDP::newLocalReaderProxyData(
         rpd->topicKind(att.getTopicKind());
         rpd->topicDiscoveryKind(att.getTopicDiscoveryKind());
         rpd->m_qos = rqos;
+        set_content_filter(*rpd, att);
         rpd->userDefinedId(reader->getAttributes().getUserDefinedID());
 #if HAVE_SECURITY
         if (mp_RTPSParticipant->is_secure())
@@ -186,6 +187,25 @@ bool EDP::newLocalReaderProxyData(
     return true;
 }
 
+void EDP::set_content_filter(
+        ReaderProxyData& rdata,
+        const TopicAttributes& att)
+{
+    rdata.content_filter(att.contentFilter);
+    if (!rdata.content_filter().empty())
+    {
+        ContentFilterProperty_t& filter = rdata.content_filter();
+        if (filter.related_topic_name.empty())
+        {
+            filter.related_topic_name = att.getTopicName().to_string();
+        }
+        if (filter.content_filtered_topic_name.empty())
+        {
+            filter.content_filtered_topic_name = filter.related_topic_name + "_filtered";
+        }
+    }
+}
+
 bool EDP::newLocalWriterProxyData(
     RTPSWriter* writer,
     const TopicAttributes& att,
@@ -307,9 +327,7 @@ bool EDP::updatedLocalReader(
     const TopicAttributes& att,
     const ReaderQos& rqos)
 {
-    (void)att;
-
-    auto init_fun = [this, reader, &rqos](
+    auto init_fun = [this, reader, &att, &rqos](
             ReaderProxyData* rdata,
             bool updating,
             const ParticipantProxyData& participant_data)
@@ -330,6 +348,7 @@ bool EDP::updatedLocalReader(
             rdata->set_announced_unicast_locators(reader->getAttributes().unicastLocatorList);
         }
         rdata->m_qos.setQos(rqos, false);
+        set_content_filter(*rdata, att);
         rdata->isAlive(true);
         rdata->m_expectsInlineQos = reader->expectsInlineQos();
         return true;
@@ -63,6 +63,7 @@ EDPSimple::EDPSimple(
     , temp_writer_proxy_data_(
         part->getRTPSParticipantAttributes().allocation.locators.max_unicast_locators,
         part->getRTPSParticipantAttributes().allocation.locators.max_multicast_locators)
+    , topic_interest_enabled_(false)
 {
 }
 
@@ -146,6 +147,36 @@ bool EDPSimple::initEDP(BuiltinAttributes& attributes)
     }
 #endif
 
+    // The PDP activates the filter of the local participant when topic interest filtering is requested
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_PDP->getMutex());
+        topic_interest_enabled_ = mp_PDP->getLocalParticipantProxyData()->m_topicInterest.active();
+    }
+
+    if(topic_interest_enabled_)
+    {
+        logInfo(RTPS_EDP, "Topic interest filtering enabled");
+
+        if(publications_writer_.first != nullptr)
+        {
+            publications_writer_.first->reader_data_filter(this);
+        }
+        if(subscriptions_writer_.first != nullptr)
+        {
+            subscriptions_writer_.first->reader_data_filter(this);
+        }
+#if HAVE_SECURITY
+        if(publications_secure_writer_.first != nullptr)
+        {
+            publications_secure_writer_.first->reader_data_filter(this);
+        }
+        if(subscriptions_secure_writer_.first != nullptr)
+        {
+            subscriptions_secure_writer_.first->reader_data_filter(this);
+        }
+#endif
+    }
+
     return true;
 }
 
@@ -459,6 +490,8 @@ bool EDPSimple::processLocalReaderProxyData(RTPSReader* local_reader, ReaderProx
     logInfo(RTPS_EDP,rdata->guid().entityId);
     (void)local_reader;
 
+    add_local_topic_interest(rdata->guid(), rdata->topicName());
+
     auto* writer = &subscriptions_writer_;
 
 #if HAVE_SECURITY
@@ -517,6 +550,8 @@ bool EDPSimple::processLocalWriterProxyData(RTPSWriter* local_writer, WriterProx
     logInfo(RTPS_EDP, wdata->guid().entityId);
     (void)local_writer;
 
+    add_local_topic_interest(wdata->guid(), wdata->topicName());
+
     auto* writer = &publications_writer_;
 
 #if HAVE_SECURITY
@@ -570,6 +605,8 @@ bool EDPSimple::removeLocalWriter(RTPSWriter* W)
 {
     logInfo(RTPS_EDP,W->getGuid().entityId);
 
+    remove_local_topic_interest(W->getGuid());
+
     auto* writer = &publications_writer_;
 
 #if HAVE_SECURITY
@@ -610,6 +647,8 @@ bool EDPSimple::removeLocalReader(RTPSReader* R)
 {
     logInfo(RTPS_EDP,R->getGuid().entityId);
 
+    remove_local_topic_interest(R->getGuid());
+
     auto* writer = &subscriptions_writer_;
 
 #if HAVE_SECURITY
@@ -648,6 +687,10 @@ bool EDPSimple::removeLocalReader(RTPSReader* R)
 void EDPSimple::assignRemoteEndpoints(const ParticipantProxyData& pdata)
 {
     logInfo(RTPS_EDP,"New DPD received, adding remote endpoints to our SimpleEDP endpoints");
+
+    // Must be known before matching, as it decides which changes are sent to the remote builtin readers
+    update_remote_topic_interest(pdata.m_guid.guidPrefix, pdata.m_topicInterest);
+
     const NetworkFactory& network = mp_RTPSParticipant->network_factory();
     uint32_t endp = pdata.m_availableBuiltinEndpoints;
     uint32_t auxendp = endp;
@@ -784,6 +827,12 @@ void EDPSimple::removeRemoteEndpoints(ParticipantProxyData* pdata)
 {
     logInfo(RTPS_EDP,"For RTPSParticipant: "<<pdata->m_guid);
 
+    if(topic_interest_enabled_)
+    {
+        std::lock_guard<std::mutex> guard(topic_interest_mutex_);
+        remote_topic_interest_.erase(GUID_t(pdata->m_guid.guidPrefix, c_EntityId_RTPSParticipant));
+    }
+
     GUID_t tmp_guid;
     tmp_guid.guidPrefix = pdata->m_guid.guidPrefix;
 
@@ -942,6 +991,200 @@ bool EDPSimple::areRemoteEndpointsMatched(const ParticipantProxyData* pdata)
     return true;
 }
 
+void EDPSimple::add_local_topic_interest(
+        const GUID_t& endpoint_guid,
+        const string_255& topic_name)
+{
+    if(!topic_interest_enabled_)
+    {
+        return;
+    }
+
+    uint64_t hash = TopicInterestFilter::topic_hash(topic_name.c_str());
+
+    {
+        std::lock_guard<std::mutex> guard(topic_interest_mutex_);
+        local_endpoint_topics_[endpoint_guid] = hash;
+        local_topic_interest_.add(hash);
+    }
+
+    bool changed = false;
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_PDP->getMutex());
+        changed = mp_PDP->getLocalParticipantProxyData()->m_topicInterest.add(hash);
+    }
+
+    if(changed)
+    {
+        logInfo(RTPS_EDP, "Announcing interest on topic " << topic_name.c_str());
+        mp_PDP->announceParticipantState(true);
+    }
+}
+
+void EDPSimple::remove_local_topic_interest(const GUID_t& endpoint_guid)
+{
+    if(topic_interest_enabled_)
+    {
+        // The topic is kept on the filter, as remote participants will not send again data already filtered out.
+        std::lock_guard<std::mutex> guard(topic_interest_mutex_);
+        local_endpoint_topics_.erase(endpoint_guid);
+    }
+}
+
+void EDPSimple::update_remote_topic_interest(
+        const GuidPrefix_t& participant_prefix,
+        const TopicInterestFilter& interest)
+{
+    if(!topic_interest_enabled_)
+    {
+        return;
+    }
+
+    GUID_t participant_guid(participant_prefix, c_EntityId_RTPSParticipant);
+    std::vector<GUID_t> newly_relevant;
+
+    {
+        std::lock_guard<std::mutex> guard(topic_interest_mutex_);
+        auto it = remote_topic_interest_.find(participant_guid);
+        if(it == remote_topic_interest_.end())
+        {
+            // Nothing has been filtered for this participant yet.
+            if(interest.active())
+            {
+                remote_topic_interest_.emplace(participant_guid, interest);
+            }
+            return;
+        }
+
+        if(it->second == interest)
+        {
+            return;
+        }
+
+        for(const auto& endpoint : local_endpoint_topics_)
+        {
+            if(!it->second.contains(endpoint.second) && interest.contains(endpoint.second))
+            {
+                newly_relevant.push_back(endpoint.first);
+            }
+        }
+
+        if(interest.active())
+        {
+            it->second = interest;
+        }
+        else
+        {
+            remote_topic_interest_.erase(it);
+        }
+    }
+
+    // Data already filtered out was announced to the remote readers as irrelevant, so it has to be written again.
+    for(const GUID_t& endpoint_guid : newly_relevant)
+    {
+        logInfo(RTPS_EDP, "Participant " << participant_prefix << " is now interested on " << endpoint_guid);
+
+        bool found = republish_local_endpoint(publications_writer_, endpoint_guid) ||
+            republish_local_endpoint(subscriptions_writer_, endpoint_guid);
+#if HAVE_SECURITY
+        found = found || republish_local_endpoint(publications_secure_writer_, endpoint_guid) ||
+            republish_local_endpoint(subscriptions_secure_writer_, endpoint_guid);
+#endif
+        if(!found)
+        {
+            logInfo(RTPS_EDP, "Data of local endpoint " << endpoint_guid << " not found");
+        }
+    }
+}
+
+bool EDPSimple::republish_local_endpoint(
+        t_p_StatefulWriter& writer,
+        const GUID_t& endpoint_guid)
+{
+    if(writer.first == nullptr)
+    {
+        return false;
+    }
+
+    InstanceHandle_t iH;
+    iH = endpoint_guid;
+    CacheChange_t* change = nullptr;
+
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(*writer.second->getMutex());
+        for(auto ch = writer.second->changesBegin(); ch != writer.second->changesEnd(); ++ch)
+        {
+            if((*ch)->instanceHandle == iH && (*ch)->kind == ALIVE)
+            {
+                uint32_t length = (*ch)->serializedPayload.length;
+                change = writer.first->new_change([length]() -> uint32_t {return length;}, ALIVE, iH);
+                if(change != nullptr)
+                {
+                    change->serializedPayload.copy(&(*ch)->serializedPayload);
+                    writer.second->remove_change(*ch);
+                }
+                break;
+            }
+        }
+    }
+
+    if(change == nullptr)
+    {
+        return false;
+    }
+
+    writer.second->add_change(change);
+    return true;
+}
+
+bool EDPSimple::is_relevant_remote_endpoint(
+        const GuidPrefix_t& participant_prefix,
+        const string_255& topic_name)
+{
+    if(!topic_interest_enabled_)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(topic_interest_mutex_);
+
+    // Participants without a filter send every endpoint only once, so their data is always kept.
+    if(remote_topic_interest_.find(GUID_t(participant_prefix, c_EntityId_RTPSParticipant)) ==
+            remote_topic_interest_.end())
+    {
+        return true;
+    }
+
+    return local_topic_interest_.contains(TopicInterestFilter::topic_hash(topic_name.c_str()));
+}
+
+bool EDPSimple::is_relevant(
+        const CacheChange_t& change,
+        const GUID_t& reader_guid) const
+{
+    // Disposals are always sent, so remote participants can remove what they already know.
+    if(change.kind != ALIVE)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(topic_interest_mutex_);
+
+    auto remote = remote_topic_interest_.find(GUID_t(reader_guid.guidPrefix, c_EntityId_RTPSParticipant));
+    if(remote == remote_topic_interest_.end())
+    {
+        return true;
+    }
+
+    auto local = local_endpoint_topics_.find(iHandle2GUID(change.instanceHandle));
+    if(local == local_endpoint_topics_.end())
+    {
+        return true;
+    }
+
+    return remote->second.contains(local->second);
+}
+
 #if HAVE_SECURITY
 bool EDPSimple::pairing_remote_writer_with_local_builtin_reader_after_security(const GUID_t& local_reader,
         const WriterProxyData& remote_writer_data)
@@ -60,6 +60,12 @@ void EDPBasePUBListener::add_writer_from_change(
             return;
         }
 
+        if (!edp->is_relevant_remote_endpoint(temp_writer_data_.guid().guidPrefix, temp_writer_data_.topicName()))
+        {
+            logInfo(RTPS_EDP, "Ignoring writer on topic " << temp_writer_data_.topicName().c_str() << ", not of interest");
+            return;
+        }
+
         //LOAD INFORMATION IN DESTINATION WRITER PROXY DATA
         auto copy_data_fun = [this, &network](
             WriterProxyData* data,
@@ -158,6 +164,12 @@ void EDPBaseSUBListener::add_reader_from_change(
             return;
         }
 
+        if (!edp->is_relevant_remote_endpoint(temp_reader_data_.guid().guidPrefix, temp_reader_data_.topicName()))
+        {
+            logInfo(RTPS_EDP, "Ignoring reader on topic " << temp_reader_data_.topicName().c_str() << ", not of interest");
+            return;
+        }
+
         auto copy_data_fun = [this, &network](
             ReaderProxyData* data,
             bool updating,
@@ -890,6 +890,10 @@ bool PDP::remove_remote_participant(
 #endif
 
         this->mp_PDPReaderHistory->getMutex()->lock();
+        if (mp_listener != nullptr)
+        {
+            mp_listener->forget_announcement(partGUID);
+        }
         for(std::vector<CacheChange_t*>::iterator it=this->mp_PDPReaderHistory->changesBegin();
                 it!=this->mp_PDPReaderHistory->changesEnd();++it)
         {
@@ -947,7 +951,7 @@ const BuiltinAttributes& PDP::builtin_attributes() const
     return mp_builtin->m_att;
 }
 
-void PDP::assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP)
+bool PDP::assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
     for(ParticipantProxyData* it : this->participant_proxies_)
@@ -962,9 +966,11 @@ void PDP::assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP)
                 it->lease_duration_event->cancel_timer();
                 it->lease_duration_event->restart_timer();
             }
-            break;
+            return true;
         }
     }
+
+    return false;
 }
 
 CDRMessage_t PDP::get_participant_proxy_data_serialized(Endianness_t endian)
@@ -33,6 +33,7 @@
 
 #include "../../../participant/RTPSParticipantImpl.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <fastrtps/log/Log.h>
@@ -41,6 +42,18 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+//! FNV-1a hash of a serialized announcement, mixed with its length.
+static uint64_t announcement_fingerprint(const SerializedPayload_t& payload)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint32_t i = 0; i < payload.length; ++i)
+    {
+        hash ^= payload.data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash ^ (static_cast<uint64_t>(payload.length) << 32);
+}
+
 PDPListener::PDPListener(PDP* parent)
     : parent_pdp_(parent)
     , temp_participant_data_(parent->getRTPSParticipant()->getRTPSParticipantAttributes().allocation)
@@ -79,7 +92,28 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
         
-        // Access to temp_participant_data_ is protected by reader lock
+        // Access to temp_participant_data_ and announcements_ is protected by reader lock
+
+        // Periodic announcements are usually identical to the last one received. In that case
+        // only the liveliness of the participant is refreshed.
+        const SerializedPayload_t& payload = change->serializedPayload;
+        uint64_t fingerprint = announcement_fingerprint(payload);
+        auto announcement_it = announcements_.find(guid);
+        if (announcement_it != announcements_.end() && announcement_it->second.fingerprint == fingerprint &&
+                announcement_it->second.payload.size() == payload.length &&
+                std::equal(payload.data, payload.data + payload.length, announcement_it->second.payload.begin()))
+        {
+            reader->getMutex().unlock();
+            bool known = parent_pdp_->assertRemoteParticipantLiveliness(guid.guidPrefix);
+            reader->getMutex().lock();
+
+            if (known)
+            {
+                logInfo(RTPS_PDP, "Unchanged announcement from " << guid);
+                parent_pdp_->mp_PDPReaderHistory->remove_change(change);
+                return;
+            }
+        }
 
         // Load information on temp_participant_data_
         CDRMessage_t msg(change->serializedPayload);
@@ -87,6 +121,9 @@ void PDPListener::onNewCacheChangeAdded(
         {
             // After correctly reading it
             change->instanceHandle = temp_participant_data_.m_key;
+            Announcement& announcement = announcements_[guid];
+            announcement.fingerprint = fingerprint;
+            announcement.payload.assign(payload.data, payload.data + payload.length);
 
             // At this point we can release reader lock.
             reader->getMutex().unlock();
@@ -122,8 +159,11 @@ void PDPListener::onNewCacheChangeAdded(
             {
                 pdata->updateData(temp_participant_data_);
                 pdata->isAlive = true;
+                TopicInterestFilter topic_interest = pdata->m_topicInterest;
                 lock.unlock();
 
+                parent_pdp_->mp_EDP->update_remote_topic_interest(guid.guidPrefix, topic_interest);
+
                 if(parent_pdp_->updateInfoMatchesEDP())
                 {
                     parent_pdp_->mp_EDP->assignRemoteEndpoints(*pdata);
@@ -146,10 +186,18 @@ void PDPListener::onNewCacheChangeAdded(
 
             // Take again the reader lock
             reader->getMutex().lock();
+
+            // Only announcements of known participants are kept, so they are forgotten when the participant is removed.
+            if (pdata == nullptr)
+            {
+                forget_announcement(guid);
+            }
         }
     }
     else
     {
+        forget_announcement(guid);
+
         if(parent_pdp_->remove_remote_participant(guid, ParticipantDiscoveryInfo::REMOVED_PARTICIPANT))
         {
             return; // all changes related with this participant have been removed from history by remove_remote_participant
@@ -86,6 +86,13 @@ void PDPSimple::initializeParticipantProxyData(ParticipantProxyData* participant
         participant_data->m_availableBuiltinEndpoints |= DISC_BUILTIN_ENDPOINT_SUBSCRIPTION_ANNOUNCER;
     }
 
+    // An active empty filter means no interest on any topic, until local endpoints are created.
+    if (getRTPSParticipant()->getAttributes().builtin.discovery_config.m_simpleEDP.use_topic_interest_filter &&
+            !getRTPSParticipant()->getAttributes().builtin.discovery_config.use_STATIC_EndpointDiscoveryProtocol)
+    {
+        participant_data->m_topicInterest.activate();
+    }
+
 #if HAVE_SECURITY
     if (getRTPSParticipant()->getAttributes().builtin.discovery_config.m_simpleEDP.enable_builtin_secure_publications_writer_and_subscriptions_reader)
     {
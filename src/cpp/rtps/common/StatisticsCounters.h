@@ -0,0 +1,187 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsCounters.h
+ */
+#ifndef _RTPS_COMMON_STATISTICSCOUNTERS_H_
+#define _RTPS_COMMON_STATISTICSCOUNTERS_H_
+
+#include <fastrtps/rtps/common/Statistics.h>
+
+#include <atomic>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Add a value to a statistics counter. Counters are only read for reporting, so no ordering is needed.
+inline void statistics_add(
+        std::atomic<uint64_t>& counter,
+        uint64_t value = 1)
+{
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+/**
+ * Lock-free base 2 logarithmic histogram, see HistogramData.
+ */
+class StatisticsHistogram
+{
+    public:
+
+        StatisticsHistogram()
+            : count_(0)
+            , sum_(0)
+            , max_(0)
+        {
+            for (std::atomic<uint64_t>& bucket : buckets_)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        void record(
+                uint64_t value)
+        {
+            uint32_t bucket = 0;
+            uint64_t v = value;
+            while (v != 0 && bucket < HistogramData::num_buckets - 1)
+            {
+                v >>= 1;
+                ++bucket;
+            }
+
+            statistics_add(buckets_[bucket]);
+            statistics_add(count_);
+            statistics_add(sum_, value);
+
+            uint64_t current_max = max_.load(std::memory_order_relaxed);
+            while (value > current_max &&
+                    !max_.compare_exchange_weak(current_max, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void fill(
+                HistogramData& data) const
+        {
+            for (uint32_t i = 0; i < HistogramData::num_buckets; ++i)
+            {
+                data.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            }
+            data.count = count_.load(std::memory_order_relaxed);
+            data.sum = sum_.load(std::memory_order_relaxed);
+            data.max = max_.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        std::atomic<uint64_t> buckets_[HistogramData::num_buckets];
+
+        std::atomic<uint64_t> count_;
+
+        std::atomic<uint64_t> sum_;
+
+        std::atomic<uint64_t> max_;
+};
+
+/**
+ * Counters updated by an endpoint when statistics are enabled on its participant.
+ * The same structure is used by readers and writers, each one updating only the counters of its role.
+ */
+struct EndpointStatisticsCounters
+{
+    EndpointStatisticsCounters()
+        : data_sent(0)
+        , data_frags_sent(0)
+        , bytes_sent(0)
+        , heartbeats_sent(0)
+        , gaps_sent(0)
+        , acknacks_sent(0)
+        , nackfrags_sent(0)
+        , acknacks_received(0)
+        , nackfrags_received(0)
+        , samples_resent(0)
+        , samples_received(0)
+        , bytes_received(0)
+        , fragments_reassembled(0)
+        , heartbeats_received(0)
+        , gaps_received(0)
+        , pool_exhausted(0)
+    {
+    }
+
+    void fill(
+            WriterStatistics& stats) const
+    {
+        stats.data_sent = data_sent.load(std::memory_order_relaxed);
+        stats.data_frags_sent = data_frags_sent.load(std::memory_order_relaxed);
+        stats.bytes_sent = bytes_sent.load(std::memory_order_relaxed);
+        stats.heartbeats_sent = heartbeats_sent.load(std::memory_order_relaxed);
+        stats.gaps_sent = gaps_sent.load(std::memory_order_relaxed);
+        stats.acknacks_received = acknacks_received.load(std::memory_order_relaxed);
+        stats.nackfrags_received = nackfrags_received.load(std::memory_order_relaxed);
+        stats.samples_resent = samples_resent.load(std::memory_order_relaxed);
+        stats.pool_exhausted = pool_exhausted.load(std::memory_order_relaxed);
+        message_sizes.fill(stats.message_sizes);
+    }
+
+    void fill(
+            ReaderStatistics& stats) const
+    {
+        stats.samples_received = samples_received.load(std::memory_order_relaxed);
+        stats.bytes_received = bytes_received.load(std::memory_order_relaxed);
+        stats.fragments_reassembled = fragments_reassembled.load(std::memory_order_relaxed);
+        stats.heartbeats_received = heartbeats_received.load(std::memory_order_relaxed);
+        stats.gaps_received = gaps_received.load(std::memory_order_relaxed);
+        stats.acknacks_sent = acknacks_sent.load(std::memory_order_relaxed);
+        stats.nackfrags_sent = nackfrags_sent.load(std::memory_order_relaxed);
+        stats.pool_exhausted = pool_exhausted.load(std::memory_order_relaxed);
+        message_sizes.fill(stats.message_sizes);
+        reception_latency_us.fill(stats.reception_latency_us);
+    }
+
+    // Outgoing submessages, updated by RTPSMessageGroup.
+    std::atomic<uint64_t> data_sent;
+    std::atomic<uint64_t> data_frags_sent;
+    std::atomic<uint64_t> bytes_sent;
+    std::atomic<uint64_t> heartbeats_sent;
+    std::atomic<uint64_t> gaps_sent;
+    std::atomic<uint64_t> acknacks_sent;
+    std::atomic<uint64_t> nackfrags_sent;
+    StatisticsHistogram message_sizes;
+
+    // Writer side.
+    std::atomic<uint64_t> acknacks_received;
+    std::atomic<uint64_t> nackfrags_received;
+    std::atomic<uint64_t> samples_resent;
+
+    // Reader side.
+    std::atomic<uint64_t> samples_received;
+    std::atomic<uint64_t> bytes_received;
+    std::atomic<uint64_t> fragments_reassembled;
+    std::atomic<uint64_t> heartbeats_received;
+    std::atomic<uint64_t> gaps_received;
+    StatisticsHistogram reception_latency_us;
+
+    // History.
+    std::atomic<uint64_t> pool_exhausted;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_COMMON_STATISTICSCOUNTERS_H_
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "FlowController.h"
+#include "../../utils/Threading.h"
 #include <thread>
 
 using namespace eprosima::fastrtps::rtps;
@@ -20,6 +21,7 @@ using namespace eprosima::fastrtps::rtps;
 std::vector<FlowController*> FlowController::ListeningControllers;
 std::recursive_mutex FlowController::FlowControllerMutex;
 std::unique_ptr<std::thread> FlowController::ControllerThread;
+ThreadSettings FlowController::ControllerThreadSettings;
 std::unique_ptr<asio::io_service> FlowController::ControllerService;
 
 FlowController::FlowController()
@@ -41,6 +43,12 @@ void FlowController::NotifyControllersChangeSent(CacheChange_t* change)
       filter->NotifyChangeSent(change);
 }
 
+void FlowController::SetThreadSettings(const ThreadSettings& settings)
+{
+   std::unique_lock<std::recursive_mutex> scopedLock(FlowControllerMutex);
+   ControllerThreadSettings = settings;
+}
+
 void FlowController::RegisterAsListeningController()
 {
    std::unique_lock<std::recursive_mutex> scopedLock(FlowControllerMutex);
@@ -48,8 +56,10 @@ void FlowController::RegisterAsListeningController()
 
    if (!ControllerThread)
    {
-       auto ioServiceFunction = [&]()
+       ThreadSettings settings = ControllerThreadSettings;
+       auto ioServiceFunction = [settings]()
        {
+           eprosima::fastrtps::set_current_thread_settings("dds.flowc", settings);
            asio::io_service::work work(*ControllerService);
            ControllerService->run();
        };
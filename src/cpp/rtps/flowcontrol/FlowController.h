@@ -16,6 +16,7 @@
 #define FLOW_CONTROLLER_H
 
 #include <fastrtps/rtps/common/CacheChange.h>
+#include <fastrtps/rtps/attributes/ThreadSettings.hpp>
 #include "../writer/RTPSWriterCollector.h"
 
 #include <vector>
@@ -44,6 +45,9 @@ class FlowController
         //! Called when a change is finally dispatched.
         static void NotifyControllersChangeSent(CacheChange_t*);
 
+        //! Sets the settings of the controller thread, shared by all the controllers. Used when it is next started.
+        static void SetThreadSettings(const ThreadSettings& settings);
+
         //! Controller operator. Transforms the vector of changes in place.
         virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend) = 0;
         virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend) = 0;
@@ -60,6 +64,7 @@ class FlowController
 
         static std::vector<FlowController*> ListeningControllers;
         static std::unique_ptr<std::thread> ControllerThread;
+        static ThreadSettings ControllerThreadSettings;
 
         // No copy, assignment or move! Controllers are accessed by reference
         // from several places.
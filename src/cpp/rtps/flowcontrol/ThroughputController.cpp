@@ -47,9 +47,9 @@ void ThroughputController::operator()(RTPSWriterCollector<ReaderLocator*>& chang
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
 
-    auto it = changesToSend.items().begin();
+    auto it = changesToSend.begin();
 
-    while(it != changesToSend.items().end())
+    while(it != changesToSend.end())
     {
         if(!process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber))
             break;
@@ -57,16 +57,16 @@ void ThroughputController::operator()(RTPSWriterCollector<ReaderLocator*>& chang
         ++it;
     }
 
-    changesToSend.items().erase(it, changesToSend.items().end());
+    changesToSend.erase(it, changesToSend.end());
 }
 
 void ThroughputController::operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend)
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
 
-    auto it = changesToSend.items().begin();
+    auto it = changesToSend.begin();
 
-    while(it != changesToSend.items().end())
+    while(it != changesToSend.end())
     {
         if(!process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber))
             break;
@@ -74,7 +74,7 @@ void ThroughputController::operator()(RTPSWriterCollector<ReaderProxy*>& changes
         ++it;
     }
 
-    changesToSend.items().erase(it, changesToSend.items().end());
+    changesToSend.erase(it, changesToSend.end());
 }
 
 
@@ -24,12 +24,42 @@
 #include <mutex>
 
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+//!Smallest slab block is 64 bytes.
+static const uint32_t slab_min_class_shift = 6;
+//!Largest slab block is 2 GiB.
+static const uint32_t slab_max_class_shift = 31;
+//!Blocks in the first arena of a size class. Following arenas double it.
+static const uint32_t slab_initial_arena_blocks = 4;
+//!Arenas stop growing once they reach this size, which is also the size of a huge page.
+static const size_t slab_max_arena_size = 2 * 1024 * 1024;
+
+/*!
+ * CacheChange used on SLAB_MEMORY_MODE. It remembers the block its payload points to,
+ * so a payload replaced by someone else is never returned to the slabs.
+ */
+struct SlabCacheChange : public CacheChange_t
+{
+    SlabCacheChange()
+        : CacheChange_t(0u)
+        , block(nullptr)
+    {
+    }
+
+    octet* block;
+};
+
 
 CacheChangePool::~CacheChangePool()
 {
@@ -37,7 +67,26 @@ CacheChangePool::~CacheChangePool()
     //Deletion process does not depend on the memory management policy
     for(std::vector<CacheChange_t*>::iterator it = m_allCaches.begin();it!=m_allCaches.end();++it)
     {
-        delete(*it);
+        if(memoryMode == SLAB_MEMORY_MODE)
+        {
+            // Slab blocks are owned by the arenas, not by the payload.
+            SlabCacheChange* slab_change = static_cast<SlabCacheChange*>(*it);
+            if(slab_change->serializedPayload.data == slab_change->block)
+            {
+                slab_change->serializedPayload.data = nullptr;
+                slab_change->serializedPayload.max_size = 0;
+            }
+            delete(slab_change);
+        }
+        else
+        {
+            delete(*it);
+        }
+    }
+
+    for(void* arena : m_arenas)
+    {
+        free(arena);
     }
 }
 
@@ -76,6 +125,11 @@ CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32
         case DYNAMIC_RESERVE_MEMORY_MODE:
             logInfo(RTPS_UTILS,"Dynamic Mode is active, CacheChanges are allocated on request");
             break;
+        case SLAB_MEMORY_MODE:
+            logInfo(RTPS_UTILS,"Slab Mode is active, preallocating pool_size CacheChanges. Payloads are taken from size classes");
+            m_sizeClasses.resize(slab_max_class_shift - slab_min_class_shift + 1);
+            allocateGroup(pool_size);
+            break;
     }
 }
 
@@ -141,6 +195,32 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
             *chan = allocateSingle(dataSize); //Allocates a single, empty CacheChange. Allocated on Copy
             if(*chan == nullptr) return false;
             break;
+
+        case SLAB_MEMORY_MODE:
+            {
+                if(m_freeCaches.empty())
+                {
+                    if (!allocateGroup((uint16_t)(ceil((float)m_pool_size / 10) + 10)))
+                    {
+                        return false;
+                    }
+                }
+
+                uint32_t block_size = 0;
+                octet* block = allocateBlock(dataSize, block_size);
+                if(block == nullptr)
+                {
+                    return false;
+                }
+
+                SlabCacheChange* slab_change = static_cast<SlabCacheChange*>(m_freeCaches.back());
+                m_freeCaches.erase(m_freeCaches.end()-1);
+                slab_change->block = block;
+                slab_change->serializedPayload.data = block;
+                slab_change->serializedPayload.max_size = block_size;
+                *chan = slab_change;
+            }
+            break;
     }
 
     return true;
@@ -151,33 +231,35 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
     switch(memoryMode)
     {
         case PREALLOCATED_MEMORY_MODE:
-            ch->kind = ALIVE;
-            ch->sequenceNumber.high = 0;
-            ch->sequenceNumber.low = 0;
-            ch->writerGUID = c_Guid_Unknown;
-            ch->serializedPayload.length = 0;
-            ch->serializedPayload.pos = 0;
-            for(uint8_t i=0;i<16;++i)
-                ch->instanceHandle.value[i] = 0;
-            ch->isRead = 0;
-            ch->sourceTimestamp.seconds(0);
-            ch->sourceTimestamp.fraction(0);
-            m_freeCaches.push_back(ch);
-            break;
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-            ch->kind = ALIVE;
-            ch->sequenceNumber.high = 0;
-            ch->sequenceNumber.low = 0;
-            ch->writerGUID = c_Guid_Unknown;
-            ch->serializedPayload.length = 0;
-            ch->serializedPayload.pos = 0;
-            for(uint8_t i=0;i<16;++i)
-                ch->instanceHandle.value[i] = 0;
-            ch->isRead = 0;
-            ch->sourceTimestamp.seconds(0);
-            ch->sourceTimestamp.fraction(0);
+            reset_change(ch);
             m_freeCaches.push_back(ch);
             break;
+        case SLAB_MEMORY_MODE:
+            {
+                reset_change(ch);
+
+                SlabCacheChange* slab_change = static_cast<SlabCacheChange*>(ch);
+                if(slab_change->block != nullptr)
+                {
+                    if(slab_change->serializedPayload.data == slab_change->block)
+                    {
+                        releaseBlock(slab_change->block, slab_change->serializedPayload.max_size);
+                        slab_change->serializedPayload.data = nullptr;
+                        slab_change->serializedPayload.max_size = 0;
+                    }
+                    else
+                    {
+                        logWarning(RTPS_HISTORY, "Payload of a slab CacheChange was replaced. Its block will not be reused");
+                    }
+                    slab_change->block = nullptr;
+                }
+                // Anything still attached was allocated outside the slabs.
+                slab_change->serializedPayload.empty();
+
+                m_freeCaches.push_back(ch);
+            }
+            break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
             // Find pointer in CacheChange vector, remove element, then delete it
             std::vector<CacheChange_t*>::iterator target = m_allCaches.begin();
@@ -196,6 +278,187 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
     }
 }
 
+bool CacheChangePool::reserve_payload(CacheChange_t* change, uint32_t dataSize)
+{
+    if(dataSize <= change->serializedPayload.max_size)
+    {
+        return true;
+    }
+
+    switch(memoryMode)
+    {
+        case PREALLOCATED_MEMORY_MODE:
+            return false;
+
+        case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+        case DYNAMIC_RESERVE_MEMORY_MODE:
+            try
+            {
+                change->serializedPayload.reserve(dataSize);
+            }
+            catch(std::bad_alloc& ex)
+            {
+                logError(RTPS_HISTORY, "Failed to allocate memory for the serializedPayload, exception caught: " << ex.what());
+                return false;
+            }
+            break;
+
+        case SLAB_MEMORY_MODE:
+            {
+                SlabCacheChange* slab_change = static_cast<SlabCacheChange*>(change);
+                if(slab_change->serializedPayload.data != slab_change->block)
+                {
+                    logError(RTPS_HISTORY, "Payload of a slab CacheChange was replaced and cannot grow");
+                    return false;
+                }
+
+                uint32_t block_size = 0;
+                octet* block = allocateBlock(dataSize, block_size);
+                if(block == nullptr)
+                {
+                    return false;
+                }
+
+                if(slab_change->block != nullptr)
+                {
+                    memcpy(block, slab_change->block, slab_change->serializedPayload.length);
+                    releaseBlock(slab_change->block, slab_change->serializedPayload.max_size);
+                }
+
+                slab_change->block = block;
+                slab_change->serializedPayload.data = block;
+                slab_change->serializedPayload.max_size = block_size;
+            }
+            break;
+    }
+
+    return true;
+}
+
+void CacheChangePool::reset_change(CacheChange_t* ch)
+{
+    ch->kind = ALIVE;
+    ch->sequenceNumber.high = 0;
+    ch->sequenceNumber.low = 0;
+    ch->writerGUID = c_Guid_Unknown;
+    ch->serializedPayload.length = 0;
+    ch->serializedPayload.pos = 0;
+    for(uint8_t i=0;i<16;++i)
+        ch->instanceHandle.value[i] = 0;
+    ch->isRead = 0;
+    ch->sourceTimestamp.seconds(0);
+    ch->sourceTimestamp.fraction(0);
+}
+
+octet* CacheChangePool::allocateBlock(uint32_t dataSize, uint32_t& blockSize)
+{
+    assert(memoryMode == SLAB_MEMORY_MODE);
+
+    uint32_t shift = slab_min_class_shift;
+    while(shift < slab_max_class_shift && (uint32_t(1) << shift) < dataSize)
+    {
+        ++shift;
+    }
+
+    if((uint32_t(1) << shift) < dataSize)
+    {
+        logError(RTPS_HISTORY, "Payload of " << dataSize << " bytes exceeds the largest slab size class");
+        return nullptr;
+    }
+
+    size_t class_index = shift - slab_min_class_shift;
+    SizeClass& size_class = m_sizeClasses[class_index];
+    if(size_class.free_blocks.empty() && !allocateArena(class_index))
+    {
+        return nullptr;
+    }
+
+    octet* block = size_class.free_blocks.back();
+    size_class.free_blocks.pop_back();
+    blockSize = uint32_t(1) << shift;
+    return block;
+}
+
+void CacheChangePool::releaseBlock(octet* block, uint32_t blockSize)
+{
+    assert(memoryMode == SLAB_MEMORY_MODE);
+
+    uint32_t shift = slab_min_class_shift;
+    while((uint32_t(1) << shift) < blockSize)
+    {
+        ++shift;
+    }
+
+    // Capacity was reserved when the arena was created, so this never allocates.
+    m_sizeClasses[shift - slab_min_class_shift].free_blocks.push_back(block);
+}
+
+bool CacheChangePool::allocateArena(size_t class_index)
+{
+    SizeClass& size_class = m_sizeClasses[class_index];
+    size_t block_size = size_t(1) << (class_index + slab_min_class_shift);
+
+    size_t num_blocks = size_class.next_arena_blocks == 0 ? slab_initial_arena_blocks : size_class.next_arena_blocks;
+    if(num_blocks * block_size > slab_max_arena_size)
+    {
+        num_blocks = block_size < slab_max_arena_size ? slab_max_arena_size / block_size : 1;
+    }
+    size_t arena_size = num_blocks * block_size;
+
+    void* arena = nullptr;
+#if defined(__linux__)
+    if(arena_size >= slab_max_arena_size)
+    {
+        // Huge page aligned, so transparent huge pages can back the whole arena.
+        if(posix_memalign(&arena, slab_max_arena_size, arena_size) == 0)
+        {
+            madvise(arena, arena_size, MADV_HUGEPAGE);
+        }
+        else
+        {
+            arena = nullptr;
+        }
+    }
+    else
+#endif
+    {
+        arena = malloc(arena_size);
+    }
+
+    if(arena == nullptr)
+    {
+        logError(RTPS_HISTORY, "Failed to allocate a slab arena of " << arena_size << " bytes");
+        return false;
+    }
+
+    try
+    {
+        m_arenas.push_back(arena);
+        size_class.free_blocks.reserve(size_class.total_blocks + num_blocks);
+    }
+    catch(std::bad_alloc&)
+    {
+        if(!m_arenas.empty() && m_arenas.back() == arena)
+        {
+            m_arenas.pop_back();
+        }
+        free(arena);
+        logError(RTPS_HISTORY, "Failed to register a slab arena of " << arena_size << " bytes");
+        return false;
+    }
+
+    octet* blocks = static_cast<octet*>(arena);
+    for(size_t i = num_blocks; i > 0; --i)
+    {
+        size_class.free_blocks.push_back(blocks + (i - 1) * block_size);
+    }
+    size_class.total_blocks += static_cast<uint32_t>(num_blocks);
+    size_class.next_arena_blocks = static_cast<uint32_t>(num_blocks * 2);
+
+    logInfo(RTPS_UTILS, "Allocated slab arena of " << num_blocks << " blocks of " << block_size << " bytes");
+    return true;
+}
+
 bool CacheChangePool::allocateGroup(uint32_t group_size)
 {
     // This method should only called from within PREALLOCATED_MEMORY_MODE
@@ -219,7 +482,8 @@ bool CacheChangePool::allocateGroup(uint32_t group_size)
     }
     for(uint32_t i = 0; i < reserved; ++i)
     {
-        CacheChange_t* ch = new CacheChange_t(m_payload_size);
+        CacheChange_t* ch = memoryMode == SLAB_MEMORY_MODE ?
+            new SlabCacheChange() : new CacheChange_t(m_payload_size);
         m_allCaches.push_back(ch);
         m_freeCaches.push_back(ch);
         ++m_pool_size;
@@ -76,6 +76,13 @@ bool ReaderHistory::add_change(CacheChange_t* a_change)
 }
 
 bool ReaderHistory::remove_change(CacheChange_t* a_change)
+{
+    return remove_change(a_change, true);
+}
+
+bool ReaderHistory::remove_change(
+        CacheChange_t* a_change,
+        bool release)
 {
     if(mp_reader == nullptr || mp_mutex == nullptr)
     {
@@ -97,7 +104,10 @@ bool ReaderHistory::remove_change(CacheChange_t* a_change)
         {
             logInfo(RTPS_HISTORY,"Removing change "<< a_change->sequenceNumber);
             mp_reader->change_removed_by_history(a_change);
-            m_changePool.release_Cache(a_change);
+            if (release)
+            {
+                m_changePool.release_Cache(a_change);
+            }
             m_changes.erase(chit);
             sortCacheChanges();
             updateMaxMinSeqNum();
@@ -22,6 +22,7 @@
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../common/StatisticsCounters.h"
 
 #include <fastrtps/log/Log.h>
 
@@ -41,54 +42,6 @@ bool sort_SeqNum(const SequenceNumber_t& s1,const SequenceNumber_t& s2)
     return(s1 < s2);
 }
 
-typedef std::pair<SequenceNumber_t,SequenceNumberSet_t> pair_T;
-
-void prepare_SequenceNumberSet(std::set<SequenceNumber_t>& changesSeqNum,
-        std::vector<pair_T>& sequences)
-{
-    //First compute the number of GAP messages we need:
-    bool new_pair = true;
-    bool seqnumset_init = false;
-    uint32_t count = 0;
-    for(auto it = changesSeqNum.begin();
-            it!=changesSeqNum.end();++it)
-    {
-        if(new_pair)
-        {
-            SequenceNumberSet_t seqset((*it) + 1); // IN CASE IN THIS SEQNUMSET there is only 1 number.
-            pair_T pair(*it,seqset);
-            sequences.push_back(pair);
-            new_pair = false;
-            seqnumset_init = true;
-            count = 1;
-            continue;
-        }
-        if((*it - sequences.back().first).low == count) //CONTINUOUS FROM THE START
-        {
-            ++count;
-            sequences.back().second.base((*it)+1);
-            continue;
-        }
-        else
-        {
-            if(seqnumset_init) //FIRST TIME SINCE it was continuous
-            {
-                sequences.back().second.base((*(std::prev(it)) + 1));
-                seqnumset_init = false;
-            }
-            // Try to add, If it fails the diference between *it and base is greater than 255.
-            if(sequences.back().second.add((*it)))
-                continue;
-            else
-            {
-                // Process again the sequence number in a new pair in next loop.
-                --it;
-                new_pair = true;
-            }
-        }
-    }
-}
-
 bool compare_remote_participants(const std::vector<GUID_t>& remote_participants1,
         const std::vector<GuidPrefix_t>& remote_participants2)
 {
@@ -224,6 +177,11 @@ void RTPSMessageGroup::send()
             throw timeout();
         }
         currentBytesSent_ += msgToSend->length;
+
+        if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+        {
+            stats->message_sizes.record(msgToSend->length);
+        }
     }
 }
 
@@ -390,7 +348,18 @@ bool RTPSMessageGroup::add_data(
     }
 #endif
 
-    return insert_submessage();
+    if (!insert_submessage())
+    {
+        return false;
+    }
+
+    if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+    {
+        statistics_add(stats->data_sent);
+        statistics_add(stats->bytes_sent, change.serializedPayload.length);
+    }
+
+    return true;
 }
 
 bool RTPSMessageGroup::add_data_frag(
@@ -487,7 +456,18 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif
 
-    return insert_submessage();
+    if (!insert_submessage())
+    {
+        return false;
+    }
+
+    if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+    {
+        statistics_add(stats->data_frags_sent);
+        statistics_add(stats->bytes_sent, fragment_size);
+    }
+
+    return true;
 }
 
 bool RTPSMessageGroup::add_heartbeat(
@@ -538,67 +518,128 @@ bool RTPSMessageGroup::add_heartbeat(
     }
 #endif
 
-    return insert_submessage();
+    if (!insert_submessage())
+    {
+        return false;
+    }
+
+    if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+    {
+        statistics_add(stats->heartbeats_sent);
+    }
+
+    return true;
 }
 
-// TODO (Ricardo) Check with standard 8.3.7.4.5
 bool RTPSMessageGroup::add_gap(std::set<SequenceNumber_t>& changesSeqNum)
 {
-    std::vector<pair_T> Sequences;
-    prepare_SequenceNumberSet(changesSeqNum, Sequences);
-    std::vector<pair_T>::iterator seqit = Sequences.begin();
-
-    uint16_t gap_n = 1;
-
-    while(gap_n <= Sequences.size()) //There is still a message to add
-    {
-        // Check preconditions. If fail flush and reset.
-        check_and_maybe_flush();
-
-#if HAVE_SECURITY
-        uint32_t from_buffer_position = submessage_msg_->pos;
-#endif
+    return add_gaps(changesSeqNum.begin(), changesSeqNum.end());
+}
 
-        const EntityId_t& readerId = get_entity_id(sender_.remote_guids());
+bool RTPSMessageGroup::add_gap(const std::vector<SequenceNumber_t>& changes_seq_numbers)
+{
+    return add_gaps(changes_seq_numbers.begin(), changes_seq_numbers.end());
+}
 
-        if(!RTPSMessageCreator::addSubmessageGap(submessage_msg_, seqit->first, seqit->second,
-                readerId, endpoint_->getGuid().entityId))
-        {
-            logError(RTPS_WRITER, "Cannot add GAP submsg to the CDRMessage. Buffer too small");
-            break;
-        }
+// TODO (Ricardo) Check with standard 8.3.7.4.5
+template<class SequenceIterator>
+bool RTPSMessageGroup::add_gaps(
+        SequenceIterator first,
+        SequenceIterator last)
+{
+    // Each GAP covers a run of consecutive sequence numbers from gap_start, followed by a bitmap with the sequence
+    // numbers that are not consecutive. A new GAP is started when a sequence number does not fit on the bitmap.
+    SequenceNumber_t gap_start;
+    SequenceNumberSet_t gap_list;
+    uint32_t count = 0;
+    bool continuous = false;
 
-#if HAVE_SECURITY
-        if(endpoint_->getAttributes().security_attributes().is_submessage_protected)
+    for(SequenceIterator it = first; it != last; ++it)
+    {
+        if(count > 0)
         {
-            submessage_msg_->pos = from_buffer_position;
-            CDRMessage::initCDRMsg(encrypt_msg_);
-            if(!participant_->security_manager().encode_writer_submessage(*submessage_msg_, *encrypt_msg_,
-                        endpoint_->getGuid(), sender_.remote_guids()))
+            if(continuous && (*it - gap_start).low == count)
             {
-                logError(RTPS_WRITER, "Cannot encrypt DATA submessage for writer " << endpoint_->getGuid());
-                return false;
+                ++count;
+                gap_list.base((*it) + 1);
+                continue;
             }
 
-            if((submessage_msg_->max_size - from_buffer_position) >= encrypt_msg_->length)
+            continuous = false;
+            if(gap_list.add(*it))
             {
-                memcpy(&submessage_msg_->buffer[from_buffer_position], encrypt_msg_->buffer, encrypt_msg_->length);
-                submessage_msg_->length = from_buffer_position + encrypt_msg_->length;
-                submessage_msg_->pos = submessage_msg_->length;
+                continue;
             }
-            else
+
+            if(!add_gap(gap_start, gap_list))
             {
-                logError(RTPS_OUT, "Not enough memory to copy encrypted data for " << endpoint_->getGuid());
                 return false;
             }
         }
+
+        gap_start = *it;
+        gap_list.base((*it) + 1);
+        count = 1;
+        continuous = true;
+    }
+
+    return count == 0 || add_gap(gap_start, gap_list);
+}
+
+bool RTPSMessageGroup::add_gap(
+        const SequenceNumber_t& gap_start,
+        const SequenceNumberSet_t& gap_list)
+{
+    // Check preconditions. If fail flush and reset.
+    check_and_maybe_flush();
+
+#if HAVE_SECURITY
+    uint32_t from_buffer_position = submessage_msg_->pos;
 #endif
 
-        if(!insert_submessage())
-            break;
+    const EntityId_t& readerId = get_entity_id(sender_.remote_guids());
 
-        ++gap_n;
-        ++seqit;
+    if(!RTPSMessageCreator::addSubmessageGap(submessage_msg_, gap_start, gap_list,
+            readerId, endpoint_->getGuid().entityId))
+    {
+        logError(RTPS_WRITER, "Cannot add GAP submsg to the CDRMessage. Buffer too small");
+        return false;
+    }
+
+#if HAVE_SECURITY
+    if(endpoint_->getAttributes().security_attributes().is_submessage_protected)
+    {
+        submessage_msg_->pos = from_buffer_position;
+        CDRMessage::initCDRMsg(encrypt_msg_);
+        if(!participant_->security_manager().encode_writer_submessage(*submessage_msg_, *encrypt_msg_,
+                    endpoint_->getGuid(), sender_.remote_guids()))
+        {
+            logError(RTPS_WRITER, "Cannot encrypt DATA submessage for writer " << endpoint_->getGuid());
+            return false;
+        }
+
+        if((submessage_msg_->max_size - from_buffer_position) >= encrypt_msg_->length)
+        {
+            memcpy(&submessage_msg_->buffer[from_buffer_position], encrypt_msg_->buffer, encrypt_msg_->length);
+            submessage_msg_->length = from_buffer_position + encrypt_msg_->length;
+            submessage_msg_->pos = submessage_msg_->length;
+        }
+        else
+        {
+            logError(RTPS_OUT, "Not enough memory to copy encrypted data for " << endpoint_->getGuid());
+            return false;
+        }
+    }
+#endif
+
+    if(!insert_submessage())
+    {
+        return false;
+    }
+
+    if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+    {
+        statistics_add(stats->gaps_sent);
     }
 
     return true;
@@ -656,7 +697,17 @@ bool RTPSMessageGroup::add_acknack(
     }
 #endif
 
-    return insert_submessage();
+    if (!insert_submessage())
+    {
+        return false;
+    }
+
+    if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+    {
+        statistics_add(stats->acknacks_sent);
+    }
+
+    return true;
 }
 
 bool RTPSMessageGroup::add_nackfrag(
@@ -706,7 +757,17 @@ bool RTPSMessageGroup::add_nackfrag(
     }
 #endif
 
-    return insert_submessage();
+    if (!insert_submessage())
+    {
+        return false;
+    }
+
+    if (EndpointStatisticsCounters* stats = endpoint_->statistics())
+    {
+        statistics_add(stats->nackfrags_sent);
+    }
+
+    return true;
 }
 
 } /* namespace rtps */
@@ -291,6 +291,18 @@ void NetworkFactory::Shutdown()
     }
 }
 
+void NetworkFactory::get_transport_statistics(std::vector<TransportStatistics>& stats) const
+{
+    for (auto& transport : mRegisteredTransports)
+    {
+        TransportStatistics transport_stats;
+        if (transport->get_statistics(transport_stats))
+        {
+            stats.push_back(transport_stats);
+        }
+    }
+}
+
 uint16_t NetworkFactory::calculateWellKnownPort(const RTPSParticipantAttributes& att) const
 {
 
@@ -125,6 +125,11 @@ WLP* RTPSParticipant::wlp() const
     return mp_impl->wlp();
 }
 
+bool RTPSParticipant::get_statistics(ParticipantStatistics& stats) const
+{
+    return mp_impl->get_statistics(stats);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
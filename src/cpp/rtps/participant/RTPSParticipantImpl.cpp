@@ -21,6 +21,7 @@
 
 #include "../flowcontrol/ThroughputController.h"
 #include "../persistence/PersistenceService.h"
+#include "../common/StatisticsCounters.h"
 
 #include <fastrtps/rtps/messages/MessageReceiver.h>
 
@@ -28,6 +29,8 @@
 #include <fastrtps/rtps/writer/StatefulWriter.h>
 #include <fastrtps/rtps/writer/StatelessPersistentWriter.h>
 #include <fastrtps/rtps/writer/StatefulPersistentWriter.h>
+#include <fastrtps/rtps/history/WriterHistory.h>
+#include <fastrtps/rtps/history/ReaderHistory.h>
 
 #include <fastrtps/rtps/reader/StatelessReader.h>
 #include <fastrtps/rtps/reader/StatefulReader.h>
@@ -91,7 +94,12 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     , mp_participantListener(plisten)
     , mp_userParticipant(par)
     , mp_mutex(new std::recursive_mutex())
+    , statistics_enabled_(false)
 {
+    const std::string* statistics_property = PropertyPolicyHelper::find_property(PParam.properties,
+            "fastrtps.statistics");
+    statistics_enabled_ = statistics_property != nullptr && statistics_property->compare("true") == 0;
+
     // Builtin transport by default
     if (PParam.useBuiltinTransports)
     {
@@ -128,7 +136,10 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     }
 
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
+    mp_event_thr.init_thread(m_att.timed_events_thread, "dds.ev." + std::to_string(m_att.participantID));
+    async_thread_.thread_settings(m_att.async_writer_thread,
+            "dds.asyncw." + std::to_string(m_att.participantID));
+    FlowController::SetThreadSettings(m_att.flow_controller_thread);
 
     // Throughput controller, if the descriptor has valid values
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
@@ -258,6 +269,45 @@ const std::vector<RTPSReader*>& RTPSParticipantImpl::getAllReaders() const
     return m_allReaderList;
 }
 
+bool RTPSParticipantImpl::get_statistics(ParticipantStatistics& stats)
+{
+    if (!statistics_enabled_)
+    {
+        return false;
+    }
+
+    stats.writers.clear();
+    stats.readers.clear();
+    stats.transports.clear();
+
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+
+        stats.writers.reserve(m_allWriterList.size());
+        for (RTPSWriter* writer : m_allWriterList)
+        {
+            WriterStatistics writer_stats;
+            writer_stats.guid = writer->getGuid();
+            writer_stats.history_depth = writer->mp_history->getHistorySize();
+            writer->statistics()->fill(writer_stats);
+            stats.writers.push_back(writer_stats);
+        }
+
+        stats.readers.reserve(m_allReaderList.size());
+        for (RTPSReader* reader : m_allReaderList)
+        {
+            ReaderStatistics reader_stats;
+            reader_stats.guid = reader->getGuid();
+            reader_stats.history_depth = reader->mp_history->getHistorySize();
+            reader->statistics()->fill(reader_stats);
+            stats.readers.push_back(reader_stats);
+        }
+    }
+
+    m_network_Factory.get_transport_statistics(stats.transports);
+    return true;
+}
+
 RTPSParticipantImpl::~RTPSParticipantImpl()
 {
     // Disable Retries on Transports
@@ -270,6 +320,11 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
         block.disable();
     }
 
+#if HAVE_SECURITY
+    // Handshake steps use the builtin protocols and the endpoints, so they are stopped first.
+    m_security_manager.stop_handshake_pool();
+#endif
+
     while(m_userReaderList.size() > 0)
     {
         deleteUserEndpoint(static_cast<Endpoint*>(*m_userReaderList.begin()));
@@ -429,6 +484,11 @@ bool RTPSParticipantImpl::createWriter(
     }
 #endif
 
+    if (statistics_enabled_)
+    {
+        SWriter->statistics_ = std::make_shared<EndpointStatisticsCounters>();
+    }
+
     createSendResources(SWriter);
     if (param.endpoint.reliabilityKind == RELIABLE)
     {
@@ -577,6 +637,11 @@ bool RTPSParticipantImpl::createReader(
     }
 #endif
 
+    if (statistics_enabled_)
+    {
+        SReader->statistics_ = std::make_shared<EndpointStatisticsCounters>();
+    }
+
     if (param.endpoint.reliabilityKind == RELIABLE)
     {
         createSendResources(SReader);
@@ -40,6 +40,7 @@
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
 #include <fastrtps/rtps/builtin/data/WriterProxyData.h>
 #include <fastrtps/rtps/network/NetworkFactory.h>
+#include <fastrtps/rtps/common/Statistics.h>
 #include <fastrtps/rtps/network/ReceiverResource.h>
 #include <fastrtps/rtps/network/SenderResource.h>
 #include <fastrtps/rtps/messages/MessageReceiver.h>
@@ -252,6 +253,13 @@ public:
 
     AsyncWriterThread& async_thread() { return async_thread_; }
 
+    /**
+     * Takes a snapshot of the statistics of every endpoint and transport of this participant.
+     * @param stats Structure to be filled.
+     * @return false if statistics are not enabled on this participant.
+     */
+    bool get_statistics(ParticipantStatistics& stats);
+
 private:
     //!Attributes of the RTPSParticipant
     RTPSParticipantAttributes m_att;
@@ -358,6 +366,9 @@ private:
     //!Participant Mutex
     std::recursive_mutex* mp_mutex;
 
+    //!Whether endpoints keep statistics counters, set with the "fastrtps.statistics" property.
+    bool statistics_enabled_;
+
     /*
         * Flow controllers for this participant.
         */
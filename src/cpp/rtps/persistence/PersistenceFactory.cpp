@@ -21,6 +21,9 @@
 #include "SQLite3PersistenceService.h"
 
 #include <fastrtps/rtps/attributes/PropertyPolicy.h>
+#include <fastrtps/log/Log.h>
+
+#include <string>
 
 namespace eprosima {
 namespace fastrtps{
@@ -38,7 +41,29 @@ IPersistenceService* PersistenceFactory::create_persistence_service(const Proper
             const std::string* filename_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.sqlite3.filename");
             const char* filename = (filename_property == nullptr) ?
                 "persistence.db" : filename_property->c_str();
-            ret_val = create_SQLite3_persistence_service(filename);
+
+            uint32_t batch_size = 0;
+            uint32_t max_batch_latency_ms = c_SQLite3DefaultMaxBatchLatencyMs;
+            const std::string* batch_size_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.sqlite3.batch_size");
+            const std::string* latency_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.sqlite3.batch_max_latency_ms");
+            try
+            {
+                if (batch_size_property != nullptr)
+                {
+                    batch_size = static_cast<uint32_t>(std::stoul(*batch_size_property));
+                }
+                if (latency_property != nullptr)
+                {
+                    max_batch_latency_ms = static_cast<uint32_t>(std::stoul(*latency_property));
+                }
+            }
+            catch (std::exception&)
+            {
+                logError(RTPS_PERSISTENCE, "Invalid value on SQLite3 batching properties. Batching disabled");
+                batch_size = 0;
+            }
+
+            ret_val = create_SQLite3_persistence_service(filename, batch_size, max_batch_latency_ms);
         }
     }
 
@@ -82,36 +82,76 @@ static void finalize_statement(sqlite3_stmt*& stmt)
     }
 }
 
-IPersistenceService* create_SQLite3_persistence_service(const char* filename)
+IPersistenceService* create_SQLite3_persistence_service(
+        const char* filename,
+        uint32_t batch_size,
+        uint32_t max_batch_latency_ms)
 {
     sqlite3* db = open_or_create_database(filename);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, batch_size, max_batch_latency_ms);
 }
 
-SQLite3PersistenceService::SQLite3PersistenceService(sqlite3* db):
+SQLite3PersistenceService::SQLite3PersistenceService(
+        sqlite3* db,
+        uint32_t batch_size,
+        uint32_t max_batch_latency_ms):
     db_(db),
     load_writer_stmt_(NULL),
     add_writer_change_stmt_(NULL),
     remove_writer_change_stmt_(NULL),
+    remove_writer_changes_stmt_(NULL),
     load_reader_stmt_(NULL),
-    update_reader_stmt_(NULL)
+    update_reader_stmt_(NULL),
+    batch_size_(batch_size),
+    max_batch_latency_(max_batch_latency_ms),
+    committer_running_(false)
 {
     // Prepare writer statements
     sqlite3_prepare_v3(db_,"SELECT seq_num,instance,payload FROM writers WHERE guid=?;",-1,SQLITE_PREPARE_PERSISTENT,&load_writer_stmt_,NULL);
     sqlite3_prepare_v3(db_,"INSERT INTO writers VALUES(?,?,?,?);",-1,SQLITE_PREPARE_PERSISTENT,&add_writer_change_stmt_,NULL);
     sqlite3_prepare_v3(db_,"DELETE FROM writers WHERE guid=? AND seq_num=?;",-1,SQLITE_PREPARE_PERSISTENT,&remove_writer_change_stmt_,NULL);
+    sqlite3_prepare_v3(db_,"DELETE FROM writers WHERE guid=? AND seq_num>=? AND seq_num<=?;",-1,SQLITE_PREPARE_PERSISTENT,&remove_writer_changes_stmt_,NULL);
 
     // Prepare reader statements
     sqlite3_prepare_v3(db_, "SELECT writer_guid_prefix,writer_guid_entity,seq_num FROM readers WHERE guid=?;", -1, SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT, &update_reader_stmt_, NULL);
+
+    if (batch_size_ > 0)
+    {
+        // Batches are committed by a single writer, so WAL keeps readers and the committer from blocking each other
+        // and lets a transaction be committed with a single sync.
+        if (sqlite3_exec(db_, "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;", 0, 0, 0) != SQLITE_OK)
+        {
+            logWarning(RTPS_PERSISTENCE, "Could not set WAL journal mode on persistence database");
+        }
+
+        committer_running_ = true;
+        committer_thread_ = std::thread(&SQLite3PersistenceService::run_committer, this);
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    if (committer_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> guard(queue_mutex_);
+            committer_running_ = false;
+        }
+        queue_cv_.notify_one();
+        committer_thread_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(db_mutex_);
+        commit_pending();
+    }
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
     finalize_statement(add_writer_change_stmt_);
     finalize_statement(remove_writer_change_stmt_);
+    finalize_statement(remove_writer_changes_stmt_);
 
     // Finalize reader statements
     finalize_statement(load_reader_stmt_);
@@ -134,6 +174,9 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    commit_pending();
+
     if (load_writer_stmt_ != NULL)
     {
         sqlite3_reset(load_writer_stmt_);
@@ -175,24 +218,24 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
-    if (add_writer_change_stmt_ != NULL)
+    if (batch_size_ > 0)
     {
-        sqlite3_reset(add_writer_change_stmt_);
-        sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-        if (change.instanceHandle.isDefined())
-        {
-            sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
-        }
-        else
-        {
-            sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
-        }
-        sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data, change.serializedPayload.length, SQLITE_STATIC);
-        return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
+        PendingWriterOperation operation;
+        operation.is_add = true;
+        operation.persistence_guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber.to64long();
+        operation.has_instance = change.instanceHandle.isDefined();
+        memcpy(operation.instance, change.instanceHandle.value, 16);
+        operation.payload.assign(change.serializedPayload.data,
+                change.serializedPayload.data + change.serializedPayload.length);
+        enqueue(std::move(operation));
+        return true;
     }
 
-    return false;
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return store_writer_change(persistence_guid, change.sequenceNumber.to64long(),
+            change.instanceHandle.isDefined() ? change.instanceHandle.value : nullptr,
+            change.serializedPayload.data, change.serializedPayload.length);
 }
 
 /**
@@ -206,15 +249,20 @@ bool SQLite3PersistenceService::remove_writer_change_from_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
 
-    if (remove_writer_change_stmt_ != NULL)
+    if (batch_size_ > 0)
     {
-        sqlite3_reset(remove_writer_change_stmt_);
-        sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-        return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
+        PendingWriterOperation operation;
+        operation.is_add = false;
+        operation.persistence_guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber.to64long();
+        operation.has_instance = false;
+        enqueue(std::move(operation));
+        return true;
     }
 
-    return false;
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    sqlite3_int64 sn = change.sequenceNumber.to64long();
+    return delete_writer_changes(persistence_guid, sn, sn);
 }
 
 /**
@@ -228,6 +276,9 @@ bool SQLite3PersistenceService::load_reader_from_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    commit_pending();
+
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -261,6 +312,91 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
 {
     logInfo(RTPS_PERSISTENCE, "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    if (batch_size_ > 0)
+    {
+        // Only the last value for each writer needs to reach the database
+        bool notify = false;
+        {
+            std::lock_guard<std::mutex> guard(queue_mutex_);
+            // The committer is woken up to start the latency timer and when the batch is full
+            if (pending_writer_ops_.empty() && pending_reader_updates_.empty())
+            {
+                first_pending_time_ = std::chrono::steady_clock::now();
+                notify = true;
+            }
+            pending_reader_updates_[std::make_pair(reader_guid, writer_guid)] = seq_number;
+            notify |= (pending_writer_ops_.size() + pending_reader_updates_.size()) >= batch_size_;
+        }
+        if (notify)
+        {
+            queue_cv_.notify_one();
+        }
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(db_mutex_);
+    return store_writer_seq(reader_guid, writer_guid, seq_number);
+}
+
+bool SQLite3PersistenceService::store_writer_change(
+        const std::string& persistence_guid,
+        sqlite3_int64 sequence_number,
+        const octet* instance,
+        const octet* payload,
+        uint32_t payload_length)
+{
+    if (add_writer_change_stmt_ != NULL)
+    {
+        sqlite3_reset(add_writer_change_stmt_);
+        sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(add_writer_change_stmt_, 2, sequence_number);
+        if (instance != nullptr)
+        {
+            sqlite3_bind_blob(add_writer_change_stmt_, 3, instance, 16, SQLITE_STATIC);
+        }
+        else
+        {
+            sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
+        }
+        sqlite3_bind_blob(add_writer_change_stmt_, 4, payload, payload_length, SQLITE_STATIC);
+        return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
+    }
+
+    return false;
+}
+
+bool SQLite3PersistenceService::delete_writer_changes(
+        const std::string& persistence_guid,
+        sqlite3_int64 first_sequence_number,
+        sqlite3_int64 last_sequence_number)
+{
+    if (first_sequence_number == last_sequence_number)
+    {
+        if (remove_writer_change_stmt_ != NULL)
+        {
+            sqlite3_reset(remove_writer_change_stmt_);
+            sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(remove_writer_change_stmt_, 2, first_sequence_number);
+            return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
+        }
+    }
+    else if (remove_writer_changes_stmt_ != NULL)
+    {
+        sqlite3_reset(remove_writer_changes_stmt_);
+        sqlite3_bind_text(remove_writer_changes_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(remove_writer_changes_stmt_, 2, first_sequence_number);
+        sqlite3_bind_int64(remove_writer_changes_stmt_, 3, last_sequence_number);
+        return sqlite3_step(remove_writer_changes_stmt_) == SQLITE_DONE;
+    }
+
+    return false;
+}
+
+bool SQLite3PersistenceService::store_writer_seq(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
@@ -274,6 +410,137 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     return false;
 }
 
+void SQLite3PersistenceService::enqueue(PendingWriterOperation&& operation)
+{
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> guard(queue_mutex_);
+        // The committer is woken up to start the latency timer and when the batch is full
+        if (pending_writer_ops_.empty() && pending_reader_updates_.empty())
+        {
+            first_pending_time_ = std::chrono::steady_clock::now();
+            notify = true;
+        }
+        pending_writer_ops_.push_back(std::move(operation));
+        notify |= (pending_writer_ops_.size() + pending_reader_updates_.size()) >= batch_size_;
+    }
+
+    if (notify)
+    {
+        queue_cv_.notify_one();
+    }
+}
+
+bool SQLite3PersistenceService::commit_pending()
+{
+    std::vector<PendingWriterOperation> writer_ops;
+    PendingReaderUpdates reader_updates;
+    {
+        std::lock_guard<std::mutex> guard(queue_mutex_);
+        writer_ops.swap(pending_writer_ops_);
+        reader_updates.swap(pending_reader_updates_);
+    }
+
+    if (writer_ops.empty() && reader_updates.empty())
+    {
+        return true;
+    }
+
+    if (sqlite3_exec(db_, "BEGIN TRANSACTION;", 0, 0, 0) != SQLITE_OK)
+    {
+        logError(RTPS_PERSISTENCE, "Could not begin persistence transaction");
+        return false;
+    }
+
+    size_t i = 0;
+    while (i < writer_ops.size())
+    {
+        const PendingWriterOperation& operation = writer_ops[i];
+        if (operation.is_add)
+        {
+            if (!store_writer_change(operation.persistence_guid, operation.sequence_number,
+                    operation.has_instance ? operation.instance : nullptr,
+                    operation.payload.data(), static_cast<uint32_t>(operation.payload.size())))
+            {
+                logWarning(RTPS_PERSISTENCE, "Could not store change " << operation.sequence_number <<
+                        " of writer " << operation.persistence_guid);
+            }
+            ++i;
+        }
+        else
+        {
+            // Consecutive removals of consecutive sequence numbers are deleted with a single statement
+            sqlite3_int64 last = operation.sequence_number;
+            size_t j = i + 1;
+            while (j < writer_ops.size() && !writer_ops[j].is_add &&
+                    writer_ops[j].sequence_number == last + 1 &&
+                    writer_ops[j].persistence_guid == operation.persistence_guid)
+            {
+                last = writer_ops[j].sequence_number;
+                ++j;
+            }
+
+            if (!delete_writer_changes(operation.persistence_guid, operation.sequence_number, last))
+            {
+                logWarning(RTPS_PERSISTENCE, "Could not remove changes " << operation.sequence_number <<
+                        " to " << last << " of writer " << operation.persistence_guid);
+            }
+            i = j;
+        }
+    }
+
+    for (auto& update : reader_updates)
+    {
+        if (!store_writer_seq(update.first.first, update.first.second, update.second))
+        {
+            logWarning(RTPS_PERSISTENCE, "Could not store seq for writer " << update.first.second <<
+                    " on reader " << update.first.first);
+        }
+    }
+
+    if (sqlite3_exec(db_, "COMMIT;", 0, 0, 0) != SQLITE_OK)
+    {
+        logError(RTPS_PERSISTENCE, "Could not commit persistence transaction");
+        sqlite3_exec(db_, "ROLLBACK;", 0, 0, 0);
+        return false;
+    }
+
+    return true;
+}
+
+void SQLite3PersistenceService::run_committer()
+{
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+
+    while (committer_running_)
+    {
+        size_t pending = pending_writer_ops_.size() + pending_reader_updates_.size();
+        if (pending == 0)
+        {
+            queue_cv_.wait(lock);
+            continue;
+        }
+
+        if (pending < batch_size_)
+        {
+            std::chrono::steady_clock::time_point deadline = first_pending_time_ + max_batch_latency_;
+            if (std::chrono::steady_clock::now() < deadline)
+            {
+                queue_cv_.wait_until(lock, deadline);
+                continue;
+            }
+        }
+
+        // db_mutex_ is always taken before queue_mutex_
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> guard(db_mutex_);
+            commit_pending();
+        }
+        lock.lock();
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
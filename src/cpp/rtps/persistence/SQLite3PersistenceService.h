@@ -22,25 +22,49 @@
 #include "PersistenceService.h"
 #include "sqlite3.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+//! Default maximum time, in milliseconds, an operation waits before its batch is committed.
+const uint32_t c_SQLite3DefaultMaxBatchLatencyMs = 10;
+
 /**
 * Create a new SQLite3 implementation of persistence service
+* @param filename Name of the database file.
+* @param batch_size Maximum number of operations grouped on a single transaction. Zero disables batching.
+* @param max_batch_latency_ms Maximum time an operation waits before its batch is committed.
 * @ingroup RTPS_PERSISTENCE_MODULE
 */
-IPersistenceService* create_SQLite3_persistence_service(const char* filename);
+IPersistenceService* create_SQLite3_persistence_service(
+        const char* filename,
+        uint32_t batch_size = 0,
+        uint32_t max_batch_latency_ms = c_SQLite3DefaultMaxBatchLatencyMs);
 
 
 /**
-* Persistence service implementation over SQLite3
+* Persistence service implementation over SQLite3.
+*
+* When batching is enabled, operations are queued and a background thread commits them grouped on a single
+* transaction once batch_size operations are queued or the oldest one has waited max_batch_latency_ms.
+* The database is then switched to WAL journal mode. Loading operations commit the queued ones first.
 * @ingroup RTPS_PERSISTENCE_MODULE
 */
 class SQLite3PersistenceService : public IPersistenceService
 {
 public:
-    SQLite3PersistenceService(sqlite3* db);
+    SQLite3PersistenceService(
+            sqlite3* db,
+            uint32_t batch_size = 0,
+            uint32_t max_batch_latency_ms = c_SQLite3DefaultMaxBatchLatencyMs);
     virtual ~SQLite3PersistenceService() override;
 
     /**
@@ -94,14 +118,68 @@ public:
             const SequenceNumber_t& seq_number) final;
 
 private:
+
+    //! Writer operation waiting to be committed
+    struct PendingWriterOperation
+    {
+        bool is_add;
+        std::string persistence_guid;
+        sqlite3_int64 sequence_number;
+        bool has_instance;
+        octet instance[16];
+        std::vector<octet> payload;
+    };
+
+    typedef std::map<std::pair<std::string, GUID_t>, SequenceNumber_t> PendingReaderUpdates;
+
+    bool store_writer_change(
+            const std::string& persistence_guid,
+            sqlite3_int64 sequence_number,
+            const octet* instance,
+            const octet* payload,
+            uint32_t payload_length);
+
+    bool delete_writer_changes(
+            const std::string& persistence_guid,
+            sqlite3_int64 first_sequence_number,
+            sqlite3_int64 last_sequence_number);
+
+    bool store_writer_seq(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number);
+
+    void enqueue(PendingWriterOperation&& operation);
+
+    //! Commits all queued operations. db_mutex_ should be locked.
+    bool commit_pending();
+
+    void run_committer();
+
     sqlite3* db_;
 
+    //! Protects the use of the prepared statements
+    std::mutex db_mutex_;
+
     sqlite3_stmt* load_writer_stmt_;
     sqlite3_stmt* add_writer_change_stmt_;
     sqlite3_stmt* remove_writer_change_stmt_;
+    sqlite3_stmt* remove_writer_changes_stmt_;
 
     sqlite3_stmt* load_reader_stmt_;
     sqlite3_stmt* update_reader_stmt_;
+
+    size_t batch_size_;
+    std::chrono::milliseconds max_batch_latency_;
+
+    //! Protects the queues of pending operations. When both are needed, lock db_mutex_ first.
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::vector<PendingWriterOperation> pending_writer_ops_;
+    PendingReaderUpdates pending_reader_updates_;
+    std::chrono::steady_clock::time_point first_pending_time_;
+    bool committer_running_;
+    std::thread committer_thread_;
 };
 
 } /* namespace rtps */
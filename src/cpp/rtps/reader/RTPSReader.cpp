@@ -26,6 +26,7 @@
 #include <fastrtps/rtps/reader/ReaderListener.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include "../participant/RTPSParticipantImpl.h"
+#include "../common/StatisticsCounters.h"
 
 #include <foonathan/memory/namespace_alias.hpp>
 
@@ -84,7 +85,30 @@ bool RTPSReader::reserveCache(
         CacheChange_t** change, 
         uint32_t dataCdrSerializedSize)
 {
-    return mp_history->reserve_Cache(change, dataCdrSerializedSize);
+    if (!mp_history->reserve_Cache(change, dataCdrSerializedSize))
+    {
+        if (statistics_)
+        {
+            statistics_add(statistics_->pool_exhausted);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+void RTPSReader::statistics_sample_received(const CacheChange_t* change)
+{
+    if (statistics_)
+    {
+        statistics_add(statistics_->samples_received);
+        statistics_add(statistics_->bytes_received, change->serializedPayload.length);
+
+        int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        int64_t latency_ns = now_ns - change->sourceTimestamp.to_ns();
+        statistics_->reception_latency_us.record(latency_ns > 0 ? static_cast<uint64_t>(latency_ns / 1000) : 0);
+    }
 }
 
 void RTPSReader::releaseCache(CacheChange_t* change)
@@ -215,6 +239,16 @@ bool RTPSReader::wait_for_unread_cache(
     return false;
 }
 
+void RTPSReader::change_read_by_user(CacheChange_t* change)
+{
+    if (!change->isRead && 0 < total_unread_)
+    {
+        --total_unread_;
+    }
+
+    change->isRead = true;
+}
+
 uint64_t RTPSReader::get_unread_count() const
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
@@ -27,11 +27,13 @@
 #include "WriterProxy.h"
 #include <fastrtps/utils/TimeConversion.h>
 #include "../history/HistoryAttributesExtension.hpp"
+#include "../common/StatisticsCounters.h"
 
 #include <fastrtps/rtps/builtin/BuiltinProtocols.h>
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
 #include <fastrtps/rtps/writer/LivelinessManager.h>
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
 
@@ -75,6 +77,7 @@ StatefulReader::StatefulReader(
     , times_(att.times)
     , matched_writers_(att.matched_writers_allocation)
     , matched_writers_pool_(att.matched_writers_allocation)
+    , matched_writers_index_(att.matched_writers_allocation)
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
@@ -108,18 +111,16 @@ bool StatefulReader::matched_writer_add(
         return false;
     }
 
-    for (WriterProxy* it : matched_writers_)
+    WriterProxy** found = matched_writers_index_.find(wdata.guid());
+    if (found != nullptr)
     {
-        if (it->guid() == wdata.guid())
+        logInfo(RTPS_READER, "Attempting to add existing writer, updating information");
+        (*found)->update(wdata);
+        for (const Locator_t& locator : (*found)->remote_locators_shrinked())
         {
-            logInfo(RTPS_READER, "Attempting to add existing writer, updating information");
-            it->update(wdata);
-            for (const Locator_t& locator : it->remote_locators_shrinked())
-            {
-                getRTPSParticipant()->createSenderResources(locator);
-            }
-            return false;
+            getRTPSParticipant()->createSenderResources(locator);
         }
+        return false;
     }
 
     // Get a writer proxy from the inactive pool (or create a new one if necessary and allowed)
@@ -160,6 +161,7 @@ bool StatefulReader::matched_writer_add(
     wp->start(wdata, initial_sequence);
 
     matched_writers_.push_back(wp);
+    matched_writers_index_.insert(wp->guid(), wp);
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
@@ -191,33 +193,31 @@ bool StatefulReader::matched_writer_remove(const GUID_t& writer_guid)
         //Remove cachechanges belonging to the unmatched writer
         mp_history->remove_changes_with_guid(writer_guid);
 
-        for (ResourceLimitedVector<WriterProxy*>::iterator it = matched_writers_.begin(); it != matched_writers_.end(); ++it)
+        WriterProxy** found = matched_writers_index_.find(writer_guid);
+        if (found != nullptr)
         {
-            if ((*it)->guid() == writer_guid)
-            {
-                logInfo(RTPS_READER, "Writer proxy " << writer_guid << " removed from " << m_guid.entityId);
+            logInfo(RTPS_READER, "Writer proxy " << writer_guid << " removed from " << m_guid.entityId);
 
-                if (liveliness_lease_duration_ < c_TimeInfinite)
+            if (liveliness_lease_duration_ < c_TimeInfinite)
+            {
+                auto wlp = this->mp_RTPSParticipant->wlp();
+                if ( wlp != nullptr)
                 {
-                    auto wlp = this->mp_RTPSParticipant->wlp();
-                    if ( wlp != nullptr)
-                    {
-                        wlp->sub_liveliness_manager_->remove_writer(
-                                    writer_guid,
-                                    liveliness_kind_,
-                                    liveliness_lease_duration_);
-                    }
-                    else
-                    {
-                        logError(RTPS_LIVELINESS, "Finite liveliness lease duration but WLP not enabled, cannot remove writer");
-                    }
+                    wlp->sub_liveliness_manager_->remove_writer(
+                                writer_guid,
+                                liveliness_kind_,
+                                liveliness_lease_duration_);
+                }
+                else
+                {
+                    logError(RTPS_LIVELINESS, "Finite liveliness lease duration but WLP not enabled, cannot remove writer");
                 }
-
-                wproxy = *it;
-                matched_writers_.erase(it);
-                remove_persistence_guid(wproxy->guid(), wproxy->attributes().persistence_guid());
-                break;
             }
+
+            wproxy = *found;
+            matched_writers_index_.erase(writer_guid);
+            matched_writers_.erase(std::find(matched_writers_.begin(), matched_writers_.end(), wproxy));
+            remove_persistence_guid(wproxy->guid(), wproxy->attributes().persistence_guid());
         }
 
         if (wproxy != nullptr)
@@ -237,13 +237,8 @@ bool StatefulReader::matched_writer_is_matched(const GUID_t& writer_guid)
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     if (is_alive_)
     {
-        for(WriterProxy* it : matched_writers_)
-        {
-            if(it->guid() == writer_guid && it->is_alive())
-            {
-                return true;
-            }
-        }
+        WriterProxy* const* found = matched_writers_index_.find(writer_guid);
+        return found != nullptr && (*found)->is_alive();
     }
     return false;
 }
@@ -282,13 +277,11 @@ bool StatefulReader::findWriterProxy(
 {
     assert(WP);
 
-    for(WriterProxy* it : matched_writers_)
+    WriterProxy* const* found = matched_writers_index_.find(writerGUID);
+    if (found != nullptr && (*found)->is_alive())
     {
-        if(it->guid() == writerGUID && it->is_alive())
-        {
-            *WP = it;
-            return true;
-        }
+        *WP = *found;
+        return true;
     }
     return false;
 }
@@ -469,6 +462,10 @@ bool StatefulReader::processDataFragMsg(
 
                     releaseCache(change_completed);
                 }
+                else if (statistics_)
+                {
+                    statistics_add(statistics_->fragments_reassembled);
+                }
             }
         }
     }
@@ -494,6 +491,11 @@ bool StatefulReader::processHeartbeatMsg(
 
     if(acceptMsgFrom(writerGUID, &writer) && writer)
     {
+        if (statistics_)
+        {
+            statistics_add(statistics_->heartbeats_received);
+        }
+
         bool assert_liveliness = false;
         if (writer->process_heartbeat(
                 hbCount, firstSN, lastSN, finalFlag, livelinessFlag, disable_positive_acks_, assert_liveliness))
@@ -547,6 +549,11 @@ bool StatefulReader::processGapMsg(
 
     if(acceptMsgFrom(writerGUID, &pWP) && pWP)
     {
+        if (statistics_)
+        {
+            statistics_add(statistics_->gaps_received);
+        }
+
         // TODO (Miguel C): Refactor this inside WriterProxy
         SequenceNumber_t auxSN;
         SequenceNumber_t finalSN = gapList.base() - 1;
@@ -579,13 +586,11 @@ bool StatefulReader::acceptMsgFrom(
 {
     assert(wp != nullptr);
 
-    for(WriterProxy* it : matched_writers_)
+    WriterProxy* const* found = matched_writers_index_.find(writerId);
+    if (found != nullptr && (*found)->is_alive())
     {
-        if(it->guid() == writerId && it->is_alive())
-        {
-            *wp = it;
-            return true;
-        }
+        *wp = *found;
+        return true;
     }
 
     // Check if it's a framework's one. In this case, m_acceptMessagesFromUnkownWriters
@@ -654,6 +659,7 @@ bool StatefulReader::change_received(
                 {
                     if (mp_history->received_change(a_change, 0))
                     {
+                        statistics_sample_received(a_change);
                         update_last_notified(a_change->writerGUID, a_change->sequenceNumber);
                         if (getListener() != nullptr)
                         {
@@ -676,6 +682,7 @@ bool StatefulReader::change_received(
     // inside the call to mp_history->received_change
     if(mp_history->received_change(a_change, unknown_missing_changes_up_to))
     {
+        statistics_sample_received(a_change);
         GUID_t proxGUID = prox->guid();
 
         // If KEEP_LAST and history full, make older changes as lost.
@@ -784,6 +791,36 @@ bool StatefulReader::nextUntakenCache(
     return takeok;
 }
 
+bool StatefulReader::is_change_available(
+        CacheChange_t* change,
+        WriterProxy** wpout,
+        bool& unpaired)
+{
+    unpaired = false;
+    if (!is_alive_)
+    {
+        return false;
+    }
+
+    WriterProxy* wp;
+    if (!matched_writer_lookup(change->writerGUID, &wp))
+    {
+        unpaired = true;
+        return false;
+    }
+
+    if (wp->available_changes_max() >= change->sequenceNumber)
+    {
+        if (wpout != nullptr)
+        {
+            *wpout = wp;
+        }
+        return true;
+    }
+
+    return false;
+}
+
 // TODO Porque elimina aqui y no cuando hay unpairing
 bool StatefulReader::nextUnreadCache(
         CacheChange_t** change,
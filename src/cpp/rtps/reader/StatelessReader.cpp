@@ -27,6 +27,7 @@
 #include <fastrtps/rtps/writer/LivelinessManager.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "FragmentedChangePitStop.h"
+#include "../common/StatisticsCounters.h"
 
 #include <mutex>
 #include <thread>
@@ -51,6 +52,7 @@ StatelessReader::StatelessReader(
         ReaderListener* listen)
     : RTPSReader(pimpl, guid, att, hist, listen)
     , matched_writers_(att.matched_writers_allocation)
+    , matched_writers_index_(att.matched_writers_allocation)
 {
 }
 
@@ -59,13 +61,10 @@ bool StatelessReader::matched_writer_add(
         bool persist /*=true*/ )
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    for (const RemoteWriterInfo_t& writer : matched_writers_)
+    if (matched_writers_index_.find(wdata.guid()) != nullptr)
     {
-        if (writer.guid == wdata.guid())
-        {
-            logWarning(RTPS_READER, "Attempting to add existing writer");
-            return false;
-        }
+        logWarning(RTPS_READER, "Attempting to add existing writer");
+        return false;
     }
 
     RemoteWriterInfo_t info;
@@ -75,6 +74,7 @@ bool StatelessReader::matched_writer_add(
     RemoteWriterInfo_t* att = matched_writers_.emplace_back(info);
     if (att != nullptr)
     {
+        matched_writers_index_.insert(info.guid, matched_writers_.size() - 1);
         if(persist)
         {
             add_persistence_guid(info.guid, info.persistence_guid);
@@ -109,48 +109,50 @@ bool StatelessReader::matched_writer_remove(const GUID_t& writer_guid)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
-    ResourceLimitedVector<RemoteWriterInfo_t>::iterator it;
-    for (it = matched_writers_.begin(); it != matched_writers_.end(); ++it)
+    size_t* found = matched_writers_index_.find(writer_guid);
+    if (found == nullptr)
     {
-        if (it->guid == writer_guid)
-        {
-            logInfo(RTPS_READER, "Writer " << writer_guid << " removed from " << m_guid.entityId);
-
-            if (liveliness_lease_duration_ < c_TimeInfinite)
-            {
-                auto wlp = this->mp_RTPSParticipant->wlp();
-                if ( wlp != nullptr)
-                {
-                    wlp->sub_liveliness_manager_->remove_writer(
-                                writer_guid,
-                                liveliness_kind_,
-                                liveliness_lease_duration_);
-                }
-                else
-                {
-                    logError(RTPS_LIVELINESS,
-                             "Finite liveliness lease duration but WLP not enabled, cannot remove writer");
-                }
-            }
+        return false;
+    }
 
-            remove_persistence_guid(it->guid, it->persistence_guid);
-            matched_writers_.erase(it);
+    logInfo(RTPS_READER, "Writer " << writer_guid << " removed from " << m_guid.entityId);
 
-            return true;
+    if (liveliness_lease_duration_ < c_TimeInfinite)
+    {
+        auto wlp = this->mp_RTPSParticipant->wlp();
+        if ( wlp != nullptr)
+        {
+            wlp->sub_liveliness_manager_->remove_writer(
+                        writer_guid,
+                        liveliness_kind_,
+                        liveliness_lease_duration_);
+        }
+        else
+        {
+            logError(RTPS_LIVELINESS,
+                     "Finite liveliness lease duration but WLP not enabled, cannot remove writer");
         }
     }
 
-    return false;
+    size_t pos = *found;
+    remove_persistence_guid(matched_writers_[pos].guid, matched_writers_[pos].persistence_guid);
+    matched_writers_index_.erase(writer_guid);
+
+    // The last writer takes the place of the removed one, so only its position changes.
+    if (pos != matched_writers_.size() - 1)
+    {
+        matched_writers_[pos] = matched_writers_.back();
+        *matched_writers_index_.find(matched_writers_[pos].guid) = pos;
+    }
+    matched_writers_.pop_back();
+
+    return true;
 }
 
 bool StatelessReader::matched_writer_is_matched(const GUID_t& writer_guid)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    return std::any_of(matched_writers_.begin(), matched_writers_.end(), 
-        [writer_guid](const RemoteWriterInfo_t& item)
-        {
-            return item.guid == writer_guid;
-        });
+    return matched_writers_index_.find(writer_guid) != nullptr;
 }
 
 bool StatelessReader::change_received(CacheChange_t* change)
@@ -161,6 +163,7 @@ bool StatelessReader::change_received(CacheChange_t* change)
     {
         if(mp_history->received_change(change, 0))
         {
+            statistics_sample_received(change);
             update_last_notified(change->writerGUID, change->sequenceNumber);
             ++total_unread_;
 
@@ -202,6 +205,19 @@ bool StatelessReader::nextUntakenCache(
 }
 
 
+bool StatelessReader::is_change_available(
+        CacheChange_t* /*change*/,
+        WriterProxy** wpout,
+        bool& unpaired)
+{
+    unpaired = false;
+    if (wpout != nullptr)
+    {
+        *wpout = nullptr;
+    }
+    return true;
+}
+
 bool StatelessReader::nextUnreadCache(
         CacheChange_t** change,
         WriterProxy** /*wpout*/)
@@ -419,6 +435,10 @@ bool StatelessReader::processDataFragMsg(
                     // Release CacheChange_t.
                     releaseCache(change_completed);
                 }
+                else if (statistics_)
+                {
+                    statistics_add(statistics_->fragments_reassembled);
+                }
             }
         }
     }
@@ -456,11 +476,7 @@ bool StatelessReader::acceptMsgFrom(const GUID_t& writerId)
         return true;
     }
 
-    return std::any_of(matched_writers_.begin(), matched_writers_.end(), 
-        [& writerId](const RemoteWriterInfo_t& writer)
-        {
-            return writer.guid == writerId;
-        });
+    return matched_writers_index_.find(writerId) != nullptr;
 }
 
 bool StatelessReader::thereIsUpperRecordOf(
@@ -472,12 +488,6 @@ bool StatelessReader::thereIsUpperRecordOf(
 
 bool StatelessReader::writer_has_manual_liveliness(const GUID_t& guid)
 {
-    for (const RemoteWriterInfo_t& writer : matched_writers_)
-    {
-        if (writer.guid == guid)
-        {
-            return writer.has_manual_topic_liveliness;
-        }
-    }
-    return false;
+    size_t* found = matched_writers_index_.find(guid);
+    return found != nullptr && matched_writers_[*found].has_manual_topic_liveliness;
 }
@@ -15,6 +15,8 @@
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 
+#include "../../utils/Threading.h"
+
 #include <mutex>
 #include <algorithm>
 #include <cassert>
@@ -107,8 +109,19 @@ void AsyncWriterThread::wake_up(
     }
 }
 
+void AsyncWriterThread::thread_settings(
+        const ThreadSettings& settings,
+        const std::string& name)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(condition_variable_mutex_);
+    thread_settings_ = settings;
+    thread_name_ = name;
+}
+
 void AsyncWriterThread::run()
 {
+    eprosima::fastrtps::set_current_thread_settings(thread_name_, thread_settings_);
+
     std::unique_lock<RecursiveTimedMutex> cond_guard(condition_variable_mutex_);
     while(running_)
     {
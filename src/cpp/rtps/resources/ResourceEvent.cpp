@@ -19,6 +19,7 @@
 
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include "TimedEventImpl.h"
+#include "../../utils/Threading.h"
 
 #include <asio.hpp>
 #include <thread>
@@ -193,9 +194,15 @@ void ResourceEvent::run_io_service()
     }
 }
 
-void ResourceEvent::init_thread()
+void ResourceEvent::init_thread(
+        const ThreadSettings& settings,
+        const std::string& name)
 {
-    thread_ = std::thread(&ResourceEvent::run_io_service, this);
+    thread_ = std::thread([this, settings, name]()
+            {
+                set_current_thread_settings(name, settings);
+                run_io_service();
+            });
     std::promise<void> ready;
     std::future<void> ready_fut = ready.get_future();
     io_service_.post([&ready]()
@@ -0,0 +1,273 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file HandshakeWorkerPool.h
+ */
+#ifndef _RTPS_SECURITY_HANDSHAKEWORKERPOOL_H_
+#define _RTPS_SECURITY_HANDSHAKEWORKERPOOL_H_
+
+#include <fastrtps/rtps/common/Guid.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/**
+ * Bounded pool of threads used by the SecurityManager to run the expensive steps of the
+ * authentication handshake (signatures, certificate validation, key agreement) outside
+ * the builtin reader listener threads.
+ */
+class HandshakeWorkerPool
+{
+    public:
+
+        //! A step of the handshake with a remote participant.
+        struct Job
+        {
+            //! Remote participant the job belongs to.
+            GUID_t remote_participant_key;
+
+            //! Called on a worker thread to process the job.
+            std::function<void()> process;
+
+            //! Called instead of process when the job is discarded before being processed.
+            std::function<void()> discard;
+        };
+
+        HandshakeWorkerPool()
+            : running_(false)
+            , max_pending_(0)
+        {
+        }
+
+        ~HandshakeWorkerPool()
+        {
+            stop();
+        }
+
+        /**
+         * Start the worker threads.
+         * @param num_threads Number of worker threads. Zero keeps the pool disabled.
+         * @param max_pending Maximum number of jobs waiting to be processed.
+         */
+        void start(
+                uint32_t num_threads,
+                uint32_t max_pending)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+
+            if (running_ || num_threads == 0)
+            {
+                return;
+            }
+
+            running_ = true;
+            max_pending_ = max_pending;
+            for (uint32_t i = 0; i < num_threads; ++i)
+            {
+                threads_.emplace_back(&HandshakeWorkerPool::run, this);
+            }
+        }
+
+        /**
+         * Stop the worker threads. Queued jobs are discarded, and jobs being processed are waited for.
+         */
+        void stop()
+        {
+            std::deque<Job> discarded;
+
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                if (!running_)
+                {
+                    return;
+                }
+                running_ = false;
+                discarded.swap(jobs_);
+            }
+
+            cv_.notify_all();
+
+            for (std::thread& thread : threads_)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+            threads_.clear();
+
+            for (Job& job : discarded)
+            {
+                job.discard();
+            }
+        }
+
+        /**
+         * Queue a job.
+         * @param job Job to be processed on one of the worker threads.
+         * @return false when the pool is not running or the queue is full. In that case the
+         * job is given back untouched and the caller is responsible for processing it.
+         */
+        bool post(
+                Job& job)
+        {
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                if (!running_ || (max_pending_ > 0 && jobs_.size() >= max_pending_))
+                {
+                    return false;
+                }
+                jobs_.push_back(std::move(job));
+            }
+
+            cv_.notify_one();
+            return true;
+        }
+
+        /**
+         * Discard the queued jobs of a remote participant, and wait for its jobs being processed on other threads.
+         * @param remote_participant_key Remote participant whose jobs are discarded.
+         */
+        void discard(
+                const GUID_t& remote_participant_key)
+        {
+            std::vector<Job> discarded;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (auto it = jobs_.begin(); it != jobs_.end();)
+                {
+                    if (it->remote_participant_key == remote_participant_key)
+                    {
+                        discarded.push_back(std::move(*it));
+                        it = jobs_.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+
+                // A job discarding its own participant cannot wait for itself.
+                std::thread::id this_thread = std::this_thread::get_id();
+                done_cv_.wait(lock, [&]()
+                        {
+                            for (const InProcess& in_process : in_process_)
+                            {
+                                if (in_process.remote_participant_key == remote_participant_key &&
+                                        in_process.thread != this_thread)
+                                {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
+            }
+
+            for (Job& job : discarded)
+            {
+                job.discard();
+            }
+        }
+
+        bool is_running()
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            return running_;
+        }
+
+    private:
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            while (true)
+            {
+                cv_.wait(lock, [this]()
+                        {
+                            return !running_ || !jobs_.empty();
+                        });
+
+                if (!running_)
+                {
+                    // Queued jobs are discarded by stop.
+                    break;
+                }
+
+                Job job = std::move(jobs_.front());
+                jobs_.pop_front();
+                in_process_.push_back({job.remote_participant_key, std::this_thread::get_id()});
+
+                lock.unlock();
+                job.process();
+                lock.lock();
+
+                for (auto it = in_process_.begin(); it != in_process_.end(); ++it)
+                {
+                    if (it->thread == std::this_thread::get_id())
+                    {
+                        in_process_.erase(it);
+                        break;
+                    }
+                }
+                done_cv_.notify_all();
+            }
+        }
+
+        //! A job being processed on a worker thread.
+        struct InProcess
+        {
+            GUID_t remote_participant_key;
+            std::thread::id thread;
+        };
+
+        HandshakeWorkerPool(const HandshakeWorkerPool&) = delete;
+
+        HandshakeWorkerPool& operator=(const HandshakeWorkerPool&) = delete;
+
+        std::mutex mutex_;
+
+        std::condition_variable cv_;
+
+        //! Signaled when a worker thread finishes processing a job.
+        std::condition_variable done_cv_;
+
+        bool running_;
+
+        size_t max_pending_;
+
+        std::deque<Job> jobs_;
+
+        std::vector<InProcess> in_process_;
+
+        std::vector<std::thread> threads_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // _RTPS_SECURITY_HANDSHAKEWORKERPOOL_H_
@@ -259,6 +259,7 @@ bool SecurityManager::init(ParticipantSecurityAttributes& attributes, const Prop
 				// Create RTPS entities
                 if(create_entities())
                 {
+                    init_handshake_pool(participant_properties);
                     logInfo(SECURITY, "Initialized security manager for participant " << participant_->getGuid());
                     return true;
                 }
@@ -304,8 +305,48 @@ bool SecurityManager::init(ParticipantSecurityAttributes& attributes, const Prop
     return true;
 }
 
+void SecurityManager::init_handshake_pool(const PropertyPolicy& participant_properties)
+{
+    uint32_t num_threads = 0;
+    uint32_t max_pending = 0;
+
+    for (const Property& property : participant_properties.properties())
+    {
+        try
+        {
+            if (property.name().compare("dds.sec.auth.handshake_threads") == 0)
+            {
+                num_threads = static_cast<uint32_t>(std::stoul(property.value()));
+            }
+            else if (property.name().compare("dds.sec.auth.handshake_max_pending") == 0)
+            {
+                max_pending = static_cast<uint32_t>(std::stoul(property.value()));
+            }
+        }
+        catch (std::logic_error&)
+        {
+            logWarning(SECURITY, "Wrong value for property " << property.name());
+        }
+    }
+
+    if (num_threads > 0)
+    {
+        logInfo(SECURITY, "Using " << num_threads << " threads for authentication handshakes");
+        handshake_pool_.start(num_threads, max_pending);
+    }
+}
+
+void SecurityManager::stop_handshake_pool()
+{
+    // Discarded handshake steps give their authentication info back to the discovered participants.
+    handshake_pool_.stop();
+}
+
 void SecurityManager::destroy()
 {
+    // Handshake steps hold authentication info, so they are finished or discarded before cleaning up.
+    stop_handshake_pool();
+
     if(authentication_plugin_ != nullptr)
     {
         mutex_.lock();
@@ -563,6 +604,12 @@ bool SecurityManager::discovered_participant(const ParticipantProxyData& partici
     if(remote_participant_info->auth_status_ == AUTHENTICATION_REQUEST_NOT_SEND)
     {
         // Maybe send request.
+        if(post_process_handshake(participant_data.m_guid, remote_participant_info,
+                    MessageIdentity(), HandshakeMessageToken()))
+        {
+            return true;
+        }
+
         returnedValue = on_process_handshake(participant_data, remote_participant_info,
                 MessageIdentity(), HandshakeMessageToken());
     }
@@ -577,6 +624,10 @@ void SecurityManager::remove_participant(const ParticipantProxyData& participant
     // Unmatch from builtin endpoints.
     unmatch_builtin_endpoints(participant_data);
 
+    // Queued handshake steps give the authentication info back, and steps being processed are waited for,
+    // so it is released below.
+    handshake_pool_.discard(participant_data.m_guid);
+
     std::unique_lock<std::mutex> lock(mutex_);
     auto dp_it = discovered_participants_.find(participant_data.m_guid);
 
@@ -831,6 +882,78 @@ bool SecurityManager::on_process_handshake(const ParticipantProxyData& participa
     return returnedValue;
 }
 
+bool SecurityManager::post_process_handshake(const GUID_t& remote_participant_key,
+        DiscoveredParticipantInfo::AuthUniquePtr& remote_participant_info,
+        MessageIdentity&& message_identity,
+        HandshakeMessageToken&& message)
+{
+    struct HandshakeStep
+    {
+        GUID_t remote_participant_key;
+        DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
+        MessageIdentity message_identity;
+        HandshakeMessageToken message;
+    };
+
+    if(!handshake_pool_.is_running())
+    {
+        return false;
+    }
+
+    // The step keeps the authentication info while it is queued, so messages received meanwhile for the same
+    // remote participant are discarded as if they were being processed in another thread.
+    std::shared_ptr<HandshakeStep> step = std::make_shared<HandshakeStep>();
+    step->remote_participant_key = remote_participant_key;
+    step->remote_participant_info = std::move(remote_participant_info);
+    step->message_identity = std::move(message_identity);
+    step->message = std::move(message);
+
+    HandshakeWorkerPool::Job job;
+    job.remote_participant_key = remote_participant_key;
+    job.process = [this, step]()
+            {
+                // The participant data is looked up again, as the step may have been queued for a while.
+                // It is copied, as the entry may be updated by discovery while the step is processed.
+                std::unique_ptr<ParticipantProxyData> participant_data;
+                {
+                    std::lock_guard<std::mutex> guard(mutex_);
+                    auto dp_it = discovered_participants_.find(step->remote_participant_key);
+                    if(dp_it != discovered_participants_.end())
+                    {
+                        participant_data.reset(new ParticipantProxyData(dp_it->second.participant_data()));
+                    }
+                }
+
+                if(participant_data == nullptr)
+                {
+                    // Removed while the step was starting. The authentication info belonged to the removed entry.
+                    logInfo(SECURITY, "Dropping handshake step of removed participant " << step->remote_participant_key);
+                    return;
+                }
+
+                on_process_handshake(*participant_data, step->remote_participant_info,
+                        std::move(step->message_identity), std::move(step->message));
+
+                restore_discovered_participant_info(step->remote_participant_key, step->remote_participant_info);
+            };
+    job.discard = [this, step]()
+            {
+                restore_discovered_participant_info(step->remote_participant_key, step->remote_participant_info);
+            };
+
+    bool posted = handshake_pool_.post(job);
+
+    if(!posted)
+    {
+        // Give everything back so the caller processes the handshake inline.
+        remote_participant_info = std::move(step->remote_participant_info);
+        message_identity = std::move(step->message_identity);
+        message = std::move(step->message);
+    }
+
+    return posted;
+}
+
 bool SecurityManager::create_entities()
 {
     if(create_participant_stateless_message_entities())
@@ -1341,10 +1464,14 @@ void SecurityManager::process_participant_stateless_message(const CacheChange_t*
                 return;
             }
 
-            on_process_handshake(*participant_data, remote_participant_info,
-                    std::move(message.message_identity()), std::move(message.message_data().at(0)));
+            if(!post_process_handshake(remote_participant_key, remote_participant_info,
+                        std::move(message.message_identity()), std::move(message.message_data().at(0))))
+            {
+                on_process_handshake(*participant_data, remote_participant_info,
+                        std::move(message.message_identity()), std::move(message.message_data().at(0)));
 
-            restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+            }
         }
     }
     else
@@ -19,6 +19,7 @@
 #define _RTPS_SECURITY_SECURITYMANAGER_H_
 
 #include <rtps/security/SecurityPluginFactory.h>
+#include <rtps/security/HandshakeWorkerPool.h>
 
 #include <fastrtps/rtps/security/authentication/Handshake.h>
 #include <fastrtps/rtps/security/common/ParticipantGenericMessage.h>
@@ -69,6 +70,12 @@ class SecurityManager
 
         void destroy();
 
+        /**
+         * Stop the handshake worker pool, discarding the queued handshake steps.
+         * Should be called before the builtin protocols are destroyed, as the steps use them.
+         */
+        void stop_handshake_pool();
+
         bool discovered_participant(const ParticipantProxyData& participant_data);
 
         void remove_participant(const ParticipantProxyData& participant_data);
@@ -332,6 +339,8 @@ class SecurityManager
         bool restore_discovered_participant_info(const GUID_t& remote_participant_key,
                 DiscoveredParticipantInfo::AuthUniquePtr& auth_ptr);
 
+        void init_handshake_pool(const PropertyPolicy& participant_properties);
+
         bool create_entities();
         void delete_entities();
         bool create_participant_stateless_message_entities();
@@ -375,6 +384,17 @@ class SecurityManager
                 MessageIdentity&& message_identity,
                 HandshakeMessageToken&& message);
 
+        /**
+         * Try to run on_process_handshake on the handshake worker pool.
+         * On success, the pool owns the authentication info until the handshake step finishes or is discarded.
+         * The data of the remote participant is looked up again when the step is processed.
+         * @return false if the pool is disabled or full. remote_participant_info is left untouched in that case.
+         */
+        bool post_process_handshake(const GUID_t& remote_participant_key,
+                DiscoveredParticipantInfo::AuthUniquePtr& remote_participant_info,
+                MessageIdentity&& message_identity,
+                HandshakeMessageToken&& message);
+
         ParticipantGenericMessage generate_authentication_message(const MessageIdentity& related_message_identity,
                 const GUID_t& destination_participant_key,
                 HandshakeMessageToken& handshake_message);
@@ -427,6 +447,8 @@ class SecurityManager
 
         std::mutex mutex_;
 
+        HandshakeWorkerPool handshake_pool_;
+
         std::atomic<int64_t> auth_last_sequence_number_;
 
         std::atomic<int64_t> crypto_last_sequence_number_;
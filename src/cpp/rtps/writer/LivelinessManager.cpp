@@ -19,7 +19,8 @@ LivelinessManager::LivelinessManager(
     , manage_automatic_(manage_automatic)
     , writers_()
     , mutex_()
-    , timer_owner_(nullptr)
+    , timer_deadline_()
+    , timer_armed_(false)
     , timer_(
             service,
             [this](TimedEvent::EventCode code) -> bool
@@ -38,7 +39,7 @@ LivelinessManager::LivelinessManager(
 LivelinessManager::~LivelinessManager()
 {
     std::unique_lock<std::mutex> lock(mutex_);
-    timer_owner_ = nullptr;
+    timer_armed_ = false;
     timer_.cancel_timer();
 }
 
@@ -106,21 +107,8 @@ bool LivelinessManager::remove_writer(
                     }
                 }
 
-                if (timer_owner_ != nullptr && timer_owner_->guid == guid)
-                {
-                    timer_owner_ = nullptr;
-                    if (!calculate_next())
-                    {
-                        timer_.cancel_timer();
-                        return true;
-                    }
-
-                    // Some times the interval could be negative if a writer expired during the call to this function
-                    // Once in this situation there is not much we can do but let asio timers expire inmediately
-                    auto interval = timer_owner_->time - steady_clock::now();
-                    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-                    timer_.restart_timer();
-                }
+                // The timer is not rescheduled. If the writer was the next one to expire, the timer will find no
+                // expired writer and move on to the next deadline.
                 return true;
             }
         }
@@ -146,8 +134,6 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    timer_.cancel_timer();
-
     if (wit->kind == MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
         wit->kind == AUTOMATIC_LIVELINESS_QOS)
     {
@@ -164,19 +150,6 @@ bool LivelinessManager::assert_liveliness(
         assert_writer_liveliness(*wit);
     }
 
-    // Updates the timer owner
-    if (!calculate_next())
-    {
-        logError(RTPS_WRITER, "Error when restarting liveliness timer");
-        return false;
-    }
-
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
-
     return true;
 }
 
@@ -195,8 +168,6 @@ bool LivelinessManager::assert_liveliness(LivelinessQosPolicyKind kind)
         return true;
     }
 
-    timer_.cancel_timer();
-
     for (LivelinessData& writer: writers_)
     {
         if (writer.kind == kind)
@@ -205,76 +176,66 @@ bool LivelinessManager::assert_liveliness(LivelinessQosPolicyKind kind)
         }
     }
 
-    // Updates the timer owner
-    if (!calculate_next())
-    {
-        logError(RTPS_WRITER, "Error when restarting liveliness timer: " << writers_.size() << " writers, liveliness " << kind);
-        return false;
-    }
+    return true;
+}
+
+void LivelinessManager::schedule_timer(const steady_clock::time_point& deadline)
+{
+    timer_.cancel_timer();
+    timer_deadline_ = deadline;
+    timer_armed_ = true;
 
     // Some times the interval could be negative if a writer expired during the call to this function
     // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+    auto interval = duration_cast<microseconds>(deadline - steady_clock::now());
+    timer_.update_interval_millisec((double)interval.count() / 1000.0);
     timer_.restart_timer();
-
-    return true;
 }
 
-bool LivelinessManager::calculate_next()
+bool LivelinessManager::timer_expired()
 {
+    std::unique_lock<std::mutex> lock(mutex_);
 
-    timer_owner_ = nullptr;
-
-    steady_clock::time_point min_time = steady_clock::now() + nanoseconds(c_TimeInfinite.to_ns());
-
-    bool any_alive = false;
+    steady_clock::time_point now = steady_clock::now();
+    steady_clock::time_point next = steady_clock::time_point::max();
 
-    for (LivelinessDataIterator it=writers_.begin(); it!=writers_.end(); ++it)
+    // Leases are renewed without touching the timer, so only the writers whose lease has really run out are
+    // considered lost. The rest give the next deadline.
+    for (LivelinessData& writer : writers_)
     {
-        if (it->status == LivelinessData::WriterStatus::ALIVE)
+        if (writer.status != LivelinessData::WriterStatus::ALIVE)
+        {
+            continue;
+        }
+
+        if (writer.time <= now)
         {
-            if (it->time < min_time)
+            if (callback_ != nullptr)
             {
-                min_time = it->time;
-                timer_owner_ = &*it;
+                callback_(writer.guid,
+                          writer.kind,
+                          writer.lease_duration,
+                          -1,
+                          1);
             }
-            any_alive = true;
+            writer.status = LivelinessData::WriterStatus::NOT_ALIVE;
+        }
+        else if (writer.time < next)
+        {
+            next = writer.time;
         }
     }
-    return any_alive;
-}
-
-bool LivelinessManager::timer_expired()
-{
-    std::unique_lock<std::mutex> lock(mutex_);
 
-    if (timer_owner_ == nullptr)
+    if (next == steady_clock::time_point::max())
     {
-        logError(RTPS_WRITER, "Liveliness timer expired but there is no writer");
+        timer_armed_ = false;
         return false;
     }
 
-    if (callback_ != nullptr)
-    {
-        callback_(timer_owner_->guid,
-                  timer_owner_->kind,
-                  timer_owner_->lease_duration,
-                  -1,
-                  1);
-    }
-    timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
-
-    if (calculate_next())
-    {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-        return true;
-    }
-    
-    return false;
+    timer_deadline_ = next;
+    auto interval = duration_cast<microseconds>(next - now);
+    timer_.update_interval_millisec((double)interval.count() / 1000.0);
+    return true;
 }
 
 bool LivelinessManager::find_writer(
@@ -300,9 +261,11 @@ bool LivelinessManager::is_any_alive(LivelinessQosPolicyKind kind)
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
+    steady_clock::time_point now = steady_clock::now();
+
     for (const auto& writer : writers_)
     {
-        if (writer.kind == kind && writer.status == LivelinessData::WriterStatus::ALIVE)
+        if (writer.kind == kind && writer.status == LivelinessData::WriterStatus::ALIVE && writer.time > now)
         {
             return true;
         }
@@ -334,6 +297,13 @@ void LivelinessManager::assert_writer_liveliness(LivelinessData& writer)
 
     writer.status = LivelinessData::WriterStatus::ALIVE;
     writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+
+    // Renewing the lease of an alive writer never brings the next deadline forward, so the timer is only touched
+    // when a writer becomes alive before the current deadline.
+    if (writer.lease_duration < c_TimeInfinite && (!timer_armed_ || writer.time < timer_deadline_))
+    {
+        schedule_timer(writer.time);
+    }
 }
 
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
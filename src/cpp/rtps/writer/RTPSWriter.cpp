@@ -20,9 +20,12 @@
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <fastrtps/rtps/resources/TimedEvent.h>
 #include <fastrtps/log/Log.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../common/StatisticsCounters.h"
 
 #include <mutex>
 
@@ -56,6 +59,7 @@ RTPSWriter::RTPSWriter(
     , mp_listener(listen)
     , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
     , m_separateSendingEnabled(false)
+    , reader_data_filter_(nullptr)
     , locator_selector_(att.matched_readers_allocation)
     , all_remote_readers_(att.matched_readers_allocation)
     , all_remote_participants_(att.matched_readers_allocation)
@@ -65,10 +69,35 @@ RTPSWriter::RTPSWriter(
     , liveliness_kind_(att.liveliness_kind)
     , liveliness_lease_duration_(att.liveliness_lease_duration)
     , liveliness_announcement_period_(att.liveliness_announcement_period)
+    , max_instances_(att.max_instances)
+    , batching_(att.batching)
+    , batch_max_data_bytes_(att.batch_max_data_bytes)
+    , batch_max_samples_(att.batch_max_samples)
+    , batch_data_bytes_(0)
+    , batch_samples_(0)
+    , batch_flush_event_(nullptr)
     , next_{nullptr}
 {
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
+
+    if (batching_ && att.batch_max_flush_delay != c_TimeInfinite)
+    {
+        batch_flush_event_ = new TimedEvent(impl->getEventResource(), [&](TimedEvent::EventCode code) -> bool
+                {
+                    if (TimedEvent::EVENT_SUCCESS == code)
+                    {
+                        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+                        if (batch_samples_ > 0)
+                        {
+                            flush_batch_nts();
+                        }
+                    }
+
+                    return false;
+                },
+                att.batch_max_flush_delay.to_ns() * 1e-6); // in milliseconds
+    }
     logInfo(RTPS_WRITER, "RTPSWriter created");
 }
 
@@ -93,6 +122,10 @@ CacheChange_t* RTPSWriter::new_change(
     if (!mp_history->reserve_Cache(&ch, dataCdrSerializedSize))
     {
         logWarning(RTPS_WRITER, "Problem reserving Cache from the History");
+        if (statistics_)
+        {
+            statistics_add(statistics_->pool_exhausted);
+        }
         return nullptr;
     }
 
@@ -216,6 +249,77 @@ void RTPSWriter::compute_selected_guids()
     }
 }
 
+bool RTPSWriter::add_data_to_group(
+        RTPSMessageGroup& group,
+        const CacheChange_t& change,
+        bool expects_inline_qos)
+{
+    uint32_t fragment_count = change.getFragmentCount();
+    if (fragment_count == 0)
+    {
+        return group.add_data(change, expects_inline_qos);
+    }
+
+    for (uint32_t fragment_number = 1; fragment_number <= fragment_count; ++fragment_number)
+    {
+        if (!group.add_data_frag(change, fragment_number, expects_inline_qos))
+        {
+            logError(RTPS_WRITER, "Error sending fragment (" << change.sequenceNumber << ", " << fragment_number << ")");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void RTPSWriter::flush()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (batching_ && batch_samples_ > 0)
+    {
+        flush_batch_nts();
+    }
+}
+
+void RTPSWriter::add_to_batch_nts(
+        const CacheChange_t& change)
+{
+    batch_data_bytes_ += change.serializedPayload.length;
+    ++batch_samples_;
+
+    // Fragmented changes do not fit in a message with other changes.
+    if (change.getFragmentCount() > 0 ||
+            (batch_max_data_bytes_ > 0 && batch_data_bytes_ >= batch_max_data_bytes_) ||
+            (batch_max_samples_ > 0 && batch_samples_ >= batch_max_samples_))
+    {
+        flush_batch_nts();
+    }
+    else if (batch_samples_ == 1 && batch_flush_event_ != nullptr)
+    {
+        batch_flush_event_->restart_timer();
+    }
+}
+
+void RTPSWriter::flush_batch_nts()
+{
+    batch_data_bytes_ = 0;
+    batch_samples_ = 0;
+
+    if (batch_flush_event_ != nullptr)
+    {
+        batch_flush_event_->cancel_timer();
+    }
+
+    if (is_async_)
+    {
+        mp_RTPSParticipant->async_thread().wake_up(this);
+    }
+    else
+    {
+        send_any_unsent_changes();
+    }
+}
+
 void RTPSWriter::update_cached_info_nts()
 {
     locator_selector_.reset(true);
@@ -232,7 +336,8 @@ bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
             +20 /*SecureDataHeader*/ + 4 + ((2 * 16) /*EVP_MAX_IV_LENGTH max block size*/ - 1) /* SecureDataBodey*/
             + 16 + 4 /*SecureDataTag*/ &&
             (mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE ||
-                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE))
+                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
+                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::SLAB_MEMORY_MODE))
         {
             encrypt_payload_.data = (octet*)realloc(encrypt_payload_.data, change->serializedPayload.length +
                     // In future v2 changepool is in writer, and writer set this value to cachechagepool.
@@ -251,6 +356,26 @@ bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
             return false;
         }
 
+        if (mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::SLAB_MEMORY_MODE)
+        {
+            // Slab payloads belong to the pool, so the encrypted payload is copied instead of swapping buffers.
+            if (!mp_history->m_changePool.reserve_payload(change, encrypt_payload_.length))
+            {
+                logError(RTPS_WRITER, "Error reserving payload for encoded change " << change->sequenceNumber);
+                return false;
+            }
+
+            memcpy(change->serializedPayload.data, encrypt_payload_.data, encrypt_payload_.length);
+            change->serializedPayload.length = encrypt_payload_.length;
+            change->serializedPayload.pos = encrypt_payload_.pos;
+
+            encrypt_payload_.length = 0;
+            encrypt_payload_.pos = 0;
+
+            change->setFragmentSize(change->getFragmentSize());
+            return true;
+        }
+
         octet* data = change->serializedPayload.data;
         uint32_t max_size = change->serializedPayload.max_size;
 
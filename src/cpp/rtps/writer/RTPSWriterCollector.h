@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/common/FragmentNumber.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
 
@@ -30,6 +31,14 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/**
+ * Collects the changes (or fragments of changes) that should be sent, together with the readers requesting them,
+ * sorted by sequence number and fragment number.
+ *
+ * Items are kept on a vector of slots which is never shrunk. Removed items keep their slot, including the capacity of
+ * its list of readers, so once the collector has held its maximum number of items it can be filled again without
+ * allocating memory.
+ */
 template<class T>
 class RTPSWriterCollector
 {
@@ -37,6 +46,12 @@ class RTPSWriterCollector
 
         struct Item
         {
+            Item()
+                : fragmentNumber(0)
+                , cacheChange(nullptr)
+            {
+            }
+
             Item(SequenceNumber_t seqNum, FragmentNumber_t fragNum,
                     CacheChange_t* c) : sequenceNumber(seqNum),
                                         fragmentNumber(fragNum),
@@ -55,24 +70,15 @@ class RTPSWriterCollector
 
             CacheChange_t* cacheChange;
 
-            mutable std::vector<T> remoteReaders;
+            std::vector<T> remoteReaders;
         };
 
-        struct ItemCmp
-        {
-            bool operator()(const Item& a, const Item& b) const
-            {
-                if(a.sequenceNumber < b.sequenceNumber)
-                    return true;
-                else if(a.sequenceNumber == b.sequenceNumber)
-                    if(a.fragmentNumber < b.fragmentNumber)
-                        return true;
+        typedef typename std::vector<Item>::iterator iterator;
 
-                return false;
-            }
-        };
-
-        typedef std::set<Item, ItemCmp> ItemSet;
+        RTPSWriterCollector()
+            : size_(0)
+        {
+        }
 
         void add_change(CacheChange_t* change, const T& remoteReader, const FragmentNumberSet_t optionalFragmentsNotSent)
         {
@@ -81,48 +87,109 @@ class RTPSWriterCollector
                 optionalFragmentsNotSent.for_each([this, change, remoteReader](FragmentNumber_t sn)
                 {
                     assert(sn <= change->getDataFragments()->size());
-                    auto it = mItems_.emplace(change->sequenceNumber, sn, change);
-                    it.first->remoteReaders.push_back(remoteReader);
+                    add_item(change, sn, remoteReader);
                 });
             }
             else
             {
-                auto it = mItems_.emplace(change->sequenceNumber, 0, change);
-                it.first->remoteReaders.push_back(remoteReader);
+                add_item(change, 0, remoteReader);
             }
         }
 
-        bool empty()
+        bool empty() const
         {
-            return mItems_.empty();
+            return size_ == 0;
         }
 
-        size_t size()
+        size_t size() const
         {
-            return mItems_.size();
+            return size_;
         }
 
+        /**
+         * Remove the first item.
+         * @return Copy of the removed item.
+         */
         Item pop()
         {
-            auto it = mItems_.begin();
-            Item ret = *it;
-            mItems_.erase(it);
+            assert(size_ > 0);
+            Item ret = items_.front();
+            erase(begin(), begin() + 1);
             return ret;
         }
 
+        //! Remove every item, keeping the allocated slots.
         void clear()
         {
-            return mItems_.clear();
+            size_ = 0;
+        }
+
+        iterator begin()
+        {
+            return items_.begin();
         }
 
-        ItemSet& items()
+        iterator end()
         {
-            return mItems_;
+            return items_.begin() + size_;
+        }
+
+        /**
+         * Remove a range of items, keeping their slots for later use.
+         * @param first First item to remove.
+         * @param last Item following the last one to remove.
+         */
+        void erase(
+                iterator first,
+                iterator last)
+        {
+            std::rotate(first, last, end());
+            size_ -= static_cast<size_t>(last - first);
         }
 
     private:
 
-        ItemSet mItems_;
+        static bool item_less(
+                const Item& item,
+                const std::pair<SequenceNumber_t, FragmentNumber_t>& key)
+        {
+            return item.sequenceNumber < key.first ||
+                   (item.sequenceNumber == key.first && item.fragmentNumber < key.second);
+        }
+
+        void add_item(
+                CacheChange_t* change,
+                FragmentNumber_t fragment,
+                const T& remoteReader)
+        {
+            std::pair<SequenceNumber_t, FragmentNumber_t> key(change->sequenceNumber, fragment);
+            iterator it = std::lower_bound(begin(), end(), key, item_less);
+
+            if (it == end() || it->sequenceNumber != key.first || it->fragmentNumber != key.second)
+            {
+                // Take the first free slot and move it to its sorted position.
+                if (size_ == items_.size())
+                {
+                    size_t position = static_cast<size_t>(it - begin());
+                    items_.emplace_back();
+                    it = begin() + position;
+                }
+                std::rotate(it, end(), end() + 1);
+                ++size_;
+
+                it->sequenceNumber = key.first;
+                it->fragmentNumber = key.second;
+                it->cacheChange = change;
+                it->remoteReaders.clear();
+            }
+
+            it->remoteReaders.push_back(remoteReader);
+        }
+
+        //! Slots of the items. Only the first size_ ones are in use.
+        std::vector<Item> items_;
+
+        size_t size_;
 };
 
 } // namespace rtps
@@ -101,6 +101,7 @@ bool ReaderLocator::stop(const GUID_t& remote_guid)
         guid_as_vector_.at(0) = c_Guid_Unknown;
         guid_prefix_as_vector_.at(0) = c_GuidPrefix_Unknown;
         expects_inline_qos_ = false;
+        time_based_filter_.minimum_separation(c_TimeZero);
         return true;
     }
 
@@ -50,6 +50,11 @@ ReaderProxy::ReaderProxy(
     , timers_enabled_(false)
     , last_acknack_count_(0)
     , last_nackfrag_count_(0)
+    , heartbeat_pending_(false)
+    , heartbeat_resent_(false)
+    , heartbeat_count_(0)
+    , srtt_(0)
+    , rttvar_(0)
 {
     nack_supression_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
             [&](TimedEvent::EventCode code) -> bool
@@ -85,6 +90,9 @@ void ReaderProxy::start(const ReaderProxyData& reader_attributes)
 
     is_active_ = true;
     reader_attributes_ = reader_attributes;
+    locator_info_.time_based_filter().max_instances(writer_->max_instances());
+    locator_info_.time_based_filter().minimum_separation(
+        reader_attributes.m_qos.m_timeBasedFilter.minimum_separation);
 
     timers_enabled_.store(reader_attributes_.m_qos.m_reliability.kind == RELIABLE_RELIABILITY_QOS);
 
@@ -102,6 +110,8 @@ bool ReaderProxy::update(const ReaderProxyData& reader_attributes)
     }
 
     reader_attributes_ = reader_attributes;
+    locator_info_.time_based_filter().minimum_separation(
+        reader_attributes.m_qos.m_timeBasedFilter.minimum_separation);
     locator_info_.update(
         reader_attributes.remote_locators().unicast,
         reader_attributes.remote_locators().multicast,
@@ -121,6 +131,11 @@ void ReaderProxy::stop()
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
+    heartbeat_pending_ = false;
+    heartbeat_resent_ = false;
+    heartbeat_count_ = 0;
+    srtt_ = std::chrono::microseconds(0);
+    rttvar_ = std::chrono::microseconds(0);
 }
 
 void ReaderProxy::disable_timers()
@@ -136,6 +151,61 @@ void ReaderProxy::update_nack_supression_interval(const Duration_t& interval)
     nack_supression_event_->update_interval(interval);
 }
 
+void ReaderProxy::heartbeat_sent(
+        Count_t count,
+        const std::chrono::steady_clock::time_point& time)
+{
+    if (!heartbeat_pending_)
+    {
+        heartbeat_pending_ = true;
+        heartbeat_resent_ = false;
+        heartbeat_count_ = count;
+        heartbeat_sent_time_ = time;
+    }
+    else if (count != heartbeat_count_)
+    {
+        // The response could answer any of them
+        heartbeat_resent_ = true;
+    }
+}
+
+bool ReaderProxy::acknack_received(const std::chrono::steady_clock::time_point& time)
+{
+    if (!heartbeat_pending_)
+    {
+        return false;
+    }
+
+    heartbeat_pending_ = false;
+    if (heartbeat_resent_ || time < heartbeat_sent_time_)
+    {
+        return false;
+    }
+    std::chrono::microseconds sample =
+        std::chrono::duration_cast<std::chrono::microseconds>(time - heartbeat_sent_time_);
+
+    // Smoothing as in RFC 6298
+    if (srtt_.count() == 0)
+    {
+        srtt_ = sample;
+        rttvar_ = sample / 2;
+    }
+    else
+    {
+        std::chrono::microseconds deviation = srtt_ > sample ? srtt_ - sample : sample - srtt_;
+        rttvar_ = (3 * rttvar_ + deviation) / 4;
+        srtt_ = (7 * srtt_ + sample) / 8;
+    }
+
+    // A zero estimation is used as "not measured"
+    if (srtt_.count() == 0)
+    {
+        srtt_ = std::chrono::microseconds(1);
+    }
+
+    return true;
+}
+
 void ReaderProxy::add_change(
         const ChangeForReader_t& change,
         bool restart_nack_supression)
@@ -379,15 +449,15 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
 
 bool ReaderProxy::perform_nack_supression()
 {
-    return convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED);
+    return convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED) > 0;
 }
 
-bool ReaderProxy::perform_acknack_response()
+uint32_t ReaderProxy::perform_acknack_response()
 {
     return convert_status_on_all_changes(REQUESTED, UNSENT);
 }
 
-bool ReaderProxy::convert_status_on_all_changes(
+uint32_t ReaderProxy::convert_status_on_all_changes(
         ChangeForReaderStatus_t previous,
         ChangeForReaderStatus_t next)
 {
@@ -396,17 +466,17 @@ bool ReaderProxy::convert_status_on_all_changes(
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
-    bool at_least_one_modified = false;
+    uint32_t modified = 0;
     for(ChangeForReader_t& change : changes_for_reader_)
     {
         if (change.getStatus() == previous)
         {
-            at_least_one_modified = true;
+            ++modified;
             change.setStatus(next);
         }
     }
 
-    return at_least_one_modified;
+    return modified;
 }
 
 void ReaderProxy::change_has_been_removed(const SequenceNumber_t& seq_num)
@@ -511,6 +581,13 @@ ReaderProxy::ChangeConstIterator ReaderProxy::find_change(const SequenceNumber_t
         : it->getSequenceNumber() == seq_num ? it : end;
 }
 
+bool ReaderProxy::rtps_is_relevant(CacheChange_t* change)
+{
+    const IReaderDataFilter* filter = writer_->reader_data_filter();
+    return ((filter == nullptr) || filter->is_relevant(*change, guid())) &&
+           locator_info_.time_based_filter().pass(*change);
+}
+
 bool ReaderProxy::are_there_gaps()
 {
     return (0 < changes_for_reader_.size() &&
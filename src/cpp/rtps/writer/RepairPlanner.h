@@ -0,0 +1,319 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RepairPlanner.h
+ */
+
+#ifndef _RTPS_WRITER_REPAIRPLANNER_H_
+#define _RTPS_WRITER_REPAIRPLANNER_H_
+
+#include "RTPSWriterCollector.h"
+
+#include <fastrtps/rtps/common/LocatorSelectorEntry.hpp>
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Plans how the changes gathered on a RTPSWriterCollector are sent to the remote readers.
+ *
+ * Items requested by the same set of readers are grouped on a single batch, so the locators are selected once per
+ * batch instead of once per item, and each change is added once to the message group no matter how many readers
+ * requested it.
+ * When the readers of a batch share a multicast locator, the batch is kept together (and the transport selects the
+ * multicast locator) only if the requesting readers are at least a given fraction of the matched readers listening
+ * on that locator. Otherwise the batch is split in one batch per reader, which will be sent by unicast.
+ *
+ * Items with a best-effort reader are never moved before a previous item, as those readers would discard them.
+ *
+ * Items and batches are kept on pools which are reused on every plan, so once the planner has handled its maximum
+ * number of items and batches it plans again without allocating memory.
+ *
+ * T should be a pointer to a class with methods is_reliable() and locator_selector_entry().
+ */
+template<class T>
+class RepairPlanner
+{
+    public:
+
+        typedef typename RTPSWriterCollector<T>::Item Item;
+
+        struct Batch
+        {
+            //! Readers which will receive every item of the batch.
+            std::vector<T> readers;
+
+            //! Items to send, in the order they should be sent. They are owned by the planner.
+            std::vector<Item*> items;
+
+            //! Whether every reader of the batch is reliable.
+            bool all_reliable;
+        };
+
+        /**
+         * @param min_multicast_coverage Minimum fraction of the readers listening on a multicast locator that should
+         * request a batch to send it by multicast.
+         */
+        RepairPlanner(
+                float min_multicast_coverage = 0.5f)
+            : min_multicast_coverage_(min_multicast_coverage)
+            , items_used_(0)
+        {
+        }
+
+        /**
+         * Plan the items of a collector, leaving it empty. Batches of the previous plan are discarded.
+         * @param collector Collector with the items to send.
+         * @param matched_readers Every reader matched with the writer.
+         */
+        template<class Container>
+        void plan(
+                RTPSWriterCollector<T>& collector,
+                const Container& matched_readers)
+        {
+            release_batches(batches_);
+            items_used_ = 0;
+            count_multicast_groups(matched_readers);
+
+            for (Item& collected : collector)
+            {
+                Item& item = next_item();
+                item.sequenceNumber = collected.sequenceNumber;
+                item.fragmentNumber = collected.fragmentNumber;
+                item.cacheChange = collected.cacheChange;
+                // Swapped so both pools keep the capacity of their lists of readers.
+                item.remoteReaders.swap(collected.remoteReaders);
+                add_item(item);
+            }
+            collector.clear();
+
+            split_low_coverage_batches();
+        }
+
+        std::vector<Batch>& batches()
+        {
+            return batches_;
+        }
+
+    private:
+
+        template<class Container>
+        void count_multicast_groups(
+                const Container& matched_readers)
+        {
+            multicast_groups_.clear();
+
+            for (const T& reader : matched_readers)
+            {
+                const LocatorSelectorEntry* entry = reader->locator_selector_entry();
+                for (const Locator_t& locator : entry->multicast)
+                {
+                    ++find_or_add(multicast_groups_, locator).second;
+                }
+            }
+        }
+
+        void add_item(
+                Item& item)
+        {
+            bool all_reliable = true;
+            for (const T& reader : item.remoteReaders)
+            {
+                all_reliable &= reader->is_reliable();
+            }
+
+            // Reliable items can join any previous batch of the same readers.
+            // Items with best-effort readers can only be appended to the last one.
+            if (!batches_.empty())
+            {
+                auto it = batches_.end() - 1;
+                if (all_reliable)
+                {
+                    for (it = batches_.begin(); it != batches_.end(); ++it)
+                    {
+                        if (it->readers == item.remoteReaders)
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                if (it != batches_.end() && it->readers == item.remoteReaders)
+                {
+                    it->items.push_back(&item);
+                    return;
+                }
+            }
+
+            Batch& batch = new_batch(batches_);
+            batch.readers = item.remoteReaders;
+            batch.all_reliable = all_reliable;
+            batch.items.push_back(&item);
+        }
+
+        void split_low_coverage_batches()
+        {
+            for (Batch& batch : batches_)
+            {
+                if (batch.readers.size() < 2 || should_keep_together(batch))
+                {
+                    std::swap(new_batch(planned_), batch);
+                    continue;
+                }
+
+                for (const T& reader : batch.readers)
+                {
+                    Batch& single = new_batch(planned_);
+                    single.readers.push_back(reader);
+                    single.all_reliable = reader->is_reliable();
+                    for (const Item* item : batch.items)
+                    {
+                        Item& copy = next_item();
+                        copy.sequenceNumber = item->sequenceNumber;
+                        copy.fragmentNumber = item->fragmentNumber;
+                        copy.cacheChange = item->cacheChange;
+                        copy.remoteReaders.assign(1, reader);
+                        single.items.push_back(&copy);
+                    }
+                }
+            }
+
+            release_batches(batches_);
+            batches_.swap(planned_);
+        }
+
+        //! @return a free item of the pool.
+        Item& next_item()
+        {
+            if (items_used_ == items_.size())
+            {
+                items_.emplace_back();
+            }
+            return items_[items_used_++];
+        }
+
+        //! Append an empty batch to a list, taking it from the spare ones when possible.
+        Batch& new_batch(
+                std::vector<Batch>& batches)
+        {
+            if (spare_batches_.empty())
+            {
+                batches.emplace_back();
+            }
+            else
+            {
+                batches.push_back(std::move(spare_batches_.back()));
+                spare_batches_.pop_back();
+            }
+
+            Batch& batch = batches.back();
+            batch.readers.clear();
+            batch.items.clear();
+            return batch;
+        }
+
+        //! Move every batch of a list to the spare ones.
+        void release_batches(
+                std::vector<Batch>& batches)
+        {
+            for (Batch& batch : batches)
+            {
+                spare_batches_.push_back(std::move(batch));
+            }
+            batches.clear();
+        }
+
+        bool should_keep_together(
+                const Batch& batch)
+        {
+            requesters_.clear();
+            for (const T& reader : batch.readers)
+            {
+                const LocatorSelectorEntry* entry = reader->locator_selector_entry();
+                for (const Locator_t& locator : entry->multicast)
+                {
+                    ++find_or_add(requesters_, locator).second;
+                }
+            }
+
+            // Without a shared multicast locator every reader gets its own unicast copy from the same message.
+            bool shared = false;
+            for (const std::pair<Locator_t, size_t>& requested : requesters_)
+            {
+                if (requested.second < 2)
+                {
+                    continue;
+                }
+
+                shared = true;
+                size_t listeners = find_or_add(multicast_groups_, requested.first).second;
+                if (static_cast<float>(requested.second) >= min_multicast_coverage_ * static_cast<float>(listeners))
+                {
+                    return true;
+                }
+            }
+
+            return !shared;
+        }
+
+        static std::pair<Locator_t, size_t>& find_or_add(
+                std::vector<std::pair<Locator_t, size_t>>& counters,
+                const Locator_t& locator)
+        {
+            for (std::pair<Locator_t, size_t>& counter : counters)
+            {
+                if (counter.first == locator)
+                {
+                    return counter;
+                }
+            }
+
+            counters.emplace_back(locator, 0u);
+            return counters.back();
+        }
+
+        float min_multicast_coverage_;
+
+        std::vector<Batch> batches_;
+
+        //! Batches being built by split_low_coverage_batches.
+        std::vector<Batch> planned_;
+
+        //! Batches not in use, kept to reuse the capacity of their vectors.
+        std::vector<Batch> spare_batches_;
+
+        //! Pool of items. Pointers to them remain valid as the pool grows.
+        std::deque<Item> items_;
+
+        //! Number of items of the pool in use.
+        size_t items_used_;
+
+        //! Number of matched readers listening on each multicast locator.
+        std::vector<std::pair<Locator_t, size_t>> multicast_groups_;
+
+        //! Number of readers of a batch listening on each multicast locator.
+        std::vector<std::pair<Locator_t, size_t>> requesters_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_WRITER_REPAIRPLANNER_H_
@@ -24,6 +24,7 @@
 
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../common/StatisticsCounters.h"
 
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
 #include <fastrtps/rtps/messages/RTPSMessageGroup.h>
@@ -41,11 +42,13 @@
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
 
 #include "RTPSWriterCollector.h"
+#include "RepairPlanner.h"
 #include "StatefulWriterOrganizer.h"
 
 #include <mutex>
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -65,6 +68,7 @@ StatefulWriter::StatefulWriter(
     , m_times(att.times)
     , matched_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
+    , matched_readers_index_(att.matched_readers_allocation)
     , next_all_acked_notify_sequence_(0, 1)
     , all_acked_(false)
     , may_remove_change_cond_()
@@ -76,6 +80,9 @@ StatefulWriter::StatefulWriter(
     , sendBufferSize_(pimpl->get_min_network_send_buffer_size())
     , currentUsageSendBufferSize_(static_cast<int32_t>(pimpl->get_min_network_send_buffer_size()))
     , m_controllers()
+    , relevant_changes_(new RTPSWriterCollector<ReaderProxy*>())
+    , not_relevant_changes_(new StatefulWriterOrganizer())
+    , repair_planner_(new RepairPlanner<ReaderProxy*>())
 {
     m_heartbeatCount = 0;
 
@@ -148,6 +155,12 @@ StatefulWriter::~StatefulWriter()
         nack_response_event_ = nullptr;
     }
 
+    if (batch_flush_event_ != nullptr)
+    {
+        delete(batch_flush_event_);
+        batch_flush_event_ = nullptr;
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -161,6 +174,7 @@ StatefulWriter::~StatefulWriter()
         {
             ReaderProxy* remote_reader = matched_readers_.back();
             matched_readers_.pop_back();
+            matched_readers_index_.erase(remote_reader->guid());
             remote_reader->stop();
             matched_readers_pool_.push_back(remote_reader);
         }
@@ -179,6 +193,9 @@ StatefulWriter::~StatefulWriter()
         delete(remote_reader);
     }
 
+    delete(repair_planner_);
+    delete(not_relevant_changes_);
+    delete(relevant_changes_);
 }
 
 /*
@@ -197,10 +214,13 @@ void StatefulWriter::unsent_change_added_to_history(
 
     if(!matched_readers_.empty())
     {
-        if(!isAsync())
+        if(!isAsync() && !is_batching())
         {
             //TODO(Ricardo) Temporal.
             bool expectsInlineQos = false;
+            bool all_relevant = true;
+            std::vector<bool>& relevance = readers_relevance_;
+            relevance.clear();
 
             // First step is to add the new CacheChange_t to all reader proxies.
             // It has to be done before sending, because if a timeout is catched, we will not include the
@@ -208,6 +228,8 @@ void StatefulWriter::unsent_change_added_to_history(
             for (ReaderProxy* it : matched_readers_)
             {
                 ChangeForReader_t changeForReader(change);
+                bool relevant = it->rtps_is_relevant(change);
+                relevance.push_back(relevant);
 
                 if(m_pushMode)
                 {
@@ -219,13 +241,17 @@ void StatefulWriter::unsent_change_added_to_history(
                     {
                         changeForReader.setStatus(ACKNOWLEDGED);
                     }
+
+                    // Every fragment is sent below.
+                    changeForReader.markAllFragmentsAsSent();
                 }
                 else
                 {
                     changeForReader.setStatus(UNACKNOWLEDGED);
                 }
 
-                changeForReader.setRelevance(it->rtps_is_relevant(change));
+                all_relevant &= relevant;
+                changeForReader.setRelevance(relevant);
                 it->add_change(changeForReader, true, max_blocking_time);
                 expectsInlineQos |= it->expects_inline_qos();
             }
@@ -233,10 +259,10 @@ void StatefulWriter::unsent_change_added_to_history(
             try
             {
                 //At this point we are sure all information was stores. We now can send data.
-                if (!m_separateSendingEnabled)
+                if (!m_separateSendingEnabled && all_relevant)
                 {
                     RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, *this, max_blocking_time);
-                    if (!group.add_data(*change, expectsInlineQos))
+                    if (!add_data_to_group(group, *change, expectsInlineQos))
                     {
                         logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                     }
@@ -247,13 +273,30 @@ void StatefulWriter::unsent_change_added_to_history(
                 }
                 else
                 {
-                    for (ReaderProxy* it : matched_readers_)
+                    for (size_t i = 0; i < matched_readers_.size(); ++i)
                     {
+                        ReaderProxy* it = matched_readers_[i];
+                        if (!relevance[i] && !it->is_reliable())
+                        {
+                            continue;
+                        }
+
                         RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, it->message_sender(),
                                 max_blocking_time);
-                        if (!group.add_data(*change, it->expects_inline_qos()))
+                        if (relevance[i])
                         {
-                            logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+                            if (!add_data_to_group(group, *change, it->expects_inline_qos()))
+                            {
+                                logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+                            }
+                        }
+                        else
+                        {
+                            // Reliable readers not interested on the change are sent its GAP right away, instead of
+                            // waiting for them to request it.
+                            std::vector<SequenceNumber_t>& irrelevant = irrelevant_changes_;
+                            irrelevant.assign(1, change->sequenceNumber);
+                            group.add_gap(irrelevant);
                         }
                         uint32_t last_processed = 0;
                         send_heartbeat_piggyback_nts_(it, group, last_processed);
@@ -297,7 +340,14 @@ void StatefulWriter::unsent_change_added_to_history(
 
             if (m_pushMode)
             {
-                mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                if (is_batching())
+                {
+                    add_to_batch_nts(*change);
+                }
+                else
+                {
+                    mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+                }
             }
         }
 
@@ -367,7 +417,8 @@ void StatefulWriter::send_any_unsent_changes()
                 try
                 {
                     // For possible GAP
-                    std::set<SequenceNumber_t> irrelevant;
+                    std::vector<SequenceNumber_t>& irrelevant = irrelevant_changes_;
+                    irrelevant.clear();
 
                     // Specific destination message group
                     RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, remoteReader->message_sender());
@@ -378,8 +429,32 @@ void StatefulWriter::send_any_unsent_changes()
                     {
                         if (unsentChange != nullptr && unsentChange->isRelevant() && unsentChange->isValid())
                         {
-                            // As we checked we are not async, we know we cannot have fragments
-                            if (group.add_data(*(unsentChange->getChange()), remoteReader->expects_inline_qos()))
+                            bool sent = true;
+                            const CacheChange_t* change = unsentChange->getChange();
+                            if (change->getFragmentCount() == 0)
+                            {
+                                sent = group.add_data(*change, remoteReader->expects_inline_qos());
+                            }
+                            else
+                            {
+                                // Only the fragments requested by the reader are sent again
+                                unsentChange->getUnsentFragments().for_each([&](FragmentNumber_t fragment)
+                                        {
+                                            if (group.add_data_frag(*change, fragment,
+                                                remoteReader->expects_inline_qos()))
+                                            {
+                                                bool all_fragments_sent = false;
+                                                remoteReader->mark_fragment_as_sent_for_change(seqNum, fragment,
+                                                    all_fragments_sent);
+                                            }
+                                            else
+                                            {
+                                                sent = false;
+                                            }
+                                        });
+                            }
+
+                            if (sent)
                             {
                                 remoteReader->set_change_to_status(seqNum, UNDERWAY, true);
 
@@ -397,7 +472,8 @@ void StatefulWriter::send_any_unsent_changes()
                         {
                             if (is_reliable)
                             {
-                                irrelevant.emplace(seqNum);
+                                // Unsent changes are visited in order
+                                irrelevant.push_back(seqNum);
                             }
                             remoteReader->set_change_to_status(seqNum, UNDERWAY, true);
                         } // Relevance
@@ -423,8 +499,11 @@ void StatefulWriter::send_any_unsent_changes()
     }
     else
     {
-        RTPSWriterCollector<ReaderProxy*> relevantChanges;
-        StatefulWriterOrganizer notRelevantChanges;
+        // Reused between calls, so the steady state does not allocate memory
+        RTPSWriterCollector<ReaderProxy*>& relevantChanges = *relevant_changes_;
+        StatefulWriterOrganizer& notRelevantChanges = *not_relevant_changes_;
+        relevantChanges.clear();
+        notRelevantChanges.clear();
 
         NetworkFactory& network = mp_RTPSParticipant->network_factory();
         locator_selector_.reset(true);
@@ -475,13 +554,16 @@ void StatefulWriter::send_any_unsent_changes()
                 RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, *this);
                 uint32_t lastBytesProcessed = 0;
 
-                while (!relevantChanges.empty())
+                // Group the changes requested by the same readers, choosing between multicast and unicast.
+                RepairPlanner<ReaderProxy*>& planner = *repair_planner_;
+                planner.plan(relevantChanges, matched_readers_);
+
+                for (RepairPlanner<ReaderProxy*>::Batch& batch : planner.batches())
                 {
-                    RTPSWriterCollector<ReaderProxy*>::Item changeToSend = relevantChanges.pop();
                     bool expectsInlineQos = false;
                     locator_selector_.reset(false);
 
-                    for (const ReaderProxy* remoteReader : changeToSend.remoteReaders)
+                    for (const ReaderProxy* remoteReader : batch.readers)
                     {
                         locator_selector_.enable(remoteReader->guid());
                         expectsInlineQos |= remoteReader->expects_inline_qos();
@@ -494,82 +576,88 @@ void StatefulWriter::send_any_unsent_changes()
                         compute_selected_guids();
                     }
 
-                    // TODO(Ricardo) Flowcontroller has to be used in RTPSMessageGroup. Study.
-                    // And controllers are notified about the changes being sent
-                    FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
-
-                    if (changeToSend.fragmentNumber != 0)
+                    for (RTPSWriterCollector<ReaderProxy*>::Item* item : batch.items)
                     {
-                        if (group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber, expectsInlineQos))
+                        RTPSWriterCollector<ReaderProxy*>::Item& changeToSend = *item;
+
+                        // TODO(Ricardo) Flowcontroller has to be used in RTPSMessageGroup. Study.
+                        // And controllers are notified about the changes being sent
+                        FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
+
+                        if (changeToSend.fragmentNumber != 0)
                         {
-                            bool must_wake_up_async_thread = false;
-                            for (ReaderProxy* remoteReader : changeToSend.remoteReaders)
+                            if (group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber, expectsInlineQos))
                             {
-                                bool allFragmentsSent = false;
-                                if (remoteReader->mark_fragment_as_sent_for_change(
-                                            changeToSend.sequenceNumber,
-                                            changeToSend.fragmentNumber,
-                                            allFragmentsSent))
+                                bool must_wake_up_async_thread = false;
+                                for (ReaderProxy* remoteReader : changeToSend.remoteReaders)
                                 {
-                                    must_wake_up_async_thread |= !allFragmentsSent;
-                                    if (remoteReader->is_reliable())
+                                    bool allFragmentsSent = false;
+                                    if (remoteReader->mark_fragment_as_sent_for_change(
+                                                changeToSend.sequenceNumber,
+                                                changeToSend.fragmentNumber,
+                                                allFragmentsSent))
                                     {
-                                        activateHeartbeatPeriod = true;
-                                        if (allFragmentsSent)
+                                        must_wake_up_async_thread |= !allFragmentsSent;
+                                        if (remoteReader->is_reliable())
                                         {
-                                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                                            activateHeartbeatPeriod = true;
+                                            if (allFragmentsSent)
+                                            {
+                                                remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                                            }
                                         }
-                                    }
-                                    else
-                                    {
-                                        if (allFragmentsSent)
+                                        else
                                         {
-                                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, ACKNOWLEDGED, false);
+                                            if (allFragmentsSent)
+                                            {
+                                                remoteReader->set_change_to_status(changeToSend.sequenceNumber, ACKNOWLEDGED, false);
+                                            }
                                         }
                                     }
                                 }
-                            }
 
-                            if (must_wake_up_async_thread)
+                                if (must_wake_up_async_thread)
+                                {
+                                    mp_RTPSParticipant->async_thread().wake_up(this);
+                                }
+                            }
+                            else
                             {
-                                mp_RTPSParticipant->async_thread().wake_up(this);
+                                logError(RTPS_WRITER, "Error sending fragment (" << changeToSend.sequenceNumber <<
+                                        ", " << changeToSend.fragmentNumber << ")");
                             }
                         }
                         else
                         {
-                            logError(RTPS_WRITER, "Error sending fragment (" << changeToSend.sequenceNumber <<
-                                    ", " << changeToSend.fragmentNumber << ")");
-                        }
-                    }
-                    else
-                    {
-                    if (group.add_data(*changeToSend.cacheChange, expectsInlineQos))
-                    {
-                        for (ReaderProxy* remoteReader : changeToSend.remoteReaders)
-                        {
-                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                            if (group.add_data(*changeToSend.cacheChange, expectsInlineQos))
+                            {
+                                for (ReaderProxy* remoteReader : changeToSend.remoteReaders)
+                                {
+                                    remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
 
-                            if (remoteReader->is_reliable())
+                                    if (remoteReader->is_reliable())
+                                    {
+                                        activateHeartbeatPeriod = true;
+                                    }
+                                }
+                            }
+                            else
                             {
-                                activateHeartbeatPeriod = true;
+                                logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
                             }
                         }
-                    }
-                    else
-                    {
-                        logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
-                    }
-                    }
 
-                    // Heartbeat piggyback.
-                    send_heartbeat_piggyback_nts_(nullptr, group, lastBytesProcessed);
+                        // Heartbeat piggyback.
+                        send_heartbeat_piggyback_nts_(nullptr, group, lastBytesProcessed);
+                    }
                 }
 
-                for (std::pair<std::vector<ReaderProxy*>, std::set<SequenceNumber_t>> pair : notRelevantChanges.elements())
+                notRelevantChanges.organize();
+                for (const StatefulWriterOrganizer::Element& element : notRelevantChanges)
                 {
                     locator_selector_.reset(false);
 
-                    for (const ReaderProxy* remoteReader : pair.first)
+                    for (const ReaderProxy* remoteReader : element.readers)
                     {
                         locator_selector_.enable(remoteReader->guid());
                     }
@@ -579,7 +667,7 @@ void StatefulWriter::send_any_unsent_changes()
                         network.select_locators(locator_selector_);
                         compute_selected_guids();
                     }
-                    group.add_gap(pair.second);
+                    group.add_gap(element.sequence_numbers);
                 }
             }
             catch(const RTPSMessageGroup::timeout&)
@@ -607,6 +695,7 @@ void StatefulWriter::send_any_unsent_changes()
 
     if (activateHeartbeatPeriod)
     {
+        update_heartbeat_period_nts_();
         periodic_hb_event_->restart_timer();
     }
 
@@ -645,17 +734,19 @@ bool StatefulWriter::matched_reader_add(const ReaderProxyData& rdata)
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
     // Check if it is already matched.
-    for(ReaderProxy* it : matched_readers_)
+    ReaderProxy** found = matched_readers_index_.find(rdata.guid());
+    if (found != nullptr)
     {
-        if(it->guid() == rdata.guid())
+        logInfo(RTPS_WRITER, "Attempting to add existing reader, updating information." << endl);
+        if (reader_data_filter_ != nullptr)
         {
-            logInfo(RTPS_WRITER, "Attempting to add existing reader, updating information." << endl);
-            if (it->update(rdata))
-            {
-                update_reader_info(true);
-            }
-            return false;
+            reader_data_filter_->reader_matched(rdata);
+        }
+        if ((*found)->update(rdata))
+        {
+            update_reader_info(true);
         }
+        return false;
     }
 
     // Get a reader proxy from the inactive pool (or create a new one if necessary and allowed)
@@ -681,6 +772,11 @@ bool StatefulWriter::matched_reader_add(const ReaderProxyData& rdata)
         matched_readers_pool_.pop_back();
     }
 
+    if (reader_data_filter_ != nullptr)
+    {
+        reader_data_filter_->reader_matched(rdata);
+    }
+
     // Add info of new datareader.
     rp->start(rdata);
     locator_selector_.add_entry(rp->locator_selector_entry());
@@ -711,8 +807,9 @@ bool StatefulWriter::matched_reader_add(const ReaderProxyData& rdata)
 
             if(rp->durability_kind() >= TRANSIENT_LOCAL && this->getAttributes().durabilityKind >= TRANSIENT_LOCAL)
             {
-                changeForReader.setRelevance(rp->rtps_is_relevant(*cit));
-                if(!rp->rtps_is_relevant(*cit))
+                bool relevant = rp->rtps_is_relevant(*cit);
+                changeForReader.setRelevance(relevant);
+                if(!relevant)
                 {
                     not_relevant_changes.insert(changeForReader.getSequenceNumber());
                 }
@@ -764,6 +861,7 @@ bool StatefulWriter::matched_reader_add(const ReaderProxyData& rdata)
     }
 
     matched_readers_.push_back(rp);
+    matched_readers_index_.insert(rp->guid(), rp);
 
     logInfo(RTPS_WRITER, "Reader Proxy "<< rp->guid()<< " added to " << this->m_guid.entityId << " with "
             << rp->reader_attributes().remote_locators().unicast.size()<<"(u)-"
@@ -777,24 +875,23 @@ bool StatefulWriter::matched_reader_remove(const GUID_t& reader_guid)
     ReaderProxy *rproxy = nullptr;
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
-    ReaderProxyIterator it = matched_readers_.begin();
-    while(it != matched_readers_.end())
+    ReaderProxy** found = matched_readers_index_.find(reader_guid);
+    if (found != nullptr)
     {
-        if((*it)->guid() == reader_guid)
-        {
-            logInfo(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
-            rproxy = std::move(*it);
-            it = matched_readers_.erase(it);
-
-            continue;
-        }
-
-        ++it;
+        logInfo(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
+        rproxy = *found;
+        matched_readers_index_.erase(reader_guid);
+        matched_readers_.erase(std::find(matched_readers_.begin(), matched_readers_.end(), rproxy));
     }
 
     locator_selector_.remove_entry(reader_guid);
     update_reader_info(false);
 
+    if (rproxy != nullptr && reader_data_filter_ != nullptr)
+    {
+        reader_data_filter_->reader_unmatched(reader_guid);
+    }
+
     if (matched_readers_.size() == 0)
     {
         periodic_hb_event_->cancel_timer();
@@ -819,26 +916,17 @@ bool StatefulWriter::matched_reader_remove(const GUID_t& reader_guid)
 bool StatefulWriter::matched_reader_is_matched(const GUID_t& reader_guid)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    for(ReaderProxy* it : matched_readers_)
-    {
-        if(it->guid() == reader_guid)
-        {
-            return true;
-        }
-    }
-    return false;
+    return matched_readers_index_.find(reader_guid) != nullptr;
 }
 
 bool StatefulWriter::matched_reader_lookup(GUID_t& readerGuid,ReaderProxy** RP)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    for(ReaderProxy* it : matched_readers_)
+    ReaderProxy** found = matched_readers_index_.find(readerGuid);
+    if (found != nullptr)
     {
-        if(it->guid() == readerGuid)
-        {
-            *RP = it;
-            return true;
-        }
+        *RP = *found;
+        return true;
     }
     return false;
 }
@@ -1014,18 +1102,21 @@ void StatefulWriter::updateAttributes(const WriterAttributes& att)
 void StatefulWriter::updateTimes(const WriterTimes& times)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    if(m_times.heartbeatPeriod != times.heartbeatPeriod)
+    if(m_times.heartbeatPeriod != times.heartbeatPeriod ||
+            (m_times.adaptiveReliability && !times.adaptiveReliability))
     {
         periodic_hb_event_->update_interval(times.heartbeatPeriod);
     }
-    if(m_times.nackResponseDelay != times.nackResponseDelay)
+    if(m_times.nackResponseDelay != times.nackResponseDelay ||
+            (m_times.adaptiveReliability && !times.adaptiveReliability))
     {
         if(nack_response_event_ != nullptr)
         {
             nack_response_event_->update_interval(times.nackResponseDelay);
         }
     }
-    if(m_times.nackSupressionDuration != times.nackSupressionDuration)
+    if(m_times.nackSupressionDuration != times.nackSupressionDuration ||
+            (m_times.adaptiveReliability && !times.adaptiveReliability))
     {
         for (ReaderProxy* it : matched_readers_)
         {
@@ -1093,7 +1184,10 @@ bool StatefulWriter::send_periodic_heartbeat(
                 try
                 {
                     RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, *this);
-                    send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_, liveliness);
+                    if (send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_, liveliness))
+                    {
+                        heartbeat_sent_nts_(nullptr);
+                    }
                 }
                 catch(const RTPSMessageGroup::timeout&)
                 {
@@ -1116,6 +1210,11 @@ bool StatefulWriter::send_periodic_heartbeat(
         }
     }
 
+    if (unacked_changes)
+    {
+        update_heartbeat_period_nts_();
+    }
+
     return unacked_changes;
 }
 
@@ -1126,7 +1225,10 @@ void StatefulWriter::send_heartbeat_to_nts(
     try
     {
         RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, remoteReaderProxy.message_sender());
-        send_heartbeat_nts_(1u, group, disable_positive_acks_, liveliness);
+        if (send_heartbeat_nts_(1u, group, disable_positive_acks_, liveliness) && !liveliness)
+        {
+            heartbeat_sent_nts_(&remoteReaderProxy);
+        }
     }
     catch(const RTPSMessageGroup::timeout&)
     {
@@ -1134,7 +1236,7 @@ void StatefulWriter::send_heartbeat_to_nts(
     }
 }
 
-void StatefulWriter::send_heartbeat_nts_(
+bool StatefulWriter::send_heartbeat_nts_(
         size_t number_of_readers,
         RTPSMessageGroup& message_group,
         bool final,
@@ -1155,7 +1257,7 @@ void StatefulWriter::send_heartbeat_nts_(
         }
         else
         {
-            return;
+            return false;
         }
     }
     else
@@ -1169,6 +1271,90 @@ void StatefulWriter::send_heartbeat_nts_(
     currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
 
     logInfo(RTPS_WRITER, getGuid().entityId << " Sending Heartbeat (" << firstSeq << " - " << lastSeq << ")" );
+    return true;
+}
+
+void StatefulWriter::heartbeat_sent_nts_(ReaderProxy* reader)
+{
+    if (!m_times.adaptiveReliability || disable_positive_acks_)
+    {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (reader != nullptr)
+    {
+        reader->heartbeat_sent(m_heartbeatCount, now);
+    }
+    else
+    {
+        for (ReaderProxy* it : matched_readers_)
+        {
+            if (it->is_reliable())
+            {
+                it->heartbeat_sent(m_heartbeatCount, now);
+            }
+        }
+    }
+}
+
+void StatefulWriter::update_heartbeat_period_nts_()
+{
+    if (!m_times.adaptiveReliability)
+    {
+        return;
+    }
+
+    // Unacknowledged changes of the slowest reader and the highest retransmission timeout.
+    int64_t last_sequence = static_cast<int64_t>((mp_history->next_sequence_number() - 1).to64long());
+    int64_t unacked = 0;
+    std::chrono::microseconds rto(0);
+    for (ReaderProxy* it : matched_readers_)
+    {
+        if (it->is_reliable())
+        {
+            unacked = (std::max)(unacked, last_sequence - static_cast<int64_t>(it->changes_low_mark().to64long()));
+            rto = (std::max)(rto, it->retransmission_timeout());
+        }
+    }
+
+    // The period shrinks as unacknowledged data grows, but never below the time the readers need to answer.
+    int64_t max_period = TimeConv::Duration_t2MicroSecondsInt64(m_times.heartbeatPeriod);
+    int64_t period = max_period / (1 + (std::max)(unacked, int64_t(0)));
+    period = (std::max)(period, TimeConv::Duration_t2MicroSecondsInt64(m_times.minHeartbeatPeriod));
+    period = (std::max)(period, static_cast<int64_t>(rto.count()));
+    period = (std::min)(period, max_period);
+
+    periodic_hb_event_->update_interval_millisec(period * 1e-3);
+}
+
+void StatefulWriter::update_nack_response_delay_nts_()
+{
+    if (!m_times.adaptiveReliability || nack_response_event_ == nullptr)
+    {
+        return;
+    }
+
+    // Readers answer the same HEARTBEAT spread over the difference of their round trip times.
+    std::chrono::microseconds min_rtt = std::chrono::microseconds::max();
+    std::chrono::microseconds max_rtt(0);
+    for (ReaderProxy* it : matched_readers_)
+    {
+        std::chrono::microseconds rtt = it->round_trip_time();
+        if (rtt.count() > 0)
+        {
+            min_rtt = (std::min)(min_rtt, rtt);
+            max_rtt = (std::max)(max_rtt, rtt);
+        }
+    }
+
+    int64_t delay = TimeConv::Duration_t2MicroSecondsInt64(m_times.nackResponseDelay);
+    if (max_rtt > min_rtt)
+    {
+        delay = (std::max)(delay, static_cast<int64_t>((max_rtt - min_rtt).count()));
+    }
+
+    nack_response_event_->update_interval_millisec(delay * 1e-3);
 }
 
 void StatefulWriter::send_heartbeat_piggyback_nts_(
@@ -1191,7 +1377,10 @@ void StatefulWriter::send_heartbeat_piggyback_nts_(
                     compute_selected_guids();
                 }
             }
-            send_heartbeat_nts_(number_of_readers, message_group, disable_positive_acks_);
+            if (send_heartbeat_nts_(number_of_readers, message_group, disable_positive_acks_))
+            {
+                heartbeat_sent_nts_(reader);
+            }
         }
         else
         {
@@ -1200,7 +1389,10 @@ void StatefulWriter::send_heartbeat_piggyback_nts_(
             last_bytes_processed = current_bytes;
             if (currentUsageSendBufferSize_ < 0)
             {
-                send_heartbeat_nts_(number_of_readers, message_group, disable_positive_acks_);
+                if (send_heartbeat_nts_(number_of_readers, message_group, disable_positive_acks_))
+                {
+                    heartbeat_sent_nts_(reader);
+                }
             }
         }
     }
@@ -1211,9 +1403,16 @@ void StatefulWriter::perform_nack_response()
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
     bool must_wake_up_async_thread = false;
 
+    EndpointStatisticsCounters* stats = statistics();
     for (ReaderProxy* remote_reader : matched_readers_)
     {
-        if (remote_reader->perform_acknack_response() || remote_reader->are_there_gaps())
+        uint32_t requested = remote_reader->perform_acknack_response();
+        if (stats != nullptr)
+        {
+            statistics_add(stats->samples_resent, requested);
+        }
+
+        if (requested > 0 || remote_reader->are_there_gaps())
         {
             must_wake_up_async_thread = true;
         }
@@ -1252,36 +1451,50 @@ bool StatefulWriter::process_acknack(
     result = (m_guid == writer_guid);
     if (result)
     {
-        for (ReaderProxy* remote_reader : matched_readers_)
+        ReaderProxy** found = matched_readers_index_.find(reader_guid);
+        if (found != nullptr)
         {
-            if (remote_reader->guid() == reader_guid)
+            ReaderProxy* remote_reader = *found;
+
+            if (EndpointStatisticsCounters* stats = statistics())
+            {
+                statistics_add(stats->acknacks_received);
+            }
+
+            if (remote_reader->check_and_set_acknack_count(ack_count))
             {
-                if (remote_reader->check_and_set_acknack_count(ack_count))
+                if (m_times.adaptiveReliability && remote_reader->acknack_received(steady_clock::now()))
                 {
-                    // Sequence numbers before Base are set as Acknowledged.
-                    remote_reader->acked_changes_set(sn_set.base());
-                    if (sn_set.base() > SequenceNumber_t(0, 0))
+                    // Do not repeat a repair before it could have been acknowledged.
+                    int64_t rto = remote_reader->retransmission_timeout().count();
+                    int64_t supression = TimeConv::Duration_t2MicroSecondsInt64(m_times.nackSupressionDuration);
+                    remote_reader->update_nack_supression_interval(
+                        Duration_t((std::max)(rto, supression) * 1e-6L));
+                }
+
+                // Sequence numbers before Base are set as Acknowledged.
+                remote_reader->acked_changes_set(sn_set.base());
+                if (sn_set.base() > SequenceNumber_t(0, 0))
+                {
+                    if (remote_reader->requested_changes_set(sn_set) || remote_reader->are_there_gaps())
                     {
-                        if (remote_reader->requested_changes_set(sn_set) || remote_reader->are_there_gaps())
-                        {
-                            nack_response_event_->restart_timer();
-                        }
-                        else if (!final_flag)
-                        {
-                            periodic_hb_event_->restart_timer();
-                        }
+                        update_nack_response_delay_nts_();
+                        nack_response_event_->restart_timer();
                     }
-                    else if (sn_set.empty() && !final_flag)
+                    else if (!final_flag)
                     {
-                        // This is the preemptive acknack. Always send heartbeat
-                        send_heartbeat_to_nts(*remote_reader);
+                        periodic_hb_event_->restart_timer();
                     }
-
-                    // Check if all CacheChange are acknowledge, because a user could be waiting
-                    // for this, of if VOLATILE should be removed CacheChanges
-                    check_acked_status();
                 }
-                break;
+                else if (sn_set.empty() && !final_flag)
+                {
+                    // This is the preemptive acknack. Always send heartbeat
+                    send_heartbeat_to_nts(*remote_reader);
+                }
+
+                // Check if all CacheChange are acknowledge, because a user could be waiting
+                // for this, of if VOLATILE should be removed CacheChanges
+                check_acked_status();
             }
         }
     }
@@ -1302,15 +1515,20 @@ bool StatefulWriter::process_nack_frag(
     if (m_guid == writer_guid)
     {
         result = true;
-        for (ReaderProxy* remote_reader : matched_readers_)
+        ReaderProxy** found = matched_readers_index_.find(reader_guid);
+        if (found != nullptr)
         {
-            if (remote_reader->guid() == reader_guid)
+            ReaderProxy* remote_reader = *found;
+
+            if (EndpointStatisticsCounters* stats = statistics())
             {
-                if (remote_reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
-                {
-                    nack_response_event_->restart_timer();
-                }
-                break;
+                statistics_add(stats->nackfrags_received);
+            }
+
+            if (remote_reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
+            {
+                update_nack_response_delay_nts_();
+                nack_response_event_->restart_timer();
             }
         }
     }
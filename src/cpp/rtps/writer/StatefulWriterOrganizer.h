@@ -19,71 +19,124 @@
 #ifndef _RTPS_WRITER_STATEFULWRITERORGANIZER_H_
 #define _RTPS_WRITER_STATEFULWRITERORGANIZER_H_
 
+#include <fastrtps/rtps/common/SequenceNumber.h>
+
+#include <algorithm>
 #include <vector>
-#include <set>
 #include <assert.h>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class ReaderProxy;
+
+/**
+ * Groups the readers that should be notified about the same list of irrelevant sequence numbers, so a single GAP is
+ * sent to all of them.
+ *
+ * Elements are never released, and keep the capacity of their vectors when they are reused, so once the organizer has
+ * held its maximum number of elements it can be filled again without allocating memory.
+ */
 class StatefulWriterOrganizer
 {
     public:
-        
-        StatefulWriterOrganizer() : mLastReader_(nullptr) {}
 
+        struct Element
+        {
+            //! Readers which should be notified.
+            std::vector<ReaderProxy*> readers;
+
+            //! Sorted list of irrelevant sequence numbers.
+            std::vector<SequenceNumber_t> sequence_numbers;
+        };
+
+        typedef std::vector<Element>::iterator iterator;
+
+        StatefulWriterOrganizer()
+            : used_(0)
+            , last_reader_(nullptr)
+        {
+        }
+
+        /**
+         * Add an irrelevant sequence number for a reader.
+         * The sequence numbers of a reader should be added consecutively.
+         */
         void add_sequence_number(const SequenceNumber_t& seqNum, ReaderProxy* remoteReader)
         {
-            if(mLastGuid_ != remoteReader->guid())
+            if(last_reader_ != remoteReader)
+            {
                 organize();
 
-            mLastGuid_ = remoteReader->guid();
-            mLastReader_ = remoteReader;
-            mLastSeqList_.insert(seqNum);
+                if(used_ == elements_.size())
+                {
+                    elements_.emplace_back();
+                }
+                Element& element = elements_[used_++];
+                element.readers.clear();
+                element.readers.push_back(remoteReader);
+                element.sequence_numbers.clear();
+                last_reader_ = remoteReader;
+            }
+
+            std::vector<SequenceNumber_t>& seq_list = elements_[used_ - 1].sequence_numbers;
+            auto it = std::lower_bound(seq_list.begin(), seq_list.end(), seqNum);
+            if(it == seq_list.end() || *it != seqNum)
+            {
+                seq_list.insert(it, seqNum);
+            }
         }
 
+        //! Merge the element of the last reader with a previous one holding the same sequence numbers.
         void organize()
         {
-            if(mLastGuid_ != GUID_t::unknown())
+            if(last_reader_ != nullptr)
             {
-                assert(mLastReader_ != nullptr);
-
-                bool inserted = false;
+                assert(used_ > 0);
+                Element& last = elements_[used_ - 1];
 
-                for(auto pair : mElements_)
+                for(size_t i = 0; i + 1 < used_; ++i)
                 {
-                    if(pair.second == mLastSeqList_)
+                    if(elements_[i].sequence_numbers == last.sequence_numbers)
                     {
-                        pair.first.push_back(mLastReader_);
-                        mLastSeqList_.clear();
-                        inserted = true;
+                        elements_[i].readers.push_back(last_reader_);
+                        --used_;
                         break;
                     }
                 }
 
-                if(!inserted)
-                    mElements_.push_back(std::pair<std::vector<ReaderProxy*>, std::set<SequenceNumber_t>>({mLastReader_}, std::move(mLastSeqList_)));
-
-                mLastGuid_ = GUID_t::unknown();
-                mLastReader_ = nullptr;
+                last_reader_ = nullptr;
             }
         }
 
-    private:
-
-        GUID_t mLastGuid_;
+        //! Remove every element, keeping their allocated memory.
+        void clear()
+        {
+            used_ = 0;
+            last_reader_ = nullptr;
+        }
 
-        ReaderProxy* mLastReader_;
+        //! Should be called after organize().
+        iterator begin()
+        {
+            return elements_.begin();
+        }
 
-        std::set<SequenceNumber_t> mLastSeqList_;
+        iterator end()
+        {
+            return elements_.begin() + used_;
+        }
 
-        std::vector<std::pair<std::vector<ReaderProxy*>, std::set<SequenceNumber_t>>> mElements_;
+    private:
 
-    public:
+        //! Only the first used_ elements are in use.
+        std::vector<Element> elements_;
 
-        decltype(mElements_)& elements() { organize(); return mElements_; }
+        size_t used_;
 
+        //! Reader whose sequence numbers are being added, on the last element in use.
+        ReaderProxy* last_reader_;
 };
 
 } // namespace rtps
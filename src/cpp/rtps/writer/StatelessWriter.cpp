@@ -21,6 +21,7 @@
 #include <fastrtps/rtps/writer/WriterListener.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <fastrtps/rtps/resources/TimedEvent.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
 #include "../history/HistoryAttributesExtension.hpp"
@@ -53,6 +54,7 @@ StatelessWriter::StatelessWriter(
           listener)
     , matched_readers_(attributes.matched_readers_allocation)
     , unsent_changes_(resource_limits_from_history(history->m_att))
+    , changes_to_send_(new RTPSWriterCollector<ReaderLocator*>())
 {
     get_builtin_guid();
 
@@ -76,11 +78,19 @@ StatelessWriter::~StatelessWriter()
         controller->disable();
     }
 
+    if (batch_flush_event_ != nullptr)
+    {
+        delete(batch_flush_event_);
+        batch_flush_event_ = nullptr;
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
     // the AsyncWriterThread.
     flow_controllers_.clear();
+
+    delete(changes_to_send_);
 }
 
 void StatelessWriter::get_builtin_guid()
@@ -116,10 +126,13 @@ void StatelessWriter::update_reader_info(bool create_sender_resources)
 {
     bool addGuid = !has_builtin_guid();
     is_inline_qos_expected_ = false;
+    has_time_based_filters_ = false;
+    reader_selection_changed_ = false;
 
-    for (const ReaderLocator& reader : matched_readers_)
+    for (ReaderLocator& reader : matched_readers_)
     {
         is_inline_qos_expected_ |= reader.expects_inline_qos();
+        has_time_based_filters_ |= reader.time_based_filter().enabled();
     }
 
     update_cached_info_nts();
@@ -156,28 +169,47 @@ void StatelessWriter::unsent_change_added_to_history(
         encrypt_cachechange(change);
 #endif
 
-        if (!isAsync())
+        if (!isAsync() && !is_batching())
         {
             try
             {
                 if(m_separateSendingEnabled)
                 {
                     std::vector<GUID_t> guids(1);
-                    for (const ReaderLocator& it : matched_readers_)
+                    for (ReaderLocator& it : matched_readers_)
                     {
+                        if (!is_relevant(*change, it))
+                        {
+                            continue;
+                        }
+
                         RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, it, max_blocking_time);
 
-                        if (!group.add_data(*change, it.expects_inline_qos()))
+                        if (!add_data_to_group(group, *change, it.expects_inline_qos()))
                         {
                             logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                         }
                     }
                 }
+                else if (has_reader_filters())
+                {
+                    {
+                        RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, *this, max_blocking_time);
+
+                        if ((select_relevant_readers(*change, group) || !fixed_locators_.empty()) &&
+                                !add_data_to_group(group, *change, is_inline_qos_expected_))
+                        {
+                            logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+                        }
+                    }
+
+                    restore_reader_selection();
+                }
                 else
                 {
                     RTPSMessageGroup group(mp_RTPSParticipant, this, m_cdrmessages, *this, max_blocking_time);
 
-                    if (!group.add_data(*change, is_inline_qos_expected_))
+                    if (!add_data_to_group(group, *change, is_inline_qos_expected_))
                     {
                         logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                     }
@@ -196,7 +228,14 @@ void StatelessWriter::unsent_change_added_to_history(
         else
         {
             unsent_changes_.push_back(ChangeForReader_t(change));
-            mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+            if (is_batching())
+            {
+                add_to_batch_nts(*change);
+            }
+            else
+            {
+                mp_RTPSParticipant->async_thread().wake_up(this, max_blocking_time);
+            }
         }
 
         if (liveliness_lease_duration_ < c_TimeInfinite)
@@ -233,8 +272,8 @@ bool StatelessWriter::change_removed_by_history(CacheChange_t* change)
 
 bool StatelessWriter::is_acked_by_all(const CacheChange_t* change) const
 {
-    // Only asynchronous writers may have unacked (i.e. unsent changes)
-    if (isAsync())
+    // Only asynchronous or batching writers may have unacked (i.e. unsent changes)
+    if (isAsync() || is_batching())
     {
         std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
@@ -284,7 +323,13 @@ void StatelessWriter::send_any_unsent_changes()
     //TODO(Mcc) Separate sending for asynchronous writers
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
-    RTPSWriterCollector<ReaderLocator*> changesToSend;
+    // The collector is reused between calls, so the steady state does not allocate memory. A listener writing from
+    // onWriterChangeReceivedByAll enters again while it is in use, and gets a local one.
+    RTPSWriterCollector<ReaderLocator*> nestedChangesToSend;
+    bool nested = sending_changes_;
+    RTPSWriterCollector<ReaderLocator*>& changesToSend = nested ? nestedChangesToSend : *changes_to_send_;
+    changesToSend.clear();
+    sending_changes_ = true;
 
     for (const ChangeForReader_t& unsentChange : unsent_changes_)
     {
@@ -308,10 +353,8 @@ void StatelessWriter::send_any_unsent_changes()
         RTPSMessageGroup group(mp_RTPSParticipant, this,  m_cdrmessages, *this);
 
         bool bHasListener = mp_listener != nullptr;
-        while(!changesToSend.empty())
+        for (RTPSWriterCollector<ReaderLocator*>::Item& changeToSend : changesToSend)
         {
-            RTPSWriterCollector<ReaderLocator*>::Item changeToSend = changesToSend.pop();
-
             // Remove the messages selected for sending from the original list,
             // and update those that were fragmented with the new sent index
             update_unsent_changes(changeToSend.sequenceNumber, changeToSend.fragmentNumber);
@@ -319,7 +362,15 @@ void StatelessWriter::send_any_unsent_changes()
             // Notify the controllers
             FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
 
-            if(changeToSend.fragmentNumber != 0)
+            // Changes filtered out for every reader are not sent
+            bool should_send = !has_reader_filters() ||
+                    select_relevant_readers(*changeToSend.cacheChange, group) || !fixed_locators_.empty();
+
+            if(!should_send)
+            {
+                logInfo(RTPS_WRITER, "Change " << changeToSend.sequenceNumber << " filtered out for every reader");
+            }
+            else if(changeToSend.fragmentNumber != 0)
             {
                 if(!group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber,
                         is_inline_qos_expected_))
@@ -347,10 +398,61 @@ void StatelessWriter::send_any_unsent_changes()
         logError(RTPS_WRITER, "Max blocking time reached");
     }
 
+    changesToSend.clear();
+    sending_changes_ = nested;
+
+    restore_reader_selection();
+
     logInfo(RTPS_WRITER, "Finish sending unsent changes";);
 }
 
 
+bool StatelessWriter::is_relevant(
+        const CacheChange_t& change,
+        ReaderLocator& reader)
+{
+    return (reader_data_filter_ == nullptr || reader_data_filter_->is_relevant(change, reader.remote_guid())) &&
+           reader.time_based_filter().pass(change);
+}
+
+bool StatelessWriter::select_relevant_readers(
+        const CacheChange_t& change,
+        RTPSMessageGroup& group)
+{
+    bool relevant = false;
+
+    locator_selector_.reset(false);
+    for (ReaderLocator& reader : matched_readers_)
+    {
+        if (is_relevant(change, reader))
+        {
+            locator_selector_.enable(reader.remote_guid());
+            relevant = true;
+        }
+    }
+
+    if (locator_selector_.state_has_changed())
+    {
+        reader_selection_changed_ = true;
+        group.flush_and_reset();
+        mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+        if (!has_builtin_guid())
+        {
+            compute_selected_guids();
+        }
+    }
+
+    return relevant;
+}
+
+void StatelessWriter::restore_reader_selection()
+{
+    if (reader_selection_changed_)
+    {
+        update_reader_info(false);
+    }
+}
+
 /*
  *	MATCHED_READER-RELATED METHODS
  */
@@ -365,12 +467,22 @@ bool StatelessWriter::matched_reader_add(const ReaderProxyData& data)
         if(reader.remote_guid() == data.guid())
         {
             logWarning(RTPS_WRITER, "Attempting to add existing reader, updating information.");
+            if (reader_data_filter_ != nullptr)
+            {
+                reader_data_filter_->reader_matched(data);
+            }
+            bool filter_changed = reader.time_based_filter().minimum_separation(
+                data.m_qos.m_timeBasedFilter.minimum_separation);
             if (reader.update(data.remote_locators().unicast,
                 data.remote_locators().multicast,
                 data.m_expectsInlineQos))
             {
                 update_reader_info(true);
             }
+            else if (filter_changed)
+            {
+                update_reader_info(false);
+            }
             return false;
         }
     }
@@ -410,6 +522,13 @@ bool StatelessWriter::matched_reader_add(const ReaderProxyData& data)
         }
     }
 
+    if (reader_data_filter_ != nullptr)
+    {
+        reader_data_filter_->reader_matched(data);
+    }
+    new_reader->time_based_filter().max_instances(max_instances_);
+    new_reader->time_based_filter().minimum_separation(data.m_qos.m_timeBasedFilter.minimum_separation);
+
     // Add info of new datareader.
     locator_selector_.clear();
     for (ReaderLocator& reader : matched_readers_)
@@ -468,6 +587,11 @@ bool StatelessWriter::matched_reader_remove(const GUID_t& reader_guid)
         assert(found);
 
         update_reader_info(false);
+
+        if (reader_data_filter_ != nullptr)
+        {
+            reader_data_filter_->reader_unmatched(reader_guid);
+        }
     }
 
     return found;
@@ -21,18 +21,25 @@
 #include <fastrtps/rtps/security/common/Handle.h>
 #include <fastrtps/rtps/common/Token.h>
 #include "PermissionsTypes.h"
+#include "ExpressionIndex.h"
 #include <fastrtps/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastrtps/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
 #include <openssl/x509.h>
 #include <string>
+#include <list>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 namespace security {
 
+//! Maximum number of access decisions cached by an AccessPermissions.
+const size_t c_max_access_decisions = 1024;
+
 class AccessPermissions
 {
     public:
@@ -59,6 +66,31 @@ class AccessPermissions
         std::map<std::string, EndpointSecurityAttributes> governance_reader_topic_rules_;
         std::map<std::string, EndpointSecurityAttributes> governance_writer_topic_rules_;
         Grant grant;
+
+        //! Result of an access check, cached by topic and partitions.
+        struct AccessDecision
+        {
+            bool allowed;
+            bool relay_only;
+            std::string error;
+        };
+
+        //! Index over the keys of the governance topic rules. Positions follow the order of the maps.
+        ExpressionIndex governance_topic_index_;
+        std::vector<const EndpointSecurityAttributes*> governance_reader_attributes_;
+        std::vector<const EndpointSecurityAttributes*> governance_writer_attributes_;
+
+        //! Indexes over the topic expressions of the grant rules. Positions are the indexes on grant.rules.
+        ExpressionIndex publishes_index_;
+        ExpressionIndex subscribes_index_;
+        ExpressionIndex relays_index_;
+
+        typedef std::list<std::pair<std::string, AccessDecision>> AccessDecisionList;
+
+        mutable std::mutex decisions_mutex_;
+        //! Cached decisions, from the most to the least recently used. The last one is dropped when full.
+        mutable AccessDecisionList decisions_lru_;
+        mutable std::unordered_map<std::string, AccessDecisionList::iterator> decisions_;
 };
 
 typedef HandleImpl<AccessPermissions> AccessPermissionsHandle;
@@ -0,0 +1,143 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file ExpressionIndex.cpp
+ */
+
+#include "ExpressionIndex.h"
+
+#include <fastrtps/utils/StringMatching.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+const size_t ExpressionIndex::not_found;
+
+// Length of the part of the string before the first wildcard character.
+static size_t literal_length(const std::string& str)
+{
+#if defined(_WIN32)
+    // PathMatchSpec is case insensitive and supports lists of patterns, so nothing can be taken as literal.
+    (void)str;
+    return 0;
+#else
+    size_t pos = str.find_first_of("*?[");
+    return pos == std::string::npos ? str.size() : pos;
+#endif
+}
+
+static bool is_literal(const std::string& str)
+{
+#if defined(_WIN32)
+    (void)str;
+    return false;
+#else
+    return literal_length(str) == str.size();
+#endif
+}
+
+void ExpressionIndex::add(
+        const std::string& expression,
+        size_t position)
+{
+    Expression entry;
+    entry.expression = expression;
+    entry.prefix = expression.substr(0, literal_length(expression));
+    entry.position = position;
+
+    if(is_literal(expression))
+    {
+        std::vector<size_t>& positions = literals_[expression];
+        if(positions.empty() || positions.back() != position)
+        {
+            positions.push_back(position);
+        }
+    }
+    else
+    {
+        wildcards_.push_back(entry);
+    }
+
+    expressions_.push_back(std::move(entry));
+}
+
+size_t ExpressionIndex::first_match(
+        const std::string& name) const
+{
+    return first_match(name, [](size_t)
+            {
+                return true;
+            });
+}
+
+size_t ExpressionIndex::first_match(
+        const std::string& name,
+        const std::function<bool(size_t)>& accept) const
+{
+    if(!is_literal(name))
+    {
+        // The name is also used as a pattern by StringMatching, so every expression has to be evaluated.
+        for(const Expression& entry : expressions_)
+        {
+            if(accept(entry.position) &&
+                    StringMatching::matchString(entry.expression.c_str(), name.c_str()))
+            {
+                return entry.position;
+            }
+        }
+
+        return not_found;
+    }
+
+    size_t returned_value = not_found;
+
+    auto literal_it = literals_.find(name);
+    if(literal_it != literals_.end())
+    {
+        for(size_t position : literal_it->second)
+        {
+            if(accept(position))
+            {
+                returned_value = position;
+                break;
+            }
+        }
+    }
+
+    for(const Expression& entry : wildcards_)
+    {
+        if(entry.position >= returned_value)
+        {
+            break;
+        }
+
+        if(name.compare(0, entry.prefix.size(), entry.prefix) == 0 &&
+                accept(entry.position) &&
+                StringMatching::matchString(entry.expression.c_str(), name.c_str()))
+        {
+            returned_value = entry.position;
+            break;
+        }
+    }
+
+    return returned_value;
+}
+
+void ExpressionIndex::clear()
+{
+    literals_.clear();
+    wildcards_.clear();
+    expressions_.clear();
+}
@@ -0,0 +1,104 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file ExpressionIndex.h
+ */
+#ifndef __SECURITY_ACCESSCONTROL_EXPRESSIONINDEX_H__
+#define __SECURITY_ACCESSCONTROL_EXPRESSIONINDEX_H__
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/**
+ * Ordered collection of topic/partition expressions compiled for first-match lookups.
+ *
+ * Each expression is added with a position (i.e. the index of the rule it belongs to). A lookup returns the lowest
+ * position whose expression matches the given name, with the same semantics as StringMatching::matchString.
+ * Expressions without wildcards are kept in a hash table, and expressions with wildcards are only evaluated when
+ * the name starts with their literal prefix.
+ */
+class ExpressionIndex
+{
+    public:
+
+        static const size_t not_found = std::numeric_limits<size_t>::max();
+
+        /**
+         * Add an expression.
+         * @param expression Topic or partition expression, as it appears on the permissions or governance document.
+         * @param position Position of the rule owning the expression. Must not decrease between calls.
+         */
+        void add(
+                const std::string& expression,
+                size_t position);
+
+        /**
+         * Find the first position with an expression matching a name.
+         * @param name Name to look for.
+         * @return Lowest position matching the name, or not_found.
+         */
+        size_t first_match(
+                const std::string& name) const;
+
+        /**
+         * Find the first accepted position with an expression matching a name.
+         * @param name Name to look for.
+         * @param accept Functor called with a candidate position. Positions for which it returns false are skipped.
+         * @return Lowest accepted position matching the name, or not_found.
+         */
+        size_t first_match(
+                const std::string& name,
+                const std::function<bool(size_t)>& accept) const;
+
+        void clear();
+
+        bool empty() const
+        {
+            return expressions_.empty();
+        }
+
+    private:
+
+        struct Expression
+        {
+            std::string expression;
+            std::string prefix;
+            size_t position;
+        };
+
+        //! Positions of expressions without wildcards, in increasing order.
+        std::unordered_map<std::string, std::vector<size_t>> literals_;
+
+        //! Expressions with wildcards, in increasing position order.
+        std::vector<Expression> wildcards_;
+
+        //! All the expressions, in increasing position order.
+        std::vector<Expression> expressions_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // __SECURITY_ACCESSCONTROL_EXPRESSIONINDEX_H__
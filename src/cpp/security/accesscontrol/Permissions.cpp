@@ -83,33 +83,23 @@ static bool is_domain_in_set(const uint32_t domain_id, const Domains& domains)
     return returned_value;
 }
 
-static const EndpointSecurityAttributes* is_topic_in_sec_attributes(const char* topic_name,
-        const std::map<std::string, EndpointSecurityAttributes>& attributes)
+static const EndpointSecurityAttributes* is_topic_in_sec_attributes(const std::string& topic_name,
+        const ExpressionIndex& index, const std::vector<const EndpointSecurityAttributes*>& attributes)
 {
-    const EndpointSecurityAttributes* returned_value = nullptr;
-
-    for(auto& topic : attributes)
-    {
-        if(StringMatching::matchString(topic.first.c_str(), topic_name))
-        {
-            returned_value = &topic.second;
-            break;
-        }
-    }
-
-    return returned_value;
+    size_t position = index.first_match(topic_name);
+    return position != ExpressionIndex::not_found ? attributes[position] : nullptr;
 }
 
-static bool is_topic_in_criterias(const char * topic_name, const std::vector<Criteria>& criterias)
+static bool is_partition_in_criterias(const std::string& partition, const std::vector<Criteria>& criterias)
 {
     bool returned_value = false;
 
     for(auto criteria_it = criterias.begin(); !returned_value &&
             criteria_it != criterias.end(); ++criteria_it)
     {
-        for(auto topic : (*criteria_it).topics)
+        for(auto part : (*criteria_it).partitions)
         {
-            if(StringMatching::matchString(topic.c_str(), topic_name))
+            if(StringMatching::matchString(partition.c_str(), part.c_str()))
             {
                 returned_value = true;
                 break;
@@ -120,24 +110,134 @@ static bool is_topic_in_criterias(const char * topic_name, const std::vector<Cri
     return returned_value;
 }
 
-static bool is_partition_in_criterias(const std::string& partition, const std::vector<Criteria>& criterias)
+static void compile_access_index(AccessPermissionsHandle& handle)
 {
-    bool returned_value = false;
+    AccessPermissions& permissions = **handle;
 
-    for(auto criteria_it = criterias.begin(); !returned_value &&
-            criteria_it != criterias.end(); ++criteria_it)
+    permissions.governance_topic_index_.clear();
+    permissions.governance_reader_attributes_.clear();
+    permissions.governance_writer_attributes_.clear();
+
+    size_t position = 0;
+    for(const auto& topic_rule : permissions.governance_writer_topic_rules_)
     {
-        for(auto part : (*criteria_it).partitions)
+        auto reader_rule = permissions.governance_reader_topic_rules_.find(topic_rule.first);
+        permissions.governance_topic_index_.add(topic_rule.first, position++);
+        permissions.governance_writer_attributes_.push_back(&topic_rule.second);
+        permissions.governance_reader_attributes_.push_back(
+                reader_rule != permissions.governance_reader_topic_rules_.end() ? &reader_rule->second : nullptr);
+    }
+
+    permissions.publishes_index_.clear();
+    permissions.subscribes_index_.clear();
+    permissions.relays_index_.clear();
+
+    for(size_t rule_index = 0; rule_index < permissions.grant.rules.size(); ++rule_index)
+    {
+        const Rule& rule = permissions.grant.rules[rule_index];
+
+        for(const Criteria& criteria : rule.publishes)
         {
-            if(StringMatching::matchString(partition.c_str(), part.c_str()))
+            for(const std::string& topic : criteria.topics)
             {
-                returned_value = true;
-                break;
+                permissions.publishes_index_.add(topic, rule_index);
+            }
+        }
+
+        for(const Criteria& criteria : rule.subscribes)
+        {
+            for(const std::string& topic : criteria.topics)
+            {
+                permissions.subscribes_index_.add(topic, rule_index);
+            }
+        }
+
+        for(const Criteria& criteria : rule.relays)
+        {
+            for(const std::string& topic : criteria.topics)
+            {
+                permissions.relays_index_.add(topic, rule_index);
             }
         }
     }
 
-    return returned_value;
+    std::lock_guard<std::mutex> guard(permissions.decisions_mutex_);
+    permissions.decisions_.clear();
+    permissions.decisions_lru_.clear();
+}
+
+static std::string decision_key(char kind, uint32_t domain_id, const std::string& topic_name,
+        const std::vector<std::string>& partitions)
+{
+    std::string key(1, kind);
+    key.append(std::to_string(domain_id));
+    key.push_back('\0');
+    key.append(topic_name);
+
+    for(const std::string& partition : partitions)
+    {
+        key.push_back('\0');
+        key.append(partition);
+    }
+
+    return key;
+}
+
+static bool find_decision(const AccessPermissions& permissions, const std::string& key,
+        bool& allowed, bool& relay_only, SecurityException& exception)
+{
+    std::lock_guard<std::mutex> guard(permissions.decisions_mutex_);
+    auto it = permissions.decisions_.find(key);
+
+    if(it == permissions.decisions_.end())
+    {
+        return false;
+    }
+
+    permissions.decisions_lru_.splice(permissions.decisions_lru_.begin(), permissions.decisions_lru_, it->second);
+
+    const AccessPermissions::AccessDecision& decision = it->second->second;
+    allowed = decision.allowed;
+    relay_only = decision.relay_only;
+    if(!decision.error.empty())
+    {
+        exception = SecurityException(decision.error);
+    }
+
+    return true;
+}
+
+static bool store_decision(const AccessPermissions& permissions, const std::string& key,
+        bool allowed, bool relay_only, const SecurityException& exception)
+{
+    AccessPermissions::AccessDecision decision;
+    decision.allowed = allowed;
+    decision.relay_only = relay_only;
+    if(!allowed)
+    {
+        decision.error = exception.what();
+    }
+
+    std::lock_guard<std::mutex> guard(permissions.decisions_mutex_);
+    auto it = permissions.decisions_.find(key);
+
+    if(it != permissions.decisions_.end())
+    {
+        it->second->second = std::move(decision);
+        permissions.decisions_lru_.splice(permissions.decisions_lru_.begin(), permissions.decisions_lru_, it->second);
+        return allowed;
+    }
+
+    if(permissions.decisions_lru_.size() >= c_max_access_decisions)
+    {
+        permissions.decisions_.erase(permissions.decisions_lru_.back().first);
+        permissions.decisions_lru_.pop_back();
+    }
+
+    permissions.decisions_lru_.emplace_front(key, std::move(decision));
+    permissions.decisions_[key] = permissions.decisions_lru_.begin();
+
+    return allowed;
 }
 
 static bool is_validation_in_time(const Validity& validity)
@@ -802,6 +902,8 @@ PermissionsHandle* Permissions::validate_local_permissions(Authentication&,
                 // Check subject name.
                 if(check_subject_name(identity, *ah, domain_id, rules, permissions_data, exception))
                 {
+                    compile_access_index(*ah);
+
                     if(generate_permissions_token(*ah))
                     {
                         if(generate_credentials_token(*ah, *permissions, exception))
@@ -966,6 +1068,7 @@ PermissionsHandle* Permissions::validate_remote_permissions(Authentication&,
     (*handle)->governance_rule_ = lph->governance_rule_;
     (*handle)->governance_reader_topic_rules_ = lph->governance_reader_topic_rules_;
     (*handle)->governance_writer_topic_rules_ = lph->governance_writer_topic_rules_;
+    compile_access_index(*handle);
 
     return handle;
 }
@@ -1038,24 +1141,17 @@ bool Permissions::check_remote_participant(const PermissionsHandle& remote_handl
     return returned_value;
 }
 
-bool Permissions::check_create_datawriter(const PermissionsHandle& local_handle,
-        const uint32_t /*domain_id*/, const std::string& topic_name,
-        const std::vector<std::string>& partitions, SecurityException& exception)
+static bool check_local_endpoint(const AccessPermissions& permissions, const std::string& topic_name,
+        const std::vector<std::string>& partitions, bool is_writer, SecurityException& exception)
 {
     bool returned_value = false;
-    const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
-
-    if(lah.nil())
-    {
-        exception = _SecurityException_("Bad precondition");
-        return false;
-    }
-
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_writer_topic_rules_)) != nullptr)
+    if((attributes = is_topic_in_sec_attributes(topic_name, permissions.governance_topic_index_,
+                    is_writer ? permissions.governance_writer_attributes_ : permissions.governance_reader_attributes_))
+            != nullptr)
     {
-        if(!attributes->is_write_protected)
+        if(is_writer ? !attributes->is_write_protected : !attributes->is_read_protected)
         {
             return true;
         }
@@ -1067,42 +1163,43 @@ bool Permissions::check_create_datawriter(const PermissionsHandle& local_handle,
     }
 
     // Search topic
-    for(auto rule : lah->grant.rules)
+    size_t rule_index = (is_writer ? permissions.publishes_index_ : permissions.subscribes_index_).first_match(
+            topic_name);
+
+    if(rule_index != ExpressionIndex::not_found)
     {
-        if(is_topic_in_criterias(topic_name.c_str(), rule.publishes))
+        const Rule& rule = permissions.grant.rules[rule_index];
+        const std::vector<Criteria>& criterias = is_writer ? rule.publishes : rule.subscribes;
+
+        if(rule.allow)
         {
-            if(rule.allow)
-            {
-                returned_value = true;
+            returned_value = true;
 
-                if (partitions.empty())
+            if (partitions.empty())
+            {
+                if (!is_partition_in_criterias(std::string(), criterias))
                 {
-                    if (!is_partition_in_criterias(std::string(), rule.publishes))
-                    {
-                        returned_value = false;
-                        exception = _SecurityException_(std::string("<empty> partition not found in rule."));
-                    }
+                    returned_value = false;
+                    exception = _SecurityException_(std::string("<empty> partition not found in rule."));
                 }
-                else
+            }
+            else
+            {
+                // Search partitions
+                for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
+                    ++partition_it)
                 {
-                    // Search partitions
-                    for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
-                        ++partition_it)
+                    if (!is_partition_in_criterias(*partition_it, criterias))
                     {
-                        if (!is_partition_in_criterias(*partition_it, rule.publishes))
-                        {
-                            returned_value = false;
-                            exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
-                        }
+                        returned_value = false;
+                        exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
                     }
                 }
             }
-            else
-            {
-                exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
-            }
-
-            break;
+        }
+        else
+        {
+            exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
         }
     }
 
@@ -1114,11 +1211,10 @@ bool Permissions::check_create_datawriter(const PermissionsHandle& local_handle,
     return returned_value;
 }
 
-bool Permissions::check_create_datareader(const PermissionsHandle& local_handle,
-        const uint32_t /*domain_id*/, const std::string& topic_name,
+bool Permissions::check_create_datawriter(const PermissionsHandle& local_handle,
+        const uint32_t domain_id, const std::string& topic_name,
         const std::vector<std::string>& partitions, SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
 
     if(lah.nil())
@@ -1127,66 +1223,42 @@ bool Permissions::check_create_datareader(const PermissionsHandle& local_handle,
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
+    bool returned_value = false;
+    bool relay_only = false;
+    std::string key = decision_key('w', domain_id, topic_name, partitions);
 
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_reader_topic_rules_)) != nullptr)
+    if(find_decision(**lah, key, returned_value, relay_only, exception))
     {
-        if(!attributes->is_read_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
-        return false;
+        return returned_value;
     }
 
-    for(auto rule : lah->grant.rules)
-    {
-        if(is_topic_in_criterias(topic_name.c_str(), rule.subscribes))
-        {
-            if(rule.allow)
-            {
-                returned_value = true;
+    returned_value = check_local_endpoint(**lah, topic_name, partitions, true, exception);
+    return store_decision(**lah, key, returned_value, false, exception);
+}
 
-                if (partitions.empty())
-                {
-                    if (!is_partition_in_criterias(std::string(), rule.subscribes))
-                    {
-                        returned_value = false;
-                        exception = _SecurityException_(std::string("<empty> partition not found in rule."));
-                    }
-                }
-                else
-                {
-                    // Search partitions
-                    for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
-                        ++partition_it)
-                    {
-                        if (!is_partition_in_criterias(*partition_it, rule.subscribes))
-                        {
-                            returned_value = false;
-                            exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
-                        }
-                    }
-                }
-            }
-            else
-            {
-                exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
-            }
+bool Permissions::check_create_datareader(const PermissionsHandle& local_handle,
+        const uint32_t domain_id, const std::string& topic_name,
+        const std::vector<std::string>& partitions, SecurityException& exception)
+{
+    const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
 
-            break;
-        }
+    if(lah.nil())
+    {
+        exception = _SecurityException_("Bad precondition");
+        return false;
     }
 
-    if(!returned_value && strlen(exception.what()) == 0)
+    bool returned_value = false;
+    bool relay_only = false;
+    std::string key = decision_key('r', domain_id, topic_name, partitions);
+
+    if(find_decision(**lah, key, returned_value, relay_only, exception))
     {
-        exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
+        return returned_value;
     }
 
-    return returned_value;
+    returned_value = check_local_endpoint(**lah, topic_name, partitions, false, exception);
+    return store_decision(**lah, key, returned_value, false, exception);
 }
 
 bool Permissions::check_remote_datawriter(const PermissionsHandle& remote_handle,
@@ -1202,50 +1274,56 @@ bool Permissions::check_remote_datawriter(const PermissionsHandle& remote_handle
         return false;
     }
 
+    const std::string topic_name = publication_data.topicName().to_string();
+    bool relay_only = false;
+    std::string key = decision_key('W', domain_id, topic_name, std::vector<std::string>());
+
+    if(find_decision(**rah, key, returned_value, relay_only, exception))
+    {
+        return returned_value;
+    }
+
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if((attributes = is_topic_in_sec_attributes(publication_data.topicName().c_str(),rah->governance_writer_topic_rules_))
-            != nullptr)
+    if((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_index_,
+                    rah->governance_writer_attributes_)) != nullptr)
     {
         if(!attributes->is_write_protected)
         {
-            return true;
+            return store_decision(**rah, key, true, false, exception);
         }
     }
     else
     {
-        exception = _SecurityException_("Not found topic access rule for topic " + publication_data.topicName().to_string());
-        return false;
+        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
+        return store_decision(**rah, key, false, false, exception);
     }
 
-    for(auto rule : rah->grant.rules)
+    auto in_domain = [&rah, domain_id](size_t rule_index) -> bool
     {
-        if(is_domain_in_set(domain_id, rule.domains))
-        {
-            if(is_topic_in_criterias(publication_data.topicName().c_str(), rule.publishes))
-            {
-                if(rule.allow)
-                {
-                    returned_value = true;
-                }
-                else
-                {
-                    exception = _SecurityException_(publication_data.topicName().to_string() +
-                            std::string(" topic denied by deny rule."));
-                }
+        return is_domain_in_set(domain_id, rah->grant.rules[rule_index].domains);
+    };
 
-                break;
-            }
+    size_t rule_index = rah->publishes_index_.first_match(topic_name, in_domain);
+
+    if(rule_index != ExpressionIndex::not_found)
+    {
+        if(rah->grant.rules[rule_index].allow)
+        {
+            returned_value = true;
+        }
+        else
+        {
+            exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
         }
     }
 
     if(!returned_value && strlen(exception.what()) == 0)
     {
-        exception = _SecurityException_(publication_data.topicName().to_string() +
-                std::string(" topic not found in allow rule."));
+        exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
     }
 
-    return returned_value;
+    return store_decision(**rah, key, returned_value, false, exception);
 }
 
 bool Permissions::check_remote_datareader(const PermissionsHandle& remote_handle,
@@ -1263,61 +1341,65 @@ bool Permissions::check_remote_datareader(const PermissionsHandle& remote_handle
         return false;
     }
 
+    const std::string topic_name = subscription_data.topicName().to_string();
+    std::string key = decision_key('R', domain_id, topic_name, std::vector<std::string>());
+
+    if(find_decision(**rah, key, returned_value, relay_only, exception))
+    {
+        return returned_value;
+    }
+
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if((attributes = is_topic_in_sec_attributes(subscription_data.topicName().c_str(),rah->governance_reader_topic_rules_))
-            != nullptr)
+    if((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_index_,
+                    rah->governance_reader_attributes_)) != nullptr)
     {
         if(!attributes->is_read_protected)
         {
-            return true;
+            return store_decision(**rah, key, true, false, exception);
         }
     }
     else
     {
-        exception = _SecurityException_("Not found topic access rule for topic " + subscription_data.topicName().to_string());
-        return false;
+        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
+        return store_decision(**rah, key, false, false, exception);
     }
 
-    for(auto rule : rah->grant.rules)
+    auto in_domain = [&rah, domain_id](size_t rule_index) -> bool
     {
-        if(is_domain_in_set(domain_id, rule.domains))
-        {
-            if(is_topic_in_criterias(subscription_data.topicName(), rule.subscribes))
-            {
-                if(rule.allow)
-                {
-                    returned_value = true;
-                }
-                else
-                {
-                    exception = _SecurityException_(subscription_data.topicName().to_string() +
-                            std::string(" topic denied by deny rule."));
-                }
-
-                break;
-            }
+        return is_domain_in_set(domain_id, rah->grant.rules[rule_index].domains);
+    };
 
-            if (is_topic_in_criterias(subscription_data.topicName(), rule.relays))
-            {
-                if (rule.allow)
-                {
-                    relay_only = true;
-                    returned_value = true;
-                }
+    // The first rule matching the topic in any of its subscribe or relay criterias decides.
+    size_t subscribe_index = rah->subscribes_index_.first_match(topic_name, in_domain);
+    size_t relay_index = rah->relays_index_.first_match(topic_name, in_domain);
 
-                break;
-            }
+    if(subscribe_index != ExpressionIndex::not_found && subscribe_index <= relay_index)
+    {
+        if(rah->grant.rules[subscribe_index].allow)
+        {
+            returned_value = true;
+        }
+        else
+        {
+            exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
+        }
+    }
+    else if(relay_index != ExpressionIndex::not_found)
+    {
+        if (rah->grant.rules[relay_index].allow)
+        {
+            relay_only = true;
+            returned_value = true;
         }
     }
 
     if(!returned_value && strlen(exception.what()) == 0)
     {
-        exception = _SecurityException_(subscription_data.topicName().to_string() +
-                std::string(" topic not found in allow rule."));
+        exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
     }
 
-    return returned_value;
+    return store_decision(**rah, key, returned_value, relay_only, exception);
 }
 
 bool Permissions::get_participant_sec_attributes(const PermissionsHandle& local_handle,
@@ -1343,8 +1425,8 @@ bool Permissions::get_datawriter_sec_attributes(const PermissionsHandle& permiss
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_writer_topic_rules_))
-            != nullptr)
+    if((attr = is_topic_in_sec_attributes(topic_name, lah->governance_topic_index_,
+                    lah->governance_writer_attributes_)) != nullptr)
     {
         attributes = *attr;
         return true;
@@ -1364,8 +1446,8 @@ bool Permissions::get_datareader_sec_attributes(const PermissionsHandle& permiss
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_reader_topic_rules_))
-            != nullptr)
+    if((attr = is_topic_in_sec_attributes(topic_name, lah->governance_topic_index_,
+                    lah->governance_reader_attributes_)) != nullptr)
     {
         attributes = *attr;
         return true;
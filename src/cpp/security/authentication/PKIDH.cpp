@@ -954,6 +954,115 @@ static bool generate_identity_token(PKIIdentityHandle& handle)
     return true;
 }
 
+PKIDH::PKIDH()
+    : dh_keys_pool_size_(0)
+    , dh_keys_running_(false)
+{
+}
+
+PKIDH::~PKIDH()
+{
+    {
+        std::lock_guard<std::mutex> guard(dh_keys_mutex_);
+        dh_keys_running_ = false;
+    }
+    dh_keys_cv_.notify_all();
+
+    if(dh_keys_thread_.joinable())
+    {
+        dh_keys_thread_.join();
+    }
+
+    for(auto& pool : dh_keys_pool_)
+    {
+        for(EVP_PKEY* key : pool.second)
+        {
+            EVP_PKEY_free(key);
+        }
+    }
+}
+
+EVP_PKEY* PKIDH::get_dh_key(int type, SecurityException& exception)
+{
+    {
+        std::lock_guard<std::mutex> guard(dh_keys_mutex_);
+
+        if(dh_keys_running_)
+        {
+            // Creates the entry the first time, so the generation thread starts filling it.
+            std::vector<EVP_PKEY*>& pool = dh_keys_pool_[type];
+            EVP_PKEY* key = nullptr;
+
+            if(!pool.empty())
+            {
+                key = pool.back();
+                pool.pop_back();
+            }
+
+            dh_keys_cv_.notify_one();
+
+            if(key != nullptr)
+            {
+                return key;
+            }
+        }
+    }
+
+    return generate_dh_key(type, exception);
+}
+
+void PKIDH::start_dh_keys_generation(int type, size_t pool_size)
+{
+    std::lock_guard<std::mutex> guard(dh_keys_mutex_);
+
+    if(!dh_keys_running_ && pool_size > 0)
+    {
+        dh_keys_pool_size_ = pool_size;
+        dh_keys_pool_[type].reserve(pool_size);
+        dh_keys_running_ = true;
+        dh_keys_thread_ = std::thread(&PKIDH::run_dh_keys_generation, this);
+    }
+}
+
+void PKIDH::run_dh_keys_generation()
+{
+    std::unique_lock<std::mutex> lock(dh_keys_mutex_);
+
+    while(dh_keys_running_)
+    {
+        int type = 0;
+
+        for(auto& pool : dh_keys_pool_)
+        {
+            if(pool.second.size() < dh_keys_pool_size_)
+            {
+                type = pool.first;
+                break;
+            }
+        }
+
+        if(type == 0)
+        {
+            dh_keys_cv_.wait(lock);
+            continue;
+        }
+
+        lock.unlock();
+        SecurityException exception;
+        EVP_PKEY* key = generate_dh_key(type, exception);
+        lock.lock();
+
+        if(key == nullptr)
+        {
+            logWarning(SECURITY_AUTHENTICATION, "Cannot pre-generate key agreement keys: " << exception.what());
+            dh_keys_running_ = false;
+            break;
+        }
+
+        dh_keys_pool_[type].push_back(key);
+    }
+}
+
 ValidationResult_t PKIDH::validate_local_identity(IdentityHandle** local_identity_handle,
         GUID_t& adjusted_participant_key,
         const uint32_t /*domain_id*/,
@@ -1069,6 +1178,22 @@ ValidationResult_t PKIDH::validate_local_identity(IdentityHandle** local_identit
                                     (*ih)->participant_key_ = adjusted_participant_key;
                                     *local_identity_handle = ih;
 
+                                    std::string* preallocated_dh_keys =
+                                        PropertyPolicyHelper::find_property(auth_properties, "preallocated_dh_keys");
+                                    if(preallocated_dh_keys != nullptr)
+                                    {
+                                        try
+                                        {
+                                            start_dh_keys_generation(get_dh_type((*ih)->kagree_alg_),
+                                                    std::stoul(*preallocated_dh_keys));
+                                        }
+                                        catch(std::logic_error&)
+                                        {
+                                            logWarning(SECURITY_AUTHENTICATION,
+                                                    "Wrong value for dds.sec.auth.builtin.PKI-DH.preallocated_dh_keys");
+                                        }
+                                    }
+
                                     return ValidationResult_t::VALIDATION_OK;
                                 }
                             }
@@ -1228,7 +1353,7 @@ ValidationResult_t PKIDH::begin_handshake_request(HandshakeHandle** handshake_ha
     (*handshake_handle_aux)->handshake_message_.binary_properties().push_back(std::move(bproperty));
 
     // dh1
-    if(((*handshake_handle_aux)->dhkeys_ = generate_dh_key(get_dh_type((*handshake_handle_aux)->kagree_alg_), exception)) != nullptr)
+    if(((*handshake_handle_aux)->dhkeys_ = get_dh_key(get_dh_type((*handshake_handle_aux)->kagree_alg_), exception)) != nullptr)
     {
         bproperty.name("dh1");
         bproperty.propagate(true);
@@ -1597,7 +1722,7 @@ ValidationResult_t PKIDH::begin_handshake_reply(HandshakeHandle** handshake_hand
     (*handshake_handle_aux)->handshake_message_.binary_properties().push_back(std::move(bproperty));
 
     // dh2
-    if(((*handshake_handle_aux)->dhkeys_ = generate_dh_key(kagree_kind, exception)) != nullptr)
+    if(((*handshake_handle_aux)->dhkeys_ = get_dh_key(kagree_kind, exception)) != nullptr)
     {
         bproperty.name("dh2");
         bproperty.propagate(true);
@@ -23,6 +23,12 @@
 #include <fastrtps/rtps/attributes/PropertyPolicy.h>
 #include "PKIHandshakeHandle.h"
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -32,6 +38,10 @@ class PKIDH : public Authentication
 {
     public:
 
+        PKIDH();
+
+        ~PKIDH();
+
         ValidationResult_t validate_local_identity(IdentityHandle** local_identity_handle,
                 GUID_t& adjusted_participant_key,
                 const uint32_t domain_id,
@@ -99,6 +109,17 @@ class PKIDH : public Authentication
 
     private:
 
+        /**
+         * Get an ephemeral key pair for the key agreement.
+         * When property dds.sec.auth.builtin.PKI-DH.preallocated_dh_keys is set, the key pair is taken from the
+         * pool filled in the background, falling back to inline generation when the pool is empty.
+         */
+        EVP_PKEY* get_dh_key(int type, SecurityException& exception);
+
+        void start_dh_keys_generation(int type, size_t pool_size);
+
+        void run_dh_keys_generation();
+
         ValidationResult_t process_handshake_request(HandshakeMessageToken** handshake_message_out,
                 HandshakeMessageToken&& handshake_message_in,
                 PKIHandshakeHandle& handshake_handle,
@@ -109,6 +130,18 @@ class PKIDH : public Authentication
                 PKIHandshakeHandle& handshake_handle,
                 SecurityException& exception);
 
+        std::mutex dh_keys_mutex_;
+
+        std::condition_variable dh_keys_cv_;
+
+        //! Pre-generated ephemeral key pairs, by key agreement type.
+        std::map<int, std::vector<EVP_PKEY*>> dh_keys_pool_;
+
+        size_t dh_keys_pool_size_;
+
+        bool dh_keys_running_;
+
+        std::thread dh_keys_thread_;
 };
 
 } //namespace security
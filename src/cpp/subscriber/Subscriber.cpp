@@ -44,6 +44,51 @@ bool Subscriber::takeNextData(void* data,SampleInfo_t* info)
     return mp_impl->takeNextData(data,info);
 }
 
+uint32_t Subscriber::read(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds)
+{
+    return mp_impl->read(samples, infos, max_samples, instance, sample_states, sample_kinds);
+}
+
+uint32_t Subscriber::take(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds)
+{
+    return mp_impl->take(samples, infos, max_samples, instance, sample_states, sample_kinds);
+}
+
+uint32_t Subscriber::take_loans(
+        const void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds)
+{
+    return mp_impl->take_loans(samples, infos, max_samples, instance, sample_states, sample_kinds);
+}
+
+bool Subscriber::take_loan(
+        const void*& sample,
+        SampleInfo_t* info)
+{
+    return mp_impl->take_loan(sample, info);
+}
+
+bool Subscriber::return_loan(const void*& sample)
+{
+    return mp_impl->return_loan(sample);
+}
+
 bool Subscriber::updateAttributes(const SubscriberAttributes& att)
 {
     return mp_impl->updateAttributes(att);
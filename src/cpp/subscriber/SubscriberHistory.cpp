@@ -22,6 +22,7 @@
 
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include "../rtps/reader/WriterProxy.h"
+#include "../utils/KeyHashCache.h"
 
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/log/Log.h>
@@ -57,6 +58,7 @@ SubscriberHistory::SubscriberHistory(
     , m_resourceLimitsQos(resource)
     , mp_subImpl(simpl)
     , mp_getKeyObject(nullptr)
+    , key_hash_cache_(new KeyHashCache(simpl->getType()))
 {
     if (mp_subImpl->getType()->m_isGetKeyDefined)
     {
@@ -162,7 +164,7 @@ bool SubscriberHistory::received_change(
 #if HAVE_SECURITY
             is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
 #endif
-            if(!mp_subImpl->getType()->getKey(mp_getKeyObject, &a_change->instanceHandle, is_key_protected))
+            if(!key_hash_cache_->get_key(mp_getKeyObject, a_change->instanceHandle, is_key_protected))
                 return false;
 
         }
@@ -296,7 +298,7 @@ bool SubscriberHistory::readNextBuffer(SerializedPayload_t* data, SampleInfo_t*
             if (this->mp_subImpl->getAttributes().topic.topicKind == WITH_KEY &&
                 change->instanceHandle == c_InstanceHandle_Unknown && change->kind == ALIVE)
             {
-                this->mp_subImpl->getType()->getKey(data, &change->instanceHandle);
+                key_hash_cache_->get_key(data, change->instanceHandle, false);
             }
             info->iHandle = change->instanceHandle;
             info->related_sample_identity = change->write_params.sample_identity();
@@ -392,7 +394,7 @@ bool SubscriberHistory::readNextData(
 #if HAVE_SECURITY
                     is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
 #endif
-                    this->mp_subImpl->getType()->getKey(data, &change->instanceHandle, is_key_protected);
+                    key_hash_cache_->get_key(data, change->instanceHandle, is_key_protected);
                 }
                 info->iHandle = change->instanceHandle;
                 info->related_sample_identity = change->write_params.sample_identity();
@@ -429,29 +431,58 @@ bool SubscriberHistory::takeNextData(
             {
                 this->mp_subImpl->getType()->deserialize(&change->serializedPayload, data);
             }
-            if (info != nullptr)
+            get_sample_info(change, wp, data, info);
+            this->remove_change_sub(change);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool SubscriberHistory::take_next_loan(
+        void*& sample,
+        CacheChange_t*& change,
+        SampleInfo_t* info,
+        std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(RTPS_HISTORY, "You need to create a Reader with this History before using it");
+        return false;
+    }
+
+    std::unique_lock<RecursiveTimedMutex> lock(*mp_mutex, std::defer_lock);
+
+    if(lock.try_lock_until(max_blocking_time))
+    {
+        WriterProxy * wp;
+        if (this->mp_reader->nextUntakenCache(&change, &wp))
+        {
+            logInfo(SUBSCRIBER, this->mp_reader->getGuid().entityId << ": loaning seqNum" << change->sequenceNumber <<
+                    " from writer: " << change->writerGUID);
+            TopicDataType* type = this->mp_subImpl->getType();
+            if (is_payload_loanable(change))
             {
-                info->sampleKind = change->kind;
-                info->sample_identity.writer_guid(change->writerGUID);
-                info->sample_identity.sequence_number(change->sequenceNumber);
-                info->sourceTimestamp = change->sourceTimestamp;
-                if (this->mp_subImpl->getAttributes().qos.m_ownership.kind == EXCLUSIVE_OWNERSHIP_QOS)
+                sample = change->serializedPayload.data + SerializedPayload_t::representation_header_size;
+                get_sample_info(change, wp, sample, info);
+                if (!remove_change_sub(change, false))
                 {
-                    info->ownershipStrength = wp->ownership_strength();
-                }
-                if (this->mp_subImpl->getAttributes().topic.topicKind == WITH_KEY &&
-                        change->instanceHandle == c_InstanceHandle_Unknown && change->kind == ALIVE)
-                {
-                    bool is_key_protected = false;
-#if HAVE_SECURITY
-                    is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
-#endif
-                    this->mp_subImpl->getType()->getKey(data, &change->instanceHandle, is_key_protected);
+                    sample = nullptr;
+                    change = nullptr;
+                    return false;
                 }
-                info->iHandle = change->instanceHandle;
-                info->related_sample_identity = change->write_params.sample_identity();
+                return true;
             }
-            this->remove_change_sub(change);
+
+            sample = type->createData();
+            if (change->kind == ALIVE)
+            {
+                type->deserialize(&change->serializedPayload, sample);
+            }
+            get_sample_info(change, wp, sample, info);
+            remove_change_sub(change);
+            change = nullptr;
             return true;
         }
     }
@@ -459,6 +490,233 @@ bool SubscriberHistory::takeNextData(
     return false;
 }
 
+uint32_t SubscriberHistory::read(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds,
+        std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    return get_sample_copies(samples, infos, max_samples, instance, sample_states, sample_kinds, false,
+            max_blocking_time);
+}
+
+uint32_t SubscriberHistory::take(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds,
+        std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    return get_sample_copies(samples, infos, max_samples, instance, sample_states, sample_kinds, true,
+            max_blocking_time);
+}
+
+uint32_t SubscriberHistory::get_sample_copies(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds,
+        bool take,
+        std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    TopicDataType* type = this->mp_subImpl->getType();
+    return get_samples(max_samples, instance, sample_states, sample_kinds, take, max_blocking_time,
+            [&](CacheChange_t* change, WriterProxy* wp, uint32_t index) -> bool
+            {
+                if (change->kind == ALIVE)
+                {
+                    type->deserialize(&change->serializedPayload, samples[index]);
+                }
+                get_sample_info(change, wp, samples[index], infos != nullptr ? &infos[index] : nullptr);
+                return true;
+            });
+}
+
+uint32_t SubscriberHistory::take_loans(
+        void** samples,
+        CacheChange_t** changes,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds,
+        std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    TopicDataType* type = this->mp_subImpl->getType();
+    return get_samples(max_samples, instance, sample_states, sample_kinds, true, max_blocking_time,
+            [&](CacheChange_t* change, WriterProxy* wp, uint32_t index) -> bool
+            {
+                if (is_payload_loanable(change))
+                {
+                    samples[index] = change->serializedPayload.data + SerializedPayload_t::representation_header_size;
+                    changes[index] = change;
+                }
+                else
+                {
+                    samples[index] = type->createData();
+                    changes[index] = nullptr;
+                    if (change->kind == ALIVE)
+                    {
+                        type->deserialize(&change->serializedPayload, samples[index]);
+                    }
+                }
+                get_sample_info(change, wp, samples[index], infos != nullptr ? &infos[index] : nullptr);
+                return changes[index] == nullptr;
+            });
+}
+
+uint32_t SubscriberHistory::get_samples(
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds,
+        bool take,
+        std::chrono::steady_clock::time_point& max_blocking_time,
+        const std::function<bool(CacheChange_t*, WriterProxy*, uint32_t)>& process)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(RTPS_HISTORY, "You need to create a Reader with this History before using it");
+        return 0;
+    }
+
+    std::unique_lock<RecursiveTimedMutex> lock(*mp_mutex, std::defer_lock);
+
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return 0;
+    }
+
+    // When an instance is given only its changes are visited
+    std::vector<CacheChange_t*>* changes = &m_changes;
+    if (instance.isDefined())
+    {
+        if (mp_subImpl->getAttributes().topic.getTopicKind() == NO_KEY)
+        {
+            return 0;
+        }
+
+        auto vit = keyed_changes_.find(instance);
+        if (vit == keyed_changes_.end())
+        {
+            return 0;
+        }
+        changes = &vit->second.cache_changes;
+    }
+
+    uint32_t count = 0;
+    size_t pos = 0;
+    while (count < max_samples && pos < changes->size())
+    {
+        CacheChange_t* change = (*changes)[pos];
+        WriterProxy* wp = nullptr;
+        bool unpaired = false;
+        if (!mp_reader->is_change_available(change, &wp, unpaired))
+        {
+            if (unpaired)
+            {
+                logWarning(RTPS_READER, "Removing change " << change->sequenceNumber << " from " <<
+                        change->writerGUID << " because is no longer paired");
+                if (remove_change_sub(change))
+                {
+                    // The next change has taken its position
+                    continue;
+                }
+            }
+            ++pos;
+            continue;
+        }
+
+        uint32_t sample_state = change->isRead ? READ_SAMPLE_STATE : NOT_READ_SAMPLE_STATE;
+        if ((sample_states & sample_state) == 0 || (sample_kinds & (0x01u << change->kind)) == 0)
+        {
+            ++pos;
+            continue;
+        }
+
+        logInfo(SUBSCRIBER, mp_reader->getGuid().entityId << (take ? ": taking seqNum" : ": reading seqNum") <<
+                change->sequenceNumber << " from writer: " << change->writerGUID);
+        bool release = process(change, wp, count);
+
+        if (!take)
+        {
+            mp_reader->change_read_by_user(change);
+            ++count;
+            ++pos;
+        }
+        else if (release)
+        {
+            // The sample is a copy, so it is given even if the change cannot be removed
+            mp_reader->change_read_by_user(change);
+            if (!remove_change_sub(change))
+            {
+                ++pos;
+            }
+            ++count;
+        }
+        else if (remove_change_sub(change, false))
+        {
+            // Removing the change has already counted it as read. The next change has taken its position.
+            ++count;
+        }
+        else
+        {
+            // A loaned payload cannot be given while the change is kept in the History
+            ++pos;
+        }
+    }
+
+    return count;
+}
+
+bool SubscriberHistory::is_payload_loanable(const CacheChange_t* change) const
+{
+    uint16_t native_encapsulation = DEFAULT_ENDIAN == LITTLEEND ? CDR_LE : CDR_BE;
+    TopicDataType* type = mp_subImpl->getType();
+    return change->kind == ALIVE && type->is_plain() &&
+           change->serializedPayload.encapsulation == native_encapsulation &&
+           change->serializedPayload.length > SerializedPayload_t::representation_header_size &&
+           reinterpret_cast<uintptr_t>(change->serializedPayload.data +
+                   SerializedPayload_t::representation_header_size) % type->plain_alignment() == 0;
+}
+
+void SubscriberHistory::get_sample_info(
+        CacheChange_t* change,
+        WriterProxy* wp,
+        void* data,
+        SampleInfo_t* info)
+{
+    if (info != nullptr)
+    {
+        info->sampleKind = change->kind;
+        info->sample_identity.writer_guid(change->writerGUID);
+        info->sample_identity.sequence_number(change->sequenceNumber);
+        info->sourceTimestamp = change->sourceTimestamp;
+        if (this->mp_subImpl->getAttributes().qos.m_ownership.kind == EXCLUSIVE_OWNERSHIP_QOS)
+        {
+            info->ownershipStrength = wp->ownership_strength();
+        }
+        if (this->mp_subImpl->getAttributes().topic.topicKind == WITH_KEY &&
+                change->instanceHandle == c_InstanceHandle_Unknown && change->kind == ALIVE)
+        {
+            bool is_key_protected = false;
+#if HAVE_SECURITY
+            is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
+#endif
+            key_hash_cache_->get_key(data, change->instanceHandle, is_key_protected);
+        }
+        info->iHandle = change->instanceHandle;
+        info->related_sample_identity = change->write_params.sample_identity();
+    }
+}
+
 bool SubscriberHistory::find_key(
         CacheChange_t* a_change,
         t_m_Inst_Caches::iterator* vit_out)
@@ -482,6 +740,7 @@ bool SubscriberHistory::find_key(
         {
             if (vit->second.cache_changes.size() == 0)
             {
+                deadlines_.erase(std::make_pair(vit->second.next_deadline_us, vit->first));
                 keyed_changes_.erase(vit);
                 *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
                 return true;
@@ -494,6 +753,13 @@ bool SubscriberHistory::find_key(
 
 
 bool SubscriberHistory::remove_change_sub(CacheChange_t* change)
+{
+    return remove_change_sub(change, true);
+}
+
+bool SubscriberHistory::remove_change_sub(
+        CacheChange_t* change,
+        bool release)
 {
     if (mp_reader == nullptr || mp_mutex == nullptr)
     {
@@ -504,7 +770,7 @@ bool SubscriberHistory::remove_change_sub(CacheChange_t* change)
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
     if (mp_subImpl->getAttributes().topic.getTopicKind() == NO_KEY)
     {
-        if (this->remove_change(change))
+        if (this->remove_change(change, release))
         {
             m_isHistoryFull = false;
             return true;
@@ -523,7 +789,7 @@ bool SubscriberHistory::remove_change_sub(CacheChange_t* change)
         {
             if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
             {
-                if (remove_change(change))
+                if (remove_change(change, release))
                 {
                     vit->second.cache_changes.erase(chit);
                     m_isHistoryFull = false;
@@ -554,12 +820,15 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (mp_subImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        deadlines_.erase(std::make_pair(vit->second.next_deadline_us, handle));
+        deadlines_.emplace(next_deadline_us, handle);
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -584,14 +853,13 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (mp_subImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                                    keyed_changes_.end(),
-                                    [](
-                                    const std::pair<InstanceHandle_t, KeyedChanges> &lhs,
-                                    const std::pair<InstanceHandle_t, KeyedChanges> &rhs)
-        { return lhs.second.next_deadline_us < rhs.second.next_deadline_us; });
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        if (deadlines_.empty())
+        {
+            return false;
+        }
+
+        handle = deadlines_.begin()->second;
+        next_deadline_us = deadlines_.begin()->first;
         return true;
     }
 
@@ -22,6 +22,8 @@
 #include <fastrtps/subscriber/Subscriber.h>
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/subscriber/SubscriberListener.h>
+#include <fastrtps/subscriber/WaitSet.h>
+#include "WaitSetRegistration.h"
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/reader/StatefulReader.h>
 #include <fastrtps/rtps/RTPSDomain.h>
@@ -31,6 +33,8 @@
 #include <fastrtps/utils/TimeConversion.h>
 #include <fastrtps/log/Log.h>
 
+#include <algorithm>
+
 using namespace eprosima::fastrtps::rtps;
 using namespace std::chrono;
 
@@ -57,6 +61,9 @@ SubscriberImpl::SubscriberImpl(
     , deadline_missed_status_()
     , lifespan_duration_us_(m_att.qos.m_lifespan.duration.to_ns() * 1e-3)
 {
+    listener_executor_ = mp_participant->listener_executor();
+    listener_strand_ = listener_executor_ != nullptr ? listener_executor_->create_strand() : nullptr;
+
     deadline_timer_ = new TimedEvent(mp_participant->get_resource_event(),
             [&](TimedEvent::EventCode code) -> bool
             {
@@ -92,7 +99,39 @@ SubscriberImpl::~SubscriberImpl()
         logInfo(SUBSCRIBER,this->getGuid().entityId << " in topic: "<<this->m_att.topic.topicName);
     }
 
+    {
+        std::lock_guard<std::mutex> guard(loans_mutex_);
+        for (auto& loan : loans_)
+        {
+            if (loan.second != nullptr)
+            {
+                m_history.release_Cache(loan.second);
+            }
+            else
+            {
+                mp_type->deleteData(const_cast<void*>(loan.first));
+            }
+        }
+        loans_.clear();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(waitsets_mutex_);
+        for (const std::shared_ptr<WaitSetRegistration>& registration : waitsets_)
+        {
+            registration->subscriber_removed();
+        }
+        waitsets_.clear();
+    }
+
     RTPSDomain::removeRTPSReader(mp_reader);
+
+    // No more callbacks can be posted once the reader has been removed
+    if (listener_strand_ != nullptr)
+    {
+        listener_executor_->destroy_strand(listener_strand_);
+    }
+
     delete(this->mp_userSubscriber);
 }
 
@@ -105,14 +144,123 @@ bool SubscriberImpl::readNextData(void* data,SampleInfo_t* info)
 {
     auto max_blocking_time = std::chrono::steady_clock::now() +
         std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
-    return this->m_history.readNextData(data, info, max_blocking_time);
+    bool ret = this->m_history.readNextData(data, info, max_blocking_time);
+    notify_waitsets_data_available();
+    return ret;
 }
 
 bool SubscriberImpl::takeNextData(void* data,SampleInfo_t* info)
 {
     auto max_blocking_time = std::chrono::steady_clock::now() +
         std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
-    return this->m_history.takeNextData(data, info, max_blocking_time);
+    bool ret = this->m_history.takeNextData(data, info, max_blocking_time);
+    notify_waitsets_data_available();
+    return ret;
+}
+
+uint32_t SubscriberImpl::read(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds)
+{
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
+    uint32_t count = m_history.read(samples, infos, max_samples, instance, sample_states, sample_kinds,
+            max_blocking_time);
+    notify_waitsets_data_available();
+    return count;
+}
+
+uint32_t SubscriberImpl::take(
+        void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds)
+{
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
+    uint32_t count = m_history.take(samples, infos, max_samples, instance, sample_states, sample_kinds,
+            max_blocking_time);
+    notify_waitsets_data_available();
+    return count;
+}
+
+uint32_t SubscriberImpl::take_loans(
+        const void** samples,
+        SampleInfo_t* infos,
+        uint32_t max_samples,
+        const InstanceHandle_t& instance,
+        uint32_t sample_states,
+        uint32_t sample_kinds)
+{
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
+
+    std::vector<CacheChange_t*> changes(max_samples);
+    uint32_t count = m_history.take_loans(const_cast<void**>(samples), changes.data(), infos, max_samples,
+            instance, sample_states, sample_kinds, max_blocking_time);
+    notify_waitsets_data_available();
+
+    std::lock_guard<std::mutex> guard(loans_mutex_);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        loans_[samples[i]] = changes[i];
+    }
+    return count;
+}
+
+bool SubscriberImpl::take_loan(
+        const void*& sample,
+        SampleInfo_t* info)
+{
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
+
+    void* data = nullptr;
+    CacheChange_t* change = nullptr;
+    bool taken = m_history.take_next_loan(data, change, info, max_blocking_time);
+    notify_waitsets_data_available();
+    if (!taken)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(loans_mutex_);
+    loans_[data] = change;
+    sample = data;
+    return true;
+}
+
+bool SubscriberImpl::return_loan(const void*& sample)
+{
+    CacheChange_t* change = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(loans_mutex_);
+        auto it = loans_.find(sample);
+        if (it == loans_.end())
+        {
+            return false;
+        }
+        change = it->second;
+        loans_.erase(it);
+    }
+
+    if (change != nullptr)
+    {
+        m_history.release_Cache(change);
+    }
+    else
+    {
+        mp_type->deleteData(const_cast<void*>(sample));
+    }
+
+    sample = nullptr;
+    return true;
 }
 
 const GUID_t& SubscriberImpl::getGuid()
@@ -194,6 +342,8 @@ bool SubscriberImpl::updateAttributes(const SubscriberAttributes& att)
             sfr->updateTimes(att.times);
         }
         this->m_att.qos.setQos(att.qos,false);
+        // The content filter can be changed, and is announced again to the matched writers
+        this->m_att.topic.contentFilter = att.topic.contentFilter;
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         mp_rtpsParticipant->updateReader(this->mp_reader, m_att.topic, m_att.qos);
 
@@ -233,19 +383,30 @@ void SubscriberImpl::SubscriberReaderListener::onNewCacheChangeAdded(
 {
     if (mp_subscriberImpl->onNewCacheChangeAdded(change_in))
     {
+        mp_subscriberImpl->notify_waitsets_data_available();
+
         if(mp_subscriberImpl->mp_listener != nullptr)
         {
-            //cout << "FIRST BYTE: "<< (int)change->serializedPayload.data[0] << endl;
-            mp_subscriberImpl->mp_listener->onNewDataMessage(mp_subscriberImpl->mp_userSubscriber);
+            SubscriberImpl* subscriber = mp_subscriberImpl;
+            mp_subscriberImpl->call_listener([subscriber]()
+                    {
+                        subscriber->mp_listener->onNewDataMessage(subscriber->mp_userSubscriber);
+                    });
         }
     }
 }
 
 void SubscriberImpl::SubscriberReaderListener::onReaderMatched(RTPSReader* /*reader*/, MatchingInfo& info)
 {
+    mp_subscriberImpl->notify_waitsets(SUBSCRIPTION_MATCHED_STATUS);
+
     if (this->mp_subscriberImpl->mp_listener != nullptr)
     {
-        mp_subscriberImpl->mp_listener->onSubscriptionMatched(mp_subscriberImpl->mp_userSubscriber,info);
+        SubscriberImpl* subscriber = mp_subscriberImpl;
+        mp_subscriberImpl->call_listener([subscriber, info]() mutable
+                {
+                    subscriber->mp_listener->onSubscriptionMatched(subscriber->mp_userSubscriber, info);
+                });
     }
 }
 
@@ -255,12 +416,86 @@ void SubscriberImpl::SubscriberReaderListener::on_liveliness_changed(
 {
     (void)reader;
 
+    mp_subscriberImpl->notify_waitsets(LIVELINESS_CHANGED_STATUS);
+
     if (mp_subscriberImpl->mp_listener != nullptr)
     {
-        mp_subscriberImpl->mp_listener->on_liveliness_changed(
-                    mp_subscriberImpl->mp_userSubscriber,
-                    status);
+        SubscriberImpl* subscriber = mp_subscriberImpl;
+        mp_subscriberImpl->call_listener([subscriber, status]()
+                {
+                    subscriber->mp_listener->on_liveliness_changed(
+                                subscriber->mp_userSubscriber,
+                                status);
+                });
+    }
+}
+
+void SubscriberImpl::call_listener(std::function<void()>&& callback)
+{
+    if (listener_strand_ == nullptr)
+    {
+        callback();
+    }
+    else
+    {
+        listener_executor_->post(listener_strand_, std::move(callback));
+    }
+}
+
+void SubscriberImpl::notify_waitsets(uint32_t status)
+{
+    std::lock_guard<std::mutex> guard(waitsets_mutex_);
+    for (auto it = waitsets_.begin(); it != waitsets_.end();)
+    {
+        if ((*it)->attached())
+        {
+            (*it)->notify(status);
+            ++it;
+        }
+        else
+        {
+            it = waitsets_.erase(it);
+        }
+    }
+}
+
+void SubscriberImpl::notify_waitsets_data_available()
+{
+    {
+        std::lock_guard<std::mutex> guard(waitsets_mutex_);
+        if (waitsets_.empty())
+        {
+            return;
+        }
+    }
+
+    // The reader mutex keeps the unread count until every WaitSet has been notified
+    std::lock_guard<RecursiveTimedMutex> lock(mp_reader->getMutex());
+    bool available = mp_reader->get_unread_count() > 0;
+
+    std::lock_guard<std::mutex> guard(waitsets_mutex_);
+    for (auto it = waitsets_.begin(); it != waitsets_.end();)
+    {
+        if ((*it)->attached())
+        {
+            (*it)->data_available(available);
+            ++it;
+        }
+        else
+        {
+            it = waitsets_.erase(it);
+        }
+    }
+}
+
+void SubscriberImpl::attach_waitset(const std::shared_ptr<WaitSetRegistration>& registration)
+{
+    {
+        std::lock_guard<std::mutex> guard(waitsets_mutex_);
+        waitsets_.push_back(registration);
     }
+
+    notify_waitsets_data_available();
 }
 
 bool SubscriberImpl::onNewCacheChangeAdded(const CacheChange_t* const change_in)
@@ -370,7 +605,15 @@ bool SubscriberImpl::deadline_missed()
     deadline_missed_status_.total_count++;
     deadline_missed_status_.total_count_change++;
     deadline_missed_status_.last_instance_handle = timer_owner_;
-    mp_listener->on_requested_deadline_missed(mp_userSubscriber, deadline_missed_status_);
+    notify_waitsets(REQUESTED_DEADLINE_MISSED_STATUS);
+    if (mp_listener != nullptr)
+    {
+        RequestedDeadlineMissedStatus status = deadline_missed_status_;
+        call_listener([this, status]() mutable
+                {
+                    mp_listener->on_requested_deadline_missed(mp_userSubscriber, status);
+                });
+    }
     deadline_missed_status_.total_count_change = 0;
 
     if (!m_history.set_next_deadline(
@@ -415,6 +658,7 @@ bool SubscriberImpl::lifespan_expired()
 
     // The earliest change has expired
     m_history.remove_change_sub(earliest_change);
+    notify_waitsets_data_available();
 
     // Set the timer for the next change if there is one
     if (!m_history.get_earliest_change(&earliest_change))
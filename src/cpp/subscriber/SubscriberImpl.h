@@ -29,6 +29,13 @@
 #include <fastrtps/rtps/reader/ReaderListener.h>
 #include <fastrtps/qos/DeadlineMissedStatus.h>
 
+#include "../utils/ListenerExecutor.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps
@@ -43,6 +50,7 @@ class SubscriberListener;
 class ParticipantImpl;
 class SampleInfo_t;
 class Subscriber;
+class WaitSetRegistration;
 
 /**
  * Class SubscriberImpl, contains the actual implementation of the behaviour of the Subscriber.
@@ -85,6 +93,65 @@ class SubscriberImpl
 
     ///@}
 
+    /** @name Read or take several samples methods.
+     * Methods to read or take up to max_samples samples from the History. See Subscriber::read.
+     */
+
+    ///@{
+
+    uint32_t read(
+            void** samples,
+            SampleInfo_t* infos,
+            uint32_t max_samples,
+            const rtps::InstanceHandle_t& instance,
+            uint32_t sample_states,
+            uint32_t sample_kinds);
+
+    uint32_t take(
+            void** samples,
+            SampleInfo_t* infos,
+            uint32_t max_samples,
+            const rtps::InstanceHandle_t& instance,
+            uint32_t sample_states,
+            uint32_t sample_kinds);
+
+    ///@}
+
+    /**
+     * Takes up to max_samples samples without copying them when possible. See Subscriber::take_loans.
+     * @param[out] samples Array of max_samples pointers where the loaned samples are stored.
+     * @param infos Array of max_samples SampleInfo_t structures. May be nullptr.
+     * @param max_samples Maximum number of samples to take.
+     * @param instance Instance of the samples. c_InstanceHandle_Unknown selects every instance.
+     * @param sample_states Mask of SampleStateMask values the samples must match.
+     * @param sample_kinds Mask of SampleKindMask values the samples must match.
+     * @return Number of samples taken.
+     */
+    uint32_t take_loans(
+            const void** samples,
+            SampleInfo_t* infos,
+            uint32_t max_samples,
+            const rtps::InstanceHandle_t& instance,
+            uint32_t sample_states,
+            uint32_t sample_kinds);
+
+    /**
+     * Takes the next sample without copying it when possible. See Subscriber::take_loan.
+     * @param[out] sample Pointer to the loaned sample.
+     * @param info Pointer to a SampleInfo_t structure that informs you about your sample.
+     * @return True if a sample was taken.
+     */
+    bool take_loan(
+            const void*& sample,
+            SampleInfo_t* info);
+
+    /**
+     * Gives back a sample loaned with take_loan.
+     * @param[in,out] sample Pointer to the loaned sample. It is set to nullptr on success.
+     * @return True if the sample was loaned by this subscriber.
+     */
+    bool return_loan(const void*& sample);
+
     /**
      * Update the Attributes of the subscriber;
      * @param att Reference to a SubscriberAttributes object to update the parameters;
@@ -143,6 +210,12 @@ class SubscriberImpl
      */
     void get_liveliness_changed_status(LivelinessChangedStatus& status);
 
+    /**
+     * @brief Registers a WaitSet to be notified of the status changes
+     * @param registration Registration of the WaitSet the subscriber has been attached to
+     */
+    void attach_waitset(const std::shared_ptr<WaitSetRegistration>& registration);
+
 private:
 
     //!Participant
@@ -159,6 +232,38 @@ private:
     //!Listener
     SubscriberListener* mp_listener;
 
+    //! Protects loans_
+    std::mutex loans_mutex_;
+    //! Loaned samples. Samples of plain types point to the payload of the mapped change, others map to nullptr.
+    std::map<const void*, rtps::CacheChange_t*> loans_;
+
+    //! Executor of the participant calling the listener, or nullptr to call it from the notifying thread
+    ListenerExecutor* listener_executor_;
+    //! Keeps the listener callbacks of this subscriber in order when they are run by the executor
+    ListenerExecutor::Strand* listener_strand_;
+
+    //! Protects waitsets_
+    std::mutex waitsets_mutex_;
+    //! Registrations of the WaitSets this subscriber is attached to. Detached ones are removed when notifying.
+    std::vector<std::shared_ptr<WaitSetRegistration>> waitsets_;
+
+    /**
+     * @brief Calls the listener, or posts the call to the listener executor
+     * @param callback Callback invoking the listener
+     */
+    void call_listener(std::function<void()>&& callback);
+
+    /**
+     * @brief Notifies the attached WaitSets of a status change
+     * @param status The SubscriberStatus that has changed
+     */
+    void notify_waitsets(uint32_t status);
+
+    /**
+     * @brief Notifies the attached WaitSets whether there are unread samples
+     */
+    void notify_waitsets_data_available();
+
     class SubscriberReaderListener : public rtps::ReaderListener
     {
     public:
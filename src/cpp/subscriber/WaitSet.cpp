@@ -0,0 +1,267 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSet.cpp
+ */
+
+#include <fastrtps/subscriber/WaitSet.h>
+#include <fastrtps/subscriber/Subscriber.h>
+
+#include "SubscriberImpl.h"
+#include "WaitSetRegistration.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace eprosima {
+namespace fastrtps {
+
+void WaitSetRegistration::notify(
+        uint32_t status)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (waitset_ != nullptr)
+    {
+        waitset_->notify(this, status);
+    }
+}
+
+void WaitSetRegistration::data_available(
+        bool available)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (waitset_ != nullptr)
+    {
+        waitset_->data_available(this, available);
+    }
+}
+
+void WaitSetRegistration::subscriber_removed()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (waitset_ != nullptr)
+    {
+        waitset_->subscriber_removed(this);
+        waitset_ = nullptr;
+    }
+}
+
+void WaitSetRegistration::detach()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    waitset_ = nullptr;
+}
+
+bool WaitSetRegistration::attached() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return waitset_ != nullptr;
+}
+
+WaitSet::WaitSet()
+    : generation_(0)
+    , woken_up_(false)
+{
+}
+
+WaitSet::~WaitSet()
+{
+    std::vector<Attachment> attachments;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        attachments.swap(attachments_);
+    }
+
+    // Waits for the notifications in progress on each registration
+    for (const Attachment& attachment : attachments)
+    {
+        attachment.registration->detach();
+    }
+}
+
+bool WaitSet::attach(
+        Subscriber* subscriber,
+        uint32_t status_mask)
+{
+    if (subscriber == nullptr)
+    {
+        return false;
+    }
+
+    std::shared_ptr<WaitSetRegistration> registration;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        auto it = std::find_if(attachments_.begin(), attachments_.end(), [subscriber](const Attachment& attachment)
+                {
+                    return attachment.subscriber == subscriber;
+                });
+
+        ++generation_;
+        if (it != attachments_.end())
+        {
+            it->status_mask = status_mask;
+            cv_.notify_all();
+            return true;
+        }
+
+        registration = std::make_shared<WaitSetRegistration>(this);
+        attachments_.push_back({subscriber, registration, status_mask, 0, false});
+        cv_.notify_all();
+    }
+
+    subscriber->mp_impl->attach_waitset(registration);
+    return true;
+}
+
+bool WaitSet::detach(
+        Subscriber* subscriber)
+{
+    std::shared_ptr<WaitSetRegistration> registration;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        auto it = std::find_if(attachments_.begin(), attachments_.end(), [subscriber](const Attachment& attachment)
+                {
+                    return attachment.subscriber == subscriber;
+                });
+
+        if (it == attachments_.end())
+        {
+            return false;
+        }
+
+        registration = it->registration;
+        attachments_.erase(it);
+    }
+
+    // The subscriber forgets the registration the next time it notifies
+    registration->detach();
+    return true;
+}
+
+bool WaitSet::wait(
+        std::vector<ActiveSubscriber>& active,
+        const Duration_t& timeout)
+{
+    auto max_time = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout.to_ns());
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        active.clear();
+
+        if (woken_up_)
+        {
+            woken_up_ = false;
+            return true;
+        }
+
+        for (Attachment& attachment : attachments_)
+        {
+            uint32_t statuses = attachment.pending & attachment.status_mask;
+            if ((attachment.status_mask & DATA_AVAILABLE_STATUS) != 0 && attachment.data_available)
+            {
+                statuses |= DATA_AVAILABLE_STATUS;
+            }
+
+            if (statuses != 0)
+            {
+                attachment.pending &= ~statuses;
+                active.push_back({attachment.subscriber, statuses});
+            }
+        }
+
+        if (!active.empty())
+        {
+            return true;
+        }
+
+        uint64_t generation = generation_;
+        if (!cv_.wait_until(lock, max_time, [&]()
+                {
+                    return generation != generation_;
+                }))
+        {
+            return false;
+        }
+    }
+}
+
+void WaitSet::wake_up()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    woken_up_ = true;
+    ++generation_;
+    cv_.notify_all();
+}
+
+void WaitSet::notify(
+        const WaitSetRegistration* registration,
+        uint32_t status)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    for (Attachment& attachment : attachments_)
+    {
+        if (attachment.registration.get() == registration && (attachment.status_mask & status) != 0)
+        {
+            attachment.pending |= status;
+            ++generation_;
+            cv_.notify_all();
+        }
+    }
+}
+
+void WaitSet::data_available(
+        const WaitSetRegistration* registration,
+        bool available)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    for (Attachment& attachment : attachments_)
+    {
+        if (attachment.registration.get() == registration)
+        {
+            attachment.data_available = available;
+            if (available && (attachment.status_mask & DATA_AVAILABLE_STATUS) != 0)
+            {
+                ++generation_;
+                cv_.notify_all();
+            }
+        }
+    }
+}
+
+void WaitSet::subscriber_removed(
+        const WaitSetRegistration* registration)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    attachments_.erase(std::remove_if(attachments_.begin(), attachments_.end(),
+            [registration](const Attachment& attachment)
+            {
+                return attachment.registration.get() == registration;
+            }), attachments_.end());
+    ++generation_;
+    cv_.notify_all();
+}
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,84 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetRegistration.h
+ */
+
+#ifndef WAITSETREGISTRATION_H_
+#define WAITSETREGISTRATION_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <cstdint>
+#include <mutex>
+
+namespace eprosima {
+namespace fastrtps {
+
+class WaitSet;
+
+/**
+ * Link between a WaitSet and a subscriber attached to it.
+ * It is shared by both of them, so either can be destroyed first: the WaitSet is only called while it is attached.
+ *
+ * Lock order is the reader mutex, the registrations of the subscriber, this registration and the WaitSet mutex.
+ * The WaitSet never calls the subscriber, so it can be used from listener callbacks.
+ */
+class WaitSetRegistration
+{
+    public:
+
+        WaitSetRegistration(
+                WaitSet* waitset)
+            : waitset_(waitset)
+        {
+        }
+
+        /**
+         * Notifies the WaitSet of a status change of the subscriber.
+         * @param status The SubscriberStatus that has changed.
+         */
+        void notify(
+                uint32_t status);
+
+        /**
+         * Notifies the WaitSet whether the subscriber has unread samples.
+         * Must be called with the reader mutex taken, so the last notification is the current state.
+         * @param available True if the subscriber has unread samples.
+         */
+        void data_available(
+                bool available);
+
+        //! Called by the subscriber when it is being removed.
+        void subscriber_removed();
+
+        //! Called by the WaitSet when the subscriber is detached or the WaitSet is destroyed.
+        void detach();
+
+        //! @return True while the subscriber is attached to the WaitSet.
+        bool attached() const;
+
+    private:
+
+        mutable std::mutex mutex_;
+
+        //! WaitSet the subscriber is attached to, nullptr once detached.
+        WaitSet* waitset_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* WAITSETREGISTRATION_H_ */
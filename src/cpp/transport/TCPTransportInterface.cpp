@@ -15,6 +15,7 @@
 #include <fastrtps/transport/TCPTransportInterface.h>
 #include <fastrtps/transport/tcp/RTCPMessageManager.h>
 #include "TCPSenderResource.hpp"
+#include "../utils/Threading.h"
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/IPLocator.h>
 #include <fastrtps/utils/System.h>
@@ -73,6 +74,8 @@ TCPTransportDescriptor::TCPTransportDescriptor(const TCPTransportDescriptor& t)
     , check_crc(t.check_crc)
     , apply_security(t.apply_security)
     , tls_config(t.tls_config)
+    , accept_thread(t.accept_thread)
+    , keep_alive_thread(t.keep_alive_thread)
 {
 }
 
@@ -84,6 +87,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator=(const TCPTransportDesc
     sendBufferSize = t.sendBufferSize;
     receiveBufferSize = t.receiveBufferSize;
     TTL = t.TTL;
+    reception_threads = t.reception_threads;
     listening_ports = t.listening_ports;
     keep_alive_frequency_ms = t.keep_alive_frequency_ms;
     keep_alive_timeout_ms = t.keep_alive_timeout_ms;
@@ -97,6 +101,8 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator=(const TCPTransportDesc
     check_crc = t.check_crc;
     apply_security = t.apply_security;
     tls_config = t.tls_config;
+    accept_thread = t.accept_thread;
+    keep_alive_thread = t.keep_alive_thread;
     return *this;
 }
 
@@ -366,6 +372,7 @@ bool TCPTransportInterface::init()
 
     auto ioServiceFunction = [&]()
     {
+        set_current_thread_settings("dds.tcp_accept", configuration()->accept_thread);
 #if ASIO_VERSION >= 101200
         asio::executor_work_guard<asio::io_service::executor_type> work(io_service_.get_executor());
 #else
@@ -379,6 +386,7 @@ bool TCPTransportInterface::init()
     {
         io_service_timers_thread_ = std::make_shared<std::thread>([&]()
         {
+            set_current_thread_settings("dds.tcp_keep", configuration()->keep_alive_thread);
 
 #if ASIO_VERSION >= 101200
             asio::executor_work_guard<asio::io_service::executor_type> work(io_service_timers_.get_executor());
@@ -694,6 +702,14 @@ void TCPTransportInterface::perform_listen_operation(
     std::shared_ptr<TCPChannelResource> channel;
     rtcp_message_manager = rtcp_manager.lock();
 
+    channel = channel_weak.lock();
+    if (channel)
+    {
+        set_current_thread_settings("dds.tcp." + std::to_string(IPLocator::getPhysicalPort(channel->locator())),
+                configuration()->reception_threads);
+        channel.reset();
+    }
+
     // RTCP Control Message
     if(rtcp_message_manager)
     {
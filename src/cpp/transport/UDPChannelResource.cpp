@@ -17,6 +17,7 @@
 #include <fastrtps/transport/UDPChannelResource.h>
 #include <fastrtps/rtps/messages/MessageReceiver.h>
 #include <fastrtps/utils/eClock.h>
+#include "../utils/Threading.h"
 
 namespace eprosima {
 namespace fastrtps {
@@ -46,6 +47,9 @@ UDPChannelResource::~UDPChannelResource()
 
 void UDPChannelResource::perform_listen_operation(Locator_t input_locator)
 {
+    set_current_thread_settings("dds.udp." + std::to_string(input_locator.port),
+            transport_->configuration()->reception_threads);
+
     Locator_t remote_locator;
 
     while (alive())
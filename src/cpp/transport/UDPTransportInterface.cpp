@@ -16,6 +16,7 @@
 #include <fastrtps/transport/UDPTransportInterface.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include "UDPSenderResource.hpp"
+#include "../rtps/common/StatisticsCounters.h"
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/Semaphore.h>
 #include <fastrtps/utils/IPLocator.h>
@@ -61,6 +62,10 @@ UDPTransportInterface::UDPTransportInterface(int32_t transport_kind)
     : TransportInterface(transport_kind)
     , mSendBufferSize(0)
     , mReceiveBufferSize(0)
+    , datagrams_sent_(0)
+    , bytes_sent_(0)
+    , send_errors_(0)
+    , would_block_(0)
 {
 }
 
@@ -468,21 +473,25 @@ bool UDPTransportInterface::send(
                 if ((ec.value() == asio::error::would_block) ||
                     (ec.value() == asio::error::try_again))
                 {
+                    statistics_add(would_block_);
                     logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
                     return true;
                 }
 
+                statistics_add(send_errors_);
                 logWarning(RTPS_MSG_OUT, ec.message());
                 return false;
             }
         }
         catch (const std::exception& error)
         {
+            statistics_add(send_errors_);
             logWarning(RTPS_MSG_OUT, error.what());
             return false;
         }
 
-        (void)bytesSent;
+        statistics_add(datagrams_sent_);
+        statistics_add(bytes_sent_, bytesSent);
         logInfo(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint
             << " FROM " << getSocketPtr(socket)->local_endpoint());
         success = true;
@@ -631,6 +640,16 @@ bool UDPTransportInterface::fillUnicastLocator(Locator_t &locator, uint32_t well
     return true;
 }
 
+bool UDPTransportInterface::get_statistics(TransportStatistics& stats) const
+{
+    stats.kind = transport_kind_;
+    stats.datagrams_sent = datagrams_sent_.load(std::memory_order_relaxed);
+    stats.bytes_sent = bytes_sent_.load(std::memory_order_relaxed);
+    stats.send_errors = send_errors_.load(std::memory_order_relaxed);
+    stats.would_block = would_block_.load(std::memory_order_relaxed);
+    return true;
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
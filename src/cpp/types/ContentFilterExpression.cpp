@@ -0,0 +1,981 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterExpression.cpp
+ */
+
+#include "ContentFilterExpression.h"
+
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/log/Log.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+namespace {
+
+typedef ContentFilterExpression::Value Value;
+typedef ContentFilterExpression::Field Field;
+typedef ContentFilterExpression::Operand Operand;
+typedef ContentFilterExpression::Operator Operator;
+typedef ContentFilterExpression::Node Node;
+
+struct Token
+{
+    enum Kind
+    {
+        END,
+        IDENTIFIER,
+        LITERAL,
+        PARAMETER,
+        OPERATOR,
+        OPEN_PARENTHESIS,
+        CLOSE_PARENTHESIS,
+        AND,
+        OR,
+        NOT,
+        LIKE,
+        BETWEEN
+    };
+
+    Kind kind;
+    std::string text;
+    Value value;
+    Operator op;
+    size_t parameter;
+};
+
+std::string to_upper(
+        const std::string& text)
+{
+    std::string upper(text);
+    for (char& c : upper)
+    {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return upper;
+}
+
+bool is_primitive(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_INT16:
+        case TK_INT32:
+        case TK_INT64:
+        case TK_UINT16:
+        case TK_UINT32:
+        case TK_UINT64:
+        case TK_FLOAT32:
+        case TK_FLOAT64:
+        case TK_FLOAT128:
+        case TK_CHAR8:
+        case TK_CHAR16:
+        case TK_STRING8:
+        case TK_STRING16:
+        case TK_ENUM:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Parse a number written in decimal, or in hexadecimal with a 0x prefix.
+ * @return false if the whole text is not a number.
+ */
+bool parse_number(
+        const std::string& text,
+        Value& value)
+{
+    if (text.empty())
+    {
+        return false;
+    }
+
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    bool hex = text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X');
+    long long integer = std::strtoll(begin, &end, hex ? 16 : 10);
+    if (*end == 0)
+    {
+        value.kind = Value::INTEGER;
+        value.integer = integer;
+        return true;
+    }
+
+    long double floating = std::strtold(begin, &end);
+    if (*end == 0)
+    {
+        value.kind = Value::FLOAT;
+        value.floating = floating;
+        return true;
+    }
+
+    return false;
+}
+
+//! Value of a parameter, which may be a quoted string, a boolean, a number or an enumerator name.
+Value parse_parameter(
+        const std::string& text)
+{
+    Value value;
+    std::string upper = to_upper(text);
+    if (text.size() >= 2 && text.front() == '\'' && text.back() == '\'')
+    {
+        value.kind = Value::STRING;
+        value.string = text.substr(1, text.size() - 2);
+    }
+    else if (upper == "TRUE" || upper == "FALSE")
+    {
+        value.kind = Value::BOOLEAN;
+        value.boolean = upper == "TRUE";
+    }
+    else if (!parse_number(text, value))
+    {
+        value.kind = Value::STRING;
+        value.string = text;
+    }
+    return value;
+}
+
+bool tokenize(
+        const std::string& expression,
+        std::vector<Token>& tokens)
+{
+    size_t pos = 0;
+    while (pos < expression.size())
+    {
+        char c = expression[pos];
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            ++pos;
+            continue;
+        }
+
+        Token token;
+        if (c == '(' || c == ')')
+        {
+            token.kind = c == '(' ? Token::OPEN_PARENTHESIS : Token::CLOSE_PARENTHESIS;
+            ++pos;
+        }
+        else if (c == '\'')
+        {
+            size_t end = expression.find('\'', pos + 1);
+            if (end == std::string::npos)
+            {
+                logError(CONTENT_FILTER, "Unterminated string in filter expression");
+                return false;
+            }
+            token.kind = Token::LITERAL;
+            token.value.kind = Value::STRING;
+            token.value.string = expression.substr(pos + 1, end - pos - 1);
+            pos = end + 1;
+        }
+        else if (c == '%')
+        {
+            size_t end = pos + 1;
+            while (end < expression.size() && std::isdigit(static_cast<unsigned char>(expression[end])))
+            {
+                ++end;
+            }
+            if (end == pos + 1 || end - pos - 1 > 2)
+            {
+                logError(CONTENT_FILTER, "Invalid parameter in filter expression");
+                return false;
+            }
+            token.kind = Token::PARAMETER;
+            token.parameter = std::strtoul(expression.c_str() + pos + 1, nullptr, 10);
+            pos = end;
+        }
+        else if (c == '=' || c == '<' || c == '>' || c == '!')
+        {
+            token.kind = Token::OPERATOR;
+            char next = pos + 1 < expression.size() ? expression[pos + 1] : 0;
+            pos += 2;
+            if (c == '<' && next == '>')
+            {
+                token.op = ContentFilterExpression::NOT_EQUAL;
+            }
+            else if (c == '!' && next == '=')
+            {
+                token.op = ContentFilterExpression::NOT_EQUAL;
+            }
+            else if (c == '<' && next == '=')
+            {
+                token.op = ContentFilterExpression::LESS_EQUAL;
+            }
+            else if (c == '>' && next == '=')
+            {
+                token.op = ContentFilterExpression::GREATER_EQUAL;
+            }
+            else if (c == '!')
+            {
+                logError(CONTENT_FILTER, "Invalid operator in filter expression");
+                return false;
+            }
+            else
+            {
+                --pos;
+                token.op = c == '=' ? ContentFilterExpression::EQUAL :
+                    c == '<' ? ContentFilterExpression::LESS : ContentFilterExpression::GREATER;
+            }
+        }
+        else if (std::isdigit(static_cast<unsigned char>(c)) || c == '-' || c == '+' || c == '.')
+        {
+            size_t end = pos + 1;
+            while (end < expression.size() &&
+                    (std::isalnum(static_cast<unsigned char>(expression[end])) || expression[end] == '.' ||
+                    ((expression[end] == '-' || expression[end] == '+') &&
+                    (expression[end - 1] == 'e' || expression[end - 1] == 'E'))))
+            {
+                ++end;
+            }
+            token.kind = Token::LITERAL;
+            if (!parse_number(expression.substr(pos, end - pos), token.value))
+            {
+                logError(CONTENT_FILTER, "Invalid number in filter expression: " << expression.substr(pos, end - pos));
+                return false;
+            }
+            pos = end;
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            size_t end = pos + 1;
+            while (end < expression.size() &&
+                    (std::isalnum(static_cast<unsigned char>(expression[end])) || expression[end] == '_' ||
+                    expression[end] == '.'))
+            {
+                ++end;
+            }
+            token.text = expression.substr(pos, end - pos);
+            pos = end;
+
+            std::string upper = to_upper(token.text);
+            if (upper == "AND")
+            {
+                token.kind = Token::AND;
+            }
+            else if (upper == "OR")
+            {
+                token.kind = Token::OR;
+            }
+            else if (upper == "NOT")
+            {
+                token.kind = Token::NOT;
+            }
+            else if (upper == "LIKE")
+            {
+                token.kind = Token::LIKE;
+            }
+            else if (upper == "BETWEEN")
+            {
+                token.kind = Token::BETWEEN;
+            }
+            else if (upper == "TRUE" || upper == "FALSE")
+            {
+                token.kind = Token::LITERAL;
+                token.value.kind = Value::BOOLEAN;
+                token.value.boolean = upper == "TRUE";
+            }
+            else
+            {
+                token.kind = Token::IDENTIFIER;
+            }
+        }
+        else
+        {
+            logError(CONTENT_FILTER, "Unexpected character '" << c << "' in filter expression");
+            return false;
+        }
+
+        tokens.push_back(std::move(token));
+    }
+
+    Token end;
+    end.kind = Token::END;
+    tokens.push_back(end);
+    return true;
+}
+
+/**
+ * Recursive descent parser of filter expressions.
+ *
+ * condition  := term ( OR term )*
+ * term       := factor ( AND factor )*
+ * factor     := NOT factor | '(' condition ')' | predicate
+ * predicate  := operand ( operator operand | [NOT] LIKE operand | [NOT] BETWEEN operand AND operand )
+ */
+class Parser
+{
+    public:
+
+        Parser(
+                const std::vector<Token>& tokens,
+                const std::vector<std::string>& parameters,
+                DynamicData* prototype)
+            : tokens_(tokens)
+            , parameters_(parameters)
+            , prototype_(prototype)
+            , pos_(0)
+        {
+        }
+
+        std::unique_ptr<Node> parse()
+        {
+            std::unique_ptr<Node> root = condition();
+            if (root && tokens_[pos_].kind != Token::END)
+            {
+                logError(CONTENT_FILTER, "Unexpected token at the end of the filter expression");
+                root.reset();
+            }
+            return root;
+        }
+
+    private:
+
+        static std::unique_ptr<Node> binary(
+                Node::Kind kind,
+                std::unique_ptr<Node> left,
+                std::unique_ptr<Node> right)
+        {
+            std::unique_ptr<Node> node(new Node());
+            node->kind = kind;
+            node->left = std::move(left);
+            node->right = std::move(right);
+            return node;
+        }
+
+        static std::unique_ptr<Node> negate(
+                std::unique_ptr<Node> operand)
+        {
+            std::unique_ptr<Node> node(new Node());
+            node->kind = Node::NOT;
+            node->left = std::move(operand);
+            return node;
+        }
+
+        std::unique_ptr<Node> condition()
+        {
+            std::unique_ptr<Node> left = term();
+            while (left && tokens_[pos_].kind == Token::OR)
+            {
+                ++pos_;
+                std::unique_ptr<Node> right = term();
+                if (!right)
+                {
+                    return nullptr;
+                }
+                left = binary(Node::OR, std::move(left), std::move(right));
+            }
+            return left;
+        }
+
+        std::unique_ptr<Node> term()
+        {
+            std::unique_ptr<Node> left = factor();
+            while (left && tokens_[pos_].kind == Token::AND)
+            {
+                ++pos_;
+                std::unique_ptr<Node> right = factor();
+                if (!right)
+                {
+                    return nullptr;
+                }
+                left = binary(Node::AND, std::move(left), std::move(right));
+            }
+            return left;
+        }
+
+        std::unique_ptr<Node> factor()
+        {
+            if (tokens_[pos_].kind == Token::NOT)
+            {
+                ++pos_;
+                std::unique_ptr<Node> operand = factor();
+                return operand ? negate(std::move(operand)) : nullptr;
+            }
+
+            if (tokens_[pos_].kind == Token::OPEN_PARENTHESIS)
+            {
+                ++pos_;
+                std::unique_ptr<Node> inner = condition();
+                if (!inner || tokens_[pos_].kind != Token::CLOSE_PARENTHESIS)
+                {
+                    logError(CONTENT_FILTER, "Missing ')' in filter expression");
+                    return nullptr;
+                }
+                ++pos_;
+                return inner;
+            }
+
+            return predicate();
+        }
+
+        std::unique_ptr<Node> predicate()
+        {
+            const Token* lhs = operand();
+            if (lhs == nullptr)
+            {
+                return nullptr;
+            }
+
+            bool negated = false;
+            if (tokens_[pos_].kind == Token::NOT)
+            {
+                negated = true;
+                ++pos_;
+            }
+
+            std::unique_ptr<Node> node;
+            if (tokens_[pos_].kind == Token::BETWEEN)
+            {
+                ++pos_;
+                const Token* low = operand();
+                if (low == nullptr || tokens_[pos_].kind != Token::AND)
+                {
+                    logError(CONTENT_FILTER, "Invalid BETWEEN in filter expression");
+                    return nullptr;
+                }
+                ++pos_;
+                const Token* high = operand();
+                if (high == nullptr)
+                {
+                    return nullptr;
+                }
+                std::unique_ptr<Node> above = comparison(*lhs, ContentFilterExpression::GREATER_EQUAL, *low);
+                std::unique_ptr<Node> below = comparison(*lhs, ContentFilterExpression::LESS_EQUAL, *high);
+                if (!above || !below)
+                {
+                    return nullptr;
+                }
+                node = binary(Node::AND, std::move(above), std::move(below));
+            }
+            else if (tokens_[pos_].kind == Token::LIKE)
+            {
+                ++pos_;
+                const Token* pattern = operand();
+                if (pattern == nullptr)
+                {
+                    return nullptr;
+                }
+                node = comparison(*lhs, ContentFilterExpression::LIKE, *pattern);
+            }
+            else if (!negated && tokens_[pos_].kind == Token::OPERATOR)
+            {
+                Operator op = tokens_[pos_].op;
+                ++pos_;
+                const Token* rhs = operand();
+                if (rhs == nullptr)
+                {
+                    return nullptr;
+                }
+                node = comparison(*lhs, op, *rhs);
+            }
+            else
+            {
+                logError(CONTENT_FILTER, "Expected an operator in filter expression");
+                return nullptr;
+            }
+
+            if (node && negated)
+            {
+                node = negate(std::move(node));
+            }
+            return node;
+        }
+
+        const Token* operand()
+        {
+            const Token& token = tokens_[pos_];
+            if (token.kind == Token::IDENTIFIER || token.kind == Token::LITERAL || token.kind == Token::PARAMETER)
+            {
+                ++pos_;
+                return &token;
+            }
+
+            logError(CONTENT_FILTER, "Expected a field, a literal or a parameter in filter expression");
+            return nullptr;
+        }
+
+        std::unique_ptr<Node> comparison(
+                const Token& lhs,
+                Operator op,
+                const Token& rhs)
+        {
+            std::unique_ptr<Node> node(new Node());
+            node->kind = Node::COMPARISON;
+            node->op = op;
+
+            // Fields are resolved first, so identifiers that are not fields can be taken as enumerators.
+            bool lhs_field = lhs.kind == Token::IDENTIFIER && resolve_field(lhs.text, node->lhs.field);
+            bool rhs_field = rhs.kind == Token::IDENTIFIER && resolve_field(rhs.text, node->rhs.field);
+            node->lhs.is_field = lhs_field;
+            node->rhs.is_field = rhs_field;
+
+            if ((!lhs_field && !resolve_value(lhs, rhs_field ? &node->rhs.field : nullptr, node->lhs.value)) ||
+                    (!rhs_field && !resolve_value(rhs, lhs_field ? &node->lhs.field : nullptr, node->rhs.value)))
+            {
+                return nullptr;
+            }
+
+            return node;
+        }
+
+        bool resolve_value(
+                const Token& token,
+                const Field* other_field,
+                Value& value)
+        {
+            if (token.kind == Token::LITERAL)
+            {
+                value = token.value;
+                return true;
+            }
+
+            if (token.kind == Token::PARAMETER)
+            {
+                if (token.parameter >= parameters_.size())
+                {
+                    logError(CONTENT_FILTER, "Missing value for parameter %" << token.parameter);
+                    return false;
+                }
+                value = parse_parameter(parameters_[token.parameter]);
+                return true;
+            }
+
+            if (other_field != nullptr && other_field->kind == TK_ENUM)
+            {
+                value.kind = Value::STRING;
+                value.string = token.text;
+                return true;
+            }
+
+            logError(CONTENT_FILTER, "Unknown field '" << token.text << "' in filter expression");
+            return false;
+        }
+
+        bool resolve_field(
+                const std::string& name,
+                Field& field)
+        {
+            std::vector<std::pair<DynamicData*, DynamicData*>> loans;
+            DynamicData* current = prototype_;
+            bool valid = true;
+            size_t begin = 0;
+
+            while (valid)
+            {
+                size_t end = name.find('.', begin);
+                std::string member = name.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+                MemberId id = current->get_member_id_by_name(member);
+                MemberDescriptor descriptor;
+                if (id == MEMBER_ID_INVALID || current->get_descriptor(descriptor, id) != ResponseCode::RETCODE_OK)
+                {
+                    valid = false;
+                    break;
+                }
+
+                field.path.push_back(id);
+                field.kind = descriptor.get_kind();
+                if (end == std::string::npos)
+                {
+                    valid = is_primitive(field.kind);
+                    break;
+                }
+
+                DynamicData* child = field.kind == TK_STRUCTURE ? current->loan_value(id) : nullptr;
+                if (child == nullptr)
+                {
+                    valid = false;
+                    break;
+                }
+                loans.emplace_back(current, child);
+                current = child;
+                begin = end + 1;
+            }
+
+            for (auto it = loans.rbegin(); it != loans.rend(); ++it)
+            {
+                it->first->return_loaned_value(it->second);
+            }
+
+            if (!valid)
+            {
+                field.path.clear();
+            }
+            return valid;
+        }
+
+        const std::vector<Token>& tokens_;
+
+        const std::vector<std::string>& parameters_;
+
+        DynamicData* prototype_;
+
+        size_t pos_;
+};
+
+bool read_value(
+        const DynamicData* data,
+        MemberId id,
+        TypeKind kind,
+        Value& value)
+{
+    ResponseCode ret = ResponseCode::RETCODE_ERROR;
+    value.kind = Value::INTEGER;
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+            value.kind = Value::BOOLEAN;
+            ret = data->get_bool_value(value.boolean, id);
+            break;
+        case TK_BYTE:
+        {
+            octet v = 0;
+            ret = data->get_byte_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_INT16:
+        {
+            int16_t v = 0;
+            ret = data->get_int16_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_INT32:
+        {
+            int32_t v = 0;
+            ret = data->get_int32_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_INT64:
+        {
+            int64_t v = 0;
+            ret = data->get_int64_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_UINT16:
+        {
+            uint16_t v = 0;
+            ret = data->get_uint16_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_UINT32:
+        {
+            uint32_t v = 0;
+            ret = data->get_uint32_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_UINT64:
+        {
+            uint64_t v = 0;
+            ret = data->get_uint64_value(v, id);
+            if (v > static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
+            {
+                value.kind = Value::FLOAT;
+                value.floating = static_cast<long double>(v);
+            }
+            else
+            {
+                value.integer = static_cast<int64_t>(v);
+            }
+            break;
+        }
+        case TK_FLOAT32:
+        {
+            float v = 0;
+            ret = data->get_float32_value(v, id);
+            value.kind = Value::FLOAT;
+            value.floating = v;
+            break;
+        }
+        case TK_FLOAT64:
+        {
+            double v = 0;
+            ret = data->get_float64_value(v, id);
+            value.kind = Value::FLOAT;
+            value.floating = v;
+            break;
+        }
+        case TK_FLOAT128:
+            value.kind = Value::FLOAT;
+            ret = data->get_float128_value(value.floating, id);
+            break;
+        case TK_CHAR8:
+        {
+            char v = 0;
+            ret = data->get_char8_value(v, id);
+            value.kind = Value::STRING;
+            value.string.assign(1, v);
+            break;
+        }
+        case TK_CHAR16:
+        {
+            wchar_t v = 0;
+            ret = data->get_char16_value(v, id);
+            value.integer = v;
+            break;
+        }
+        case TK_STRING8:
+            value.kind = Value::STRING;
+            ret = data->get_string_value(value.string, id);
+            break;
+        case TK_STRING16:
+        {
+            std::wstring v;
+            ret = data->get_wstring_value(v, id);
+            value.kind = Value::STRING;
+            value.string.assign(v.begin(), v.end());
+            break;
+        }
+        case TK_ENUM:
+        {
+            uint32_t v = 0;
+            value.kind = Value::ENUM;
+            ret = data->get_enum_value(v, id);
+            value.integer = v;
+            if (ret == ResponseCode::RETCODE_OK)
+            {
+                ret = data->get_enum_value(value.string, id);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return ret == ResponseCode::RETCODE_OK;
+}
+
+bool read_field(
+        DynamicData* data,
+        const Field& field,
+        Value& value)
+{
+    std::vector<std::pair<DynamicData*, DynamicData*>> loans;
+    DynamicData* current = data;
+    bool valid = true;
+
+    for (size_t i = 0; i + 1 < field.path.size(); ++i)
+    {
+        DynamicData* child = current->loan_value(field.path[i]);
+        if (child == nullptr)
+        {
+            valid = false;
+            break;
+        }
+        loans.emplace_back(current, child);
+        current = child;
+    }
+
+    valid = valid && read_value(current, field.path.back(), field.kind, value);
+
+    for (auto it = loans.rbegin(); it != loans.rend(); ++it)
+    {
+        it->first->return_loaned_value(it->second);
+    }
+
+    return valid;
+}
+
+//! SQL LIKE matching, where '%' matches any sequence of characters and '_' any single character.
+bool like(
+        const std::string& text,
+        const std::string& pattern)
+{
+    size_t t = 0;
+    size_t p = 0;
+    size_t star = std::string::npos;
+    size_t match = 0;
+
+    while (t < text.size())
+    {
+        if (p < pattern.size() && (pattern[p] == '_' || pattern[p] == text[t]))
+        {
+            ++t;
+            ++p;
+        }
+        else if (p < pattern.size() && pattern[p] == '%')
+        {
+            star = p++;
+            match = t;
+        }
+        else if (star != std::string::npos)
+        {
+            p = star + 1;
+            t = ++match;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (p < pattern.size() && pattern[p] == '%')
+    {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+template<typename T>
+bool compare(
+        const T& a,
+        Operator op,
+        const T& b)
+{
+    switch (op)
+    {
+        case ContentFilterExpression::EQUAL:
+            return a == b;
+        case ContentFilterExpression::NOT_EQUAL:
+            return !(a == b);
+        case ContentFilterExpression::LESS:
+            return a < b;
+        case ContentFilterExpression::LESS_EQUAL:
+            return !(b < a);
+        case ContentFilterExpression::GREATER:
+            return b < a;
+        case ContentFilterExpression::GREATER_EQUAL:
+            return !(a < b);
+        default:
+            return false;
+    }
+}
+
+bool compare(
+        const Value& a,
+        Operator op,
+        const Value& b)
+{
+    bool a_text = a.kind == Value::STRING || (a.kind == Value::ENUM && b.kind == Value::STRING);
+    bool b_text = b.kind == Value::STRING || (b.kind == Value::ENUM && a.kind == Value::STRING);
+    if (a_text || b_text)
+    {
+        if (!a_text || !b_text)
+        {
+            return false;
+        }
+        return op == ContentFilterExpression::LIKE ? like(a.string, b.string) : compare(a.string, op, b.string);
+    }
+
+    if (op == ContentFilterExpression::LIKE)
+    {
+        return false;
+    }
+
+    int64_t a_integer = a.kind == Value::BOOLEAN ? (a.boolean ? 1 : 0) : a.integer;
+    int64_t b_integer = b.kind == Value::BOOLEAN ? (b.boolean ? 1 : 0) : b.integer;
+    if (a.kind == Value::FLOAT || b.kind == Value::FLOAT)
+    {
+        long double a_floating = a.kind == Value::FLOAT ? a.floating : static_cast<long double>(a_integer);
+        long double b_floating = b.kind == Value::FLOAT ? b.floating : static_cast<long double>(b_integer);
+        return compare(a_floating, op, b_floating);
+    }
+
+    return compare(a_integer, op, b_integer);
+}
+
+} // namespace
+
+ContentFilterExpression::ContentFilterExpression()
+{
+}
+
+ContentFilterExpression::~ContentFilterExpression()
+{
+}
+
+bool ContentFilterExpression::compile(
+        const std::string& expression,
+        const std::vector<std::string>& parameters,
+        DynamicType_ptr type)
+{
+    root_.reset();
+
+    std::vector<Token> tokens;
+    if (!type || !tokenize(expression, tokens))
+    {
+        return false;
+    }
+
+    DynamicData* prototype = DynamicDataFactory::get_instance()->create_data(type);
+    if (prototype == nullptr)
+    {
+        return false;
+    }
+
+    Parser parser(tokens, parameters, prototype);
+    root_ = parser.parse();
+    DynamicDataFactory::get_instance()->delete_data(prototype);
+
+    return root_ != nullptr;
+}
+
+bool ContentFilterExpression::evaluate(
+        DynamicData* data) const
+{
+    return root_ && evaluate(root_.get(), data);
+}
+
+bool ContentFilterExpression::evaluate(
+        const Node* node,
+        DynamicData* data) const
+{
+    switch (node->kind)
+    {
+        case Node::AND:
+            return evaluate(node->left.get(), data) && evaluate(node->right.get(), data);
+        case Node::OR:
+            return evaluate(node->left.get(), data) || evaluate(node->right.get(), data);
+        case Node::NOT:
+            return !evaluate(node->left.get(), data);
+        case Node::COMPARISON:
+        {
+            Value lhs;
+            Value rhs;
+            if ((node->lhs.is_field && !read_field(data, node->lhs.field, lhs)) ||
+                    (node->rhs.is_field && !read_field(data, node->rhs.field, rhs)))
+            {
+                return false;
+            }
+            return compare(node->lhs.is_field ? lhs : node->lhs.value, node->op,
+                           node->rhs.is_field ? rhs : node->rhs.value);
+        }
+    }
+
+    return false;
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,168 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterExpression.h
+ */
+
+#ifndef _TYPES_CONTENTFILTEREXPRESSION_H_
+#define _TYPES_CONTENTFILTEREXPRESSION_H_
+
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+class DynamicData;
+
+/**
+ * Filter expression of a content filtered topic, compiled against a DynamicType.
+ *
+ * Field names are resolved to member ids when the expression is compiled, and parameters are replaced by their
+ * values, so evaluating a sample only walks the compiled tree.
+ * See rtps::ContentFilterProperty_t for the supported grammar.
+ */
+class ContentFilterExpression
+{
+    public:
+
+        ContentFilterExpression();
+
+        ~ContentFilterExpression();
+
+        /**
+         * Compile an expression.
+         * @param expression Filter expression.
+         * @param parameters Values of the parameters of the expression.
+         * @param type Type of the samples the expression will be evaluated on.
+         * @return false if the expression is not valid for the type.
+         */
+        bool compile(
+                const std::string& expression,
+                const std::vector<std::string>& parameters,
+                DynamicType_ptr type);
+
+        /**
+         * Evaluate the compiled expression on a sample.
+         * @param data Sample, of the type used to compile the expression.
+         * @return true if the sample passes the filter.
+         */
+        bool evaluate(
+                DynamicData* data) const;
+
+        //! Value of a field, a literal or a parameter.
+        struct Value
+        {
+            enum Kind
+            {
+                BOOLEAN,
+                INTEGER,
+                FLOAT,
+                STRING,
+                ENUM
+            };
+
+            Value()
+                : kind(INTEGER)
+                , boolean(false)
+                , integer(0)
+                , floating(0)
+            {
+            }
+
+            Kind kind;
+            bool boolean;
+            int64_t integer;
+            long double floating;
+            //! Value of strings and name of the enumerator of enumerations.
+            std::string string;
+        };
+
+        //! Path from the root of the type to a primitive field.
+        struct Field
+        {
+            std::vector<MemberId> path;
+
+            TypeKind kind;
+        };
+
+        struct Operand
+        {
+            Operand()
+                : is_field(false)
+            {
+            }
+
+            bool is_field;
+
+            Field field;
+
+            Value value;
+        };
+
+        enum Operator
+        {
+            EQUAL,
+            NOT_EQUAL,
+            LESS,
+            LESS_EQUAL,
+            GREATER,
+            GREATER_EQUAL,
+            LIKE
+        };
+
+        struct Node
+        {
+            enum Kind
+            {
+                AND,
+                OR,
+                NOT,
+                COMPARISON
+            };
+
+            Kind kind;
+
+            std::unique_ptr<Node> left;
+
+            std::unique_ptr<Node> right;
+
+            Operand lhs;
+
+            Operator op;
+
+            Operand rhs;
+        };
+
+    private:
+
+        bool evaluate(
+                const Node* node,
+                DynamicData* data) const;
+
+        std::unique_ptr<Node> root_;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _TYPES_CONTENTFILTEREXPRESSION_H_
@@ -158,6 +158,27 @@ bool DynamicPubSubType::getKey(
     return true;
 }
 
+bool DynamicPubSubType::serializeKey(
+        void* data,
+        eprosima::fastrtps::rtps::SerializedPayload_t* key,
+        bool* requires_md5)
+{
+    if (dynamic_type_ == nullptr || !m_isGetKeyDefined)
+    {
+        return false;
+    }
+
+    uint32_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_));
+    key->reserve(keyBufferSize);
+
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)key->data, key->max_size);
+    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
+    ((DynamicData*)data)->serializeKey(ser);
+    key->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    *requires_md5 = keyBufferSize > 16;
+    return true;
+}
+
 std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(void* data)
 {
     return [data]() -> uint32_t
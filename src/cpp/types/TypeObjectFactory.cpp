@@ -26,6 +26,7 @@
 #include <fastrtps/utils/md5.h>
 #include <fastrtps/log/Log.h>
 #include <sstream>
+#include <unordered_set>
 
 namespace eprosima {
 namespace fastrtps {
@@ -65,143 +66,361 @@ ResponseCode TypeObjectFactory::delete_instance()
 
 TypeObjectFactory::TypeObjectFactory()
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    Registry& registry = registry_;
     // Generate basic TypeIdentifiers
     TypeIdentifier* auxIdent;
     // TK_BOOLEAN:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_BOOLEAN);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BOOLEAN, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BOOLEAN, auxIdent));
+    index_name(registry, TKNAME_BOOLEAN, auxIdent);
     // TK_BYTE:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BYTE, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_BYTE, auxIdent));
+    index_name(registry, TKNAME_BYTE, auxIdent);
     // TK_BYTE:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT8, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT8, auxIdent));
+    index_name(registry, TKNAME_UINT8, auxIdent);
     // TK_BYTE:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_BYTE);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT8, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT8, auxIdent));
+    index_name(registry, TKNAME_INT8, auxIdent);
     // TK_INT16:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_INT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT16, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT16, auxIdent));
+    index_name(registry, TKNAME_INT16, auxIdent);
     // TK_INT32:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_INT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT32, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT32, auxIdent));
+    index_name(registry, TKNAME_INT32, auxIdent);
     // TK_INT64:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_INT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT64, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_INT64, auxIdent));
+    index_name(registry, TKNAME_INT64, auxIdent);
     // TK_UINT16:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_UINT16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT16, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT16, auxIdent));
+    index_name(registry, TKNAME_UINT16, auxIdent);
     // TK_UINT32:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_UINT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT32, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT32, auxIdent));
+    index_name(registry, TKNAME_UINT32, auxIdent);
     // TK_UINT64:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_UINT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT64, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_UINT64, auxIdent));
+    index_name(registry, TKNAME_UINT64, auxIdent);
     // TK_FLOAT32:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_FLOAT32);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT32, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT32, auxIdent));
+    index_name(registry, TKNAME_FLOAT32, auxIdent);
     // TK_FLOAT64:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_FLOAT64);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT64, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT64, auxIdent));
+    index_name(registry, TKNAME_FLOAT64, auxIdent);
     // TK_FLOAT128:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_FLOAT128);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT128, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_FLOAT128, auxIdent));
+    index_name(registry, TKNAME_FLOAT128, auxIdent);
     // TK_CHAR8:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_CHAR8);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR8, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR8, auxIdent));
+    index_name(registry, TKNAME_CHAR8, auxIdent);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16, auxIdent));
+    index_name(registry, TKNAME_CHAR16, auxIdent);
     // TK_CHAR16:
     auxIdent = new TypeIdentifier;
     auxIdent->_d(TK_CHAR16);
-    identifiers_.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16T, auxIdent));
+    registry.identifiers.insert(std::pair<std::string, TypeIdentifier*>(TKNAME_CHAR16T, auxIdent));
+    index_name(registry, TKNAME_CHAR16T, auxIdent);
 }
 
 TypeObjectFactory::~TypeObjectFactory()
 {
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    const Registry& registry = registry_;
+
+    // The same TypeIdentifier may be registered under several names.
+    std::unordered_set<const TypeIdentifier*> stored_identifiers;
+    for (auto& it : registry.identifiers)
     {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-        auto id_it = identifiers_.begin();
-        while (id_it != identifiers_.end())
-        {
-            const TypeIdentifier* id = id_it->second;
-            nullify_all_entries(id);
-            delete (id);
-            ++id_it;
-        }
-        identifiers_.clear();
+        stored_identifiers.insert(it.second);
+    }
+    for (auto& it : registry.complete_identifiers)
+    {
+        stored_identifiers.insert(it.second);
+    }
+    for (const TypeIdentifier* id : stored_identifiers)
+    {
+        delete (id);
+    }
 
-        auto idc_it = complete_identifiers_.begin();
-        while (idc_it != complete_identifiers_.end())
-        {
-            const TypeIdentifier* id = idc_it->second;
-            nullify_all_entries(id);
-            delete (id);
-            ++idc_it;
-        }
-        complete_identifiers_.clear();
+    for (auto& it : registry.objects)
+    {
+        delete (it.second);
+    }
+    for (auto& it : registry.complete_objects)
+    {
+        delete (it.second);
     }
+}
+
+size_t TypeObjectFactory::hash_identifier(const TypeIdentifier& identifier)
+{
+    // FNV-1a over the discriminator and the fields that tell apart identifiers with the same discriminator.
+    // Collisions are resolved comparing the whole TypeIdentifier.
+    size_t hash = 2166136261u;
+    auto mix = [&hash](uint32_t value)
     {
-        std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
-        auto obj_it = objects_.begin();
-        while (obj_it != objects_.end())
+        for (int i = 0; i < 4; ++i)
         {
-            delete (obj_it->second);
-            ++obj_it;
+            hash ^= static_cast<octet>(value >> (i * 8));
+            hash *= 16777619u;
         }
-        objects_.clear();
+    };
+
+    mix(identifier._d());
+    switch (identifier._d())
+    {
+        case EK_MINIMAL:
+        case EK_COMPLETE:
+            for (int i = 0; i < 14; ++i)
+            {
+                mix(identifier.equivalence_hash()[i]);
+            }
+            break;
+        case TI_STRING8_SMALL:
+        case TI_STRING16_SMALL:
+            mix(identifier.string_sdefn().bound());
+            break;
+        case TI_STRING8_LARGE:
+        case TI_STRING16_LARGE:
+            mix(identifier.string_ldefn().bound());
+            break;
+        case TI_PLAIN_SEQUENCE_SMALL:
+            mix(identifier.seq_sdefn().bound());
+            if (identifier.seq_sdefn().element_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.seq_sdefn().element_identifier())));
+            }
+            break;
+        case TI_PLAIN_SEQUENCE_LARGE:
+            mix(identifier.seq_ldefn().bound());
+            if (identifier.seq_ldefn().element_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.seq_ldefn().element_identifier())));
+            }
+            break;
+        case TI_PLAIN_ARRAY_SMALL:
+            if (identifier.array_sdefn().element_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.array_sdefn().element_identifier())));
+            }
+            break;
+        case TI_PLAIN_ARRAY_LARGE:
+            if (identifier.array_ldefn().element_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.array_ldefn().element_identifier())));
+            }
+            break;
+        case TI_PLAIN_MAP_SMALL:
+            mix(identifier.map_sdefn().bound());
+            if (identifier.map_sdefn().key_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.map_sdefn().key_identifier())));
+            }
+            if (identifier.map_sdefn().element_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.map_sdefn().element_identifier())));
+            }
+            break;
+        case TI_PLAIN_MAP_LARGE:
+            mix(identifier.map_ldefn().bound());
+            if (identifier.map_ldefn().key_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.map_ldefn().key_identifier())));
+            }
+            if (identifier.map_ldefn().element_identifier() != nullptr)
+            {
+                mix(static_cast<uint32_t>(hash_identifier(*identifier.map_ldefn().element_identifier())));
+            }
+            break;
+        default:
+            break;
+    }
+
+    return hash;
+}
+
+size_t TypeObjectFactory::get_hash(
+        const Registry& registry,
+        const TypeIdentifier& identifier)
+{
+    // Stored identifiers are hashed only once, when they are registered.
+    auto it = registry.hashes.find(&identifier);
+    if (it != registry.hashes.end())
+    {
+        return it->second;
+    }
+    return hash_identifier(identifier);
+}
 
-        auto objc_it = complete_objects_.begin();
-        while (objc_it != complete_objects_.end())
+const TypeObjectFactory::TypeEntry* TypeObjectFactory::find_entry(
+        const Registry& registry,
+        const TypeIdentifier* identifier)
+{
+    const NameIndex& names = (identifier->_d() == EK_COMPLETE) ? registry.complete_names : registry.names;
+    auto range = names.equal_range(get_hash(registry, *identifier));
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (*(it->second.identifier) == *identifier)
         {
-            delete (objc_it->second);
-            ++objc_it;
+            return &it->second;
         }
-        complete_objects_.clear();
     }
+    return nullptr;
 }
 
-void TypeObjectFactory::create_builtin_annotations()
+const TypeIdentifier* TypeObjectFactory::find_identifier(
+        const Registry& registry,
+        const std::string& type_name,
+        bool complete)
 {
-    register_builtin_annotations_types(g_instance);
+    const IdentifierMap& identifiers = complete ? registry.complete_identifiers : registry.identifiers;
+    auto it = identifiers.find(type_name);
+    if (it != identifiers.end())
+    {
+        return it->second;
+    }
+
+    // Try with aliases
+    auto alias_it = registry.aliases.find(type_name);
+    if (alias_it != registry.aliases.end())
+    {
+        return find_identifier(registry, alias_it->second, complete);
+    }
+
+    return nullptr;
 }
 
-void TypeObjectFactory::nullify_all_entries(const TypeIdentifier* identifier)
+void TypeObjectFactory::index_name(
+        Registry& registry,
+        const std::string& type_name,
+        const TypeIdentifier* identifier)
 {
-    for (auto it = identifiers_.begin(); it != identifiers_.end(); ++it)
+    auto hash_it = registry.hashes.find(identifier);
+    if (hash_it == registry.hashes.end())
+    {
+        hash_it = registry.hashes.emplace(identifier, hash_identifier(*identifier)).first;
+    }
+
+    // When several names share an equivalent identifier, the lowest name is the reported one.
+    NameIndex& names = (identifier->_d() == EK_COMPLETE) ? registry.complete_names : registry.names;
+    auto range = names.equal_range(hash_it->second);
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (it->second == identifier)
+        if (*(it->second.identifier) == *identifier)
         {
-            it->second = nullptr;
+            if (type_name < it->second.name)
+            {
+                it->second.identifier = identifier;
+                it->second.name = type_name;
+            }
+            return;
         }
     }
 
-    for (auto it = complete_identifiers_.begin(); it != complete_identifiers_.end(); ++it)
+    names.emplace(hash_it->second, TypeEntry{identifier, type_name});
+}
+
+void TypeObjectFactory::reindex(
+        Registry& registry,
+        const TypeIdentifier* identifier)
+{
+    bool complete = identifier->_d() == EK_COMPLETE;
+    NameIndex& names = complete ? registry.complete_names : registry.names;
+    auto range = names.equal_range(get_hash(registry, *identifier));
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (it->second == identifier)
+        if (*(it->second.identifier) == *identifier)
         {
-            it->second = nullptr;
+            names.erase(it);
+            break;
+        }
+    }
+
+    for (auto& it : complete ? registry.complete_identifiers : registry.identifiers)
+    {
+        if (*(it.second) == *identifier)
+        {
+            index_name(registry, it.first, it.second);
         }
     }
 }
 
+const TypeIdentifier* TypeObjectFactory::store_type_identifier(
+        Registry& registry,
+        const std::string& type_name,
+        const TypeIdentifier* identifier)
+{
+    IdentifierMap& identifiers = (identifier->_d() == EK_COMPLETE) ?
+        registry.complete_identifiers : registry.identifiers;
+
+    const TypeEntry* alreadyExists = find_entry(registry, identifier);
+    if (alreadyExists != nullptr)
+    {
+        // Don't copy
+        const TypeIdentifier* stored = alreadyExists->identifier;
+        auto it = identifiers.find(type_name);
+        if (it == identifiers.end())
+        {
+            identifiers.emplace(type_name, stored);
+            index_name(registry, type_name, stored);
+        }
+        else if (it->second != stored)
+        {
+            const TypeIdentifier* previous = it->second;
+            it->second = stored;
+            reindex(registry, previous);
+            index_name(registry, type_name, stored);
+        }
+        return stored;
+    }
+
+    auto it = identifiers.find(type_name);
+    if (it != identifiers.end())
+    {
+        return it->second;
+    }
+
+    TypeIdentifier* id = new TypeIdentifier;
+    *id = *identifier;
+    identifiers.emplace(type_name, id);
+    index_name(registry, type_name, id);
+    return id;
+}
+
+void TypeObjectFactory::create_builtin_annotations()
+{
+    register_builtin_annotations_types(g_instance);
+}
+
 const TypeObject* TypeObjectFactory::get_type_object(const std::string& type_name, bool complete) const
 {
     const TypeIdentifier* identifier = get_type_identifier(type_name, complete);
@@ -215,32 +434,25 @@ const TypeObject* TypeObjectFactory::get_type_object(const std::string& type_nam
 
 const TypeObject* TypeObjectFactory::get_type_object(const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
     if (identifier == nullptr) return nullptr;
-    if (identifier->_d() == EK_COMPLETE)
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    const Registry& registry = registry_;
+    const ObjectMap& objects = (identifier->_d() == EK_COMPLETE) ? registry.complete_objects : registry.objects;
+    auto it = objects.find(identifier);
+    if (it != objects.end())
     {
-        if (complete_objects_.find(identifier) != complete_objects_.end())
-        {
-            return complete_objects_.at(identifier);
-        }
-    }
-    else
-    {
-        if (objects_.find(identifier) != objects_.end())
-        {
-            return objects_.at(identifier);
-        }
+        return it->second;
     }
 
     // Maybe they are using an external TypeIdentifier?
-    const TypeIdentifier* internalId = get_stored_type_identifier(identifier);
-    if (internalId != nullptr)
+    const TypeEntry* entry = find_entry(registry, identifier);
+    if (entry != nullptr && entry->identifier != identifier)
     {
-        if (internalId == identifier)
+        it = objects.find(entry->identifier);
+        if (it != objects.end())
         {
-            return nullptr; // Type without object
+            return it->second;
         }
-        return get_type_object(internalId);
     }
 
     return nullptr;
@@ -399,98 +611,43 @@ const TypeIdentifier* TypeObjectFactory::TryCreateTypeIdentifier(const std::stri
 
 const TypeIdentifier* TypeObjectFactory::get_type_identifier(const std::string& type_name, bool complete) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-
-    if (complete)
-    {
-        if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
-        {
-            return complete_identifiers_.at(type_name);
-        }
-        /*else // Try it with minimal
-        {
-            return get_type_identifier(type_name, false);
-        }*/
-    }
-    else
-    {
-        if (identifiers_.find(type_name) != identifiers_.end())
-        {
-            return identifiers_.at(type_name);
-        }
-    }
-
-    // Try with aliases
-    if (aliases_.find(type_name) != aliases_.end())
-    {
-        return get_type_identifier(aliases_.at(type_name), complete);
-    }
-
-    return nullptr;
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    const Registry& registry = registry_;
+    return find_identifier(registry, type_name, complete);
 }
 
 const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(const std::string& type_name) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    const Registry& registry = registry_;
 
-    if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+    auto it = registry.complete_identifiers.find(type_name);
+    if (it != registry.complete_identifiers.end())
     {
-        return complete_identifiers_.at(type_name);
+        return it->second;
     }
     else // Try it with minimal
     {
-        return get_type_identifier(type_name, false);
+        return find_identifier(registry, type_name, false);
     }
 }
 
 const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr) return nullptr;
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.second;
-        }
-    }
-    else
-    {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.second;
-        }
-    }
-    return nullptr;
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    const Registry& registry = registry_;
+    const TypeEntry* entry = find_entry(registry, identifier);
+    return (entry != nullptr) ? entry->identifier : nullptr;
 }
 
 std::string TypeObjectFactory::get_type_name(const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr) return "<NULLPTR>";
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        for (auto& it : complete_identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.first;
-        }
-    }
-    else
-    {
-        for (auto& it : identifiers_)
-        {
-            if (*(it.second) == *identifier) return it.first;
-        }
-    }
-
-    // Maybe they are using an external TypeIdentifier?
-    const TypeIdentifier* internalId = get_stored_type_identifier(identifier);
-    if (internalId != nullptr)
-    {
-        return get_type_name(internalId);
-    }
-
-    return "UNDEF";
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    const Registry& registry = registry_;
+    const TypeEntry* entry = find_entry(registry, identifier);
+    return (entry != nullptr) ? entry->name : "UNDEF";
 }
 
 const TypeIdentifier* TypeObjectFactory::try_get_complete(const TypeIdentifier* identifier) const
@@ -500,82 +657,48 @@ const TypeIdentifier* TypeObjectFactory::try_get_complete(const TypeIdentifier*
         return identifier;
     }
 
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     std::string name = get_type_name(identifier);
     return get_type_identifier_trying_complete(name);
 }
 
 void TypeObjectFactory::add_type_identifier(const std::string& type_name, const TypeIdentifier* identifier)
 {
-    const TypeIdentifier* alreadyExists = get_stored_type_identifier(identifier);
-    if (alreadyExists != nullptr)
-    {
-        // Don't copy
-        if (alreadyExists->_d() == EK_COMPLETE)
-        {
-            complete_identifiers_[type_name] = alreadyExists;
-        }
-        else
-        {
-            identifiers_[type_name] = alreadyExists;
-        }
-        return;
-    }
-
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
-    //identifiers_.insert(std::pair<const std::string, const TypeIdentifier*>(type_name, identifier));
-    if (identifier->_d() == EK_COMPLETE)
-    {
-        if (complete_identifiers_.find(type_name) == complete_identifiers_.end())
-        {
-            TypeIdentifier* id = new TypeIdentifier;
-            *id = *identifier;
-            complete_identifiers_[type_name] = id;
-        }
-    }
-    else
-    {
-        if (identifiers_.find(type_name) == identifiers_.end())
-        {
-            TypeIdentifier* id = new TypeIdentifier;
-            *id = *identifier;
-            identifiers_[type_name] = id;
-        }
-    }
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    Registry& registry = registry_;
+    store_type_identifier(registry, type_name, identifier);
 }
 
 void TypeObjectFactory::add_type_object(const std::string& type_name, const TypeIdentifier* identifier,
     const TypeObject* object)
 {
-    add_type_identifier(type_name, identifier);
-
-    std::unique_lock<std::recursive_mutex> scopedObj(m_MutexObjects);
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    Registry& registry = registry_;
+    store_type_identifier(registry, type_name, identifier);
 
-    if (object != nullptr)
+    if (object != nullptr && (object->_d() == EK_MINIMAL || object->_d() == EK_COMPLETE))
     {
-        if (object->_d() == EK_MINIMAL)
-        {
-            const TypeIdentifier* typeId = identifiers_[type_name];
-            if (objects_.find(typeId) == objects_.end())
-            {
-                TypeObject* obj = new TypeObject;
-                *obj = *object;
-                objects_[typeId] = obj;
-            }
-        }
-        else if (object->_d() == EK_COMPLETE)
+        bool complete = object->_d() == EK_COMPLETE;
+        const IdentifierMap& identifiers = complete ? registry.complete_identifiers : registry.identifiers;
+        ObjectMap& objects = complete ? registry.complete_objects : registry.objects;
+        auto id_it = identifiers.find(type_name);
+        if (id_it != identifiers.end() && objects.find(id_it->second) == objects.end())
         {
-            const TypeIdentifier* typeId = complete_identifiers_[type_name];
-            if (complete_objects_.find(typeId) == complete_objects_.end())
-            {
-                TypeObject* obj = new TypeObject;
-                *obj = *object;
-                complete_objects_[typeId] = obj;
-            }
+            TypeObject* obj = new TypeObject;
+            *obj = *object;
+            objects.emplace(id_it->second, obj);
         }
     }
 }
 
+void TypeObjectFactory::add_alias(
+        const std::string& alias_name,
+        const std::string& target_type)
+{
+    std::lock_guard<std::mutex> guard(m_MutexRegistry);
+    Registry& registry = registry_;
+    registry.aliases.emplace(alias_name, target_type);
+}
+
 const TypeIdentifier* TypeObjectFactory::get_string_identifier(
         uint32_t bound,
         bool wide)
@@ -38,20 +38,194 @@
 #include <net/if.h>
 #endif
 
+#if defined(__linux__)
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#endif
+
+#include <mutex>
+
 
 using namespace eprosima::fastrtps::rtps;
 
+namespace {
+
+/**
+ * Process-wide table of interface addresses.
+ * On Linux, a netlink socket subscribed to link and address events tells when it has to be rebuilt.
+ * Elsewhere, or when the socket cannot be opened, the table is rebuilt on every query.
+ */
+class InterfaceTable
+{
+    public:
+
+        InterfaceTable()
+            : valid_(false)
+            , version_(0)
+#if defined(__linux__)
+            , netlink_fd_(-1)
+#endif
+        {
+#if defined(__linux__)
+            // Subscribe before the first query, so no change in between is lost.
+            netlink_fd_ = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+            if (netlink_fd_ >= 0)
+            {
+                struct sockaddr_nl addr;
+                memset(&addr, 0, sizeof(addr));
+                addr.nl_family = AF_NETLINK;
+                addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+                if (bind(netlink_fd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0)
+                {
+                    close(netlink_fd_);
+                    netlink_fd_ = -1;
+                }
+            }
+#endif
+        }
+
+        ~InterfaceTable()
+        {
+#if defined(__linux__)
+            if (netlink_fd_ >= 0)
+            {
+                close(netlink_fd_);
+            }
+#endif
+        }
+
+        //! Returns true when the table has to be rebuilt. Consumes pending change notifications.
+        bool needs_refresh()
+        {
+#if defined(__linux__)
+            if (netlink_fd_ < 0)
+            {
+                return true;
+            }
+
+            bool changed = !valid_;
+            char buffer[4096];
+            while (true)
+            {
+                ssize_t received = recv(netlink_fd_, buffer, sizeof(buffer), 0);
+                if (received < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    {
+                        break;
+                    }
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    // Notifications were lost (ENOBUFS) or the socket failed.
+                    changed = true;
+                    if (errno != ENOBUFS)
+                    {
+                        close(netlink_fd_);
+                        netlink_fd_ = -1;
+                        break;
+                    }
+                    continue;
+                }
+
+                int length = static_cast<int>(received);
+                for (struct nlmsghdr* header = reinterpret_cast<struct nlmsghdr*>(buffer);
+                        NLMSG_OK(header, length); header = NLMSG_NEXT(header, length))
+                {
+                    switch (header->nlmsg_type)
+                    {
+                        case RTM_NEWADDR:
+                        case RTM_DELADDR:
+                        case RTM_NEWLINK:
+                        case RTM_DELLINK:
+                            changed = true;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+
+            return changed;
+#else
+            return true;
+#endif
+        }
+
+        std::mutex mutex_;
+
+        std::vector<IPFinder::info_IP> interfaces_;
+
+        bool valid_;
+
+        uint32_t version_;
+
+    private:
+
+#if defined(__linux__)
+        int netlink_fd_;
+#endif
+};
+
+InterfaceTable& interface_table()
+{
+    static InterfaceTable table;
+    return table;
+}
+
+} // namespace
+
 IPFinder::IPFinder() {
 }
 
 IPFinder::~IPFinder() {
 }
 
+bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
+{
+    InterfaceTable& table = interface_table();
+    std::lock_guard<std::mutex> guard(table.mutex_);
+
+    if (table.needs_refresh())
+    {
+        std::vector<info_IP> interfaces;
+        if (!queryIPs(&interfaces))
+        {
+            table.valid_ = false;
+            return false;
+        }
+
+        table.interfaces_.swap(interfaces);
+        table.valid_ = true;
+        ++table.version_;
+    }
+
+    for (const info_IP& info : table.interfaces_)
+    {
+        if (return_loopback || (info.type != IP6_LOCAL && info.type != IP4_LOCAL))
+        {
+            vec_name->push_back(info);
+        }
+    }
+
+    return true;
+}
+
+uint32_t IPFinder::getIPsVersion()
+{
+    InterfaceTable& table = interface_table();
+    std::lock_guard<std::mutex> guard(table.mutex_);
+    return table.version_;
+}
+
 #if defined(_WIN32)
 
 #define DEFAULT_ADAPTER_ADDRESSES_SIZE 15360
 
-bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
+bool IPFinder::queryIPs(std::vector<info_IP>* vec_name)
 {
     DWORD rv, size = DEFAULT_ADAPTER_ADDRESSES_SIZE;
     PIP_ADAPTER_ADDRESSES adapter_addresses, aa;
@@ -111,10 +285,7 @@ bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
                         info.scope_id = so->sin6_scope_id;
                     }
 
-                    if(return_loopback || (info.type != IP6_LOCAL && info.type != IP4_LOCAL))
-                    {
-                        vec_name->push_back(info);
-                    }
+                    vec_name->push_back(info);
                     //printf("Buffer: %s\n", buf);
                 }
             }
@@ -127,7 +298,7 @@ bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
 
 #else
 
-bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
+bool IPFinder::queryIPs(std::vector<info_IP>* vec_name)
 {
     struct ifaddrs *ifaddr, *ifa;
     int family, s;
@@ -148,21 +319,26 @@ bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
 
         if (family == AF_INET)
         {
-            s = getnameinfo(ifa->ifa_addr, sizeof(struct sockaddr_in),
-                    host, NI_MAXHOST, NULL, 0, NI_NUMERICHOST);
-            if (s != 0) {
-                printf("getnameinfo() failed: %s\n", gai_strerror(s));
-                freeifaddrs(ifaddr);
-                exit(EXIT_FAILURE);
+            struct sockaddr_in * so = (struct sockaddr_in *)ifa->ifa_addr;
+            if (inet_ntop(AF_INET, &so->sin_addr, host, NI_MAXHOST) == nullptr)
+            {
+                perror("inet_ntop");
+                continue;
             }
             info_IP info;
             info.type = IP4;
+            info.scope_id = 0;
             info.name = std::string(host);
             info.dev = std::string(ifa->ifa_name);
-            parseIP4(info);
+            info.locator.kind = LOCATOR_KIND_UDPv4;
+            info.locator.port = 0;
+            IPLocator::setIPv4(info.locator, reinterpret_cast<const unsigned char*>(&so->sin_addr));
+            if (IPLocator::isLocal(info.locator))
+            {
+                info.type = IP4_LOCAL;
+            }
 
-            if (return_loopback || info.type != IP4_LOCAL)
-                vec_name->push_back(info);
+            vec_name->push_back(info);
         }
         else if(family == AF_INET6)
         {
@@ -178,13 +354,16 @@ bool IPFinder::getIPs(std::vector<info_IP>* vec_name, bool return_loopback)
             info.type = IP6;
             info.name = std::string(host);
             info.dev = std::string(ifa->ifa_name);
-            if(parseIP6(info))
+            info.scope_id = so->sin6_scope_id;
+            info.locator.kind = LOCATOR_KIND_UDPv6;
+            info.locator.port = 0;
+            IPLocator::setIPv6(info.locator, reinterpret_cast<const unsigned char*>(&so->sin6_addr));
+            if (IPLocator::isLocal(info.locator))
             {
-                info.scope_id = so->sin6_scope_id;
-
-                if (return_loopback || info.type != IP6_LOCAL)
-                    vec_name->push_back(info);
+                info.type = IP6_LOCAL;
             }
+
+            vec_name->push_back(info);
             //printf("<Interface>: %s \t <Address> %s\n", ifa->ifa_name, host);
         }
     }
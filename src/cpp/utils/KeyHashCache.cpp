@@ -0,0 +1,95 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyHashCache.cpp
+ */
+
+#include "KeyHashCache.h"
+
+#include <fastrtps/TopicDataType.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+
+using namespace rtps;
+
+KeyHashCache::KeyHashCache(
+        TopicDataType* type,
+        uint32_t size)
+    : type_(type)
+    , entries_(std::max(size, 1u))
+{
+}
+
+bool KeyHashCache::get_key(
+        void* data,
+        InstanceHandle_t& handle,
+        bool force_md5)
+{
+    bool requires_md5 = false;
+    key_buffer_.length = 0;
+    if (!type_->serializeKey(data, &key_buffer_, &requires_md5))
+    {
+        return type_->getKey(data, &handle, force_md5);
+    }
+
+    // FNV-1a of the serialized key selects the entry.
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < key_buffer_.length; ++i)
+    {
+        hash = (hash ^ key_buffer_.data[i]) * 16777619u;
+    }
+    Entry& entry = entries_[hash % entries_.size()];
+
+    if (entry.valid && entry.force_md5 == force_md5 && entry.key.size() == key_buffer_.length &&
+            std::equal(entry.key.begin(), entry.key.end(), key_buffer_.data))
+    {
+        handle = entry.handle;
+        return true;
+    }
+
+    compute_handle(key_buffer_, force_md5 || requires_md5, handle);
+
+    entry.key.assign(key_buffer_.data, key_buffer_.data + key_buffer_.length);
+    entry.handle = handle;
+    entry.force_md5 = force_md5;
+    entry.valid = true;
+    return true;
+}
+
+void KeyHashCache::compute_handle(
+        const SerializedPayload_t& key,
+        bool use_md5,
+        InstanceHandle_t& handle)
+{
+    if (use_md5)
+    {
+        md5_.init();
+        md5_.update(key.data, key.length);
+        md5_.finalize();
+        memcpy(handle.value, md5_.digest, 16);
+    }
+    else
+    {
+        memset(handle.value, 0, 16);
+        memcpy(handle.value, key.data, std::min(key.length, 16u));
+    }
+}
+
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,97 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyHashCache.h
+ */
+
+#ifndef _UTILS_KEYHASHCACHE_H_
+#define _UTILS_KEYHASHCACHE_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/rtps/common/InstanceHandle.h>
+#include <fastrtps/rtps/common/SerializedPayload.h>
+#include <fastrtps/utils/md5.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+class TopicDataType;
+
+/**
+ * Cache of the instance handles of the last keys seen by a publisher or a subscriber.
+ *
+ * Types implementing TopicDataType::serializeKey have their key serialized and looked up in the cache, so the MD5
+ * of the key is only computed the first time an instance is written or received. Other types fall back on
+ * TopicDataType::getKey. The cache is direct mapped and does not allocate once its entries have grown to the size
+ * of the keys.
+ * It is not thread safe.
+ */
+class KeyHashCache
+{
+    public:
+
+        /**
+         * @param type Type of the samples.
+         * @param size Number of cached keys.
+         */
+        KeyHashCache(
+                TopicDataType* type,
+                uint32_t size = 64);
+
+        /**
+         * Get the instance handle of a sample.
+         * @param data Pointer to the sample.
+         * @param[out] handle Instance handle of the sample.
+         * @param force_md5 Whether the key is hashed even when it fits on the handle.
+         * @return True if the key could be obtained.
+         */
+        bool get_key(
+                void* data,
+                rtps::InstanceHandle_t& handle,
+                bool force_md5);
+
+    private:
+
+        struct Entry
+        {
+            std::vector<rtps::octet> key;
+            rtps::InstanceHandle_t handle;
+            bool force_md5 = false;
+            bool valid = false;
+        };
+
+        //! Calculates the instance handle of a serialized key, as TopicDataType::getKey does.
+        void compute_handle(
+                const rtps::SerializedPayload_t& key,
+                bool use_md5,
+                rtps::InstanceHandle_t& handle);
+
+        TopicDataType* type_;
+
+        std::vector<Entry> entries_;
+
+        rtps::SerializedPayload_t key_buffer_;
+
+        MD5 md5_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // _UTILS_KEYHASHCACHE_H_
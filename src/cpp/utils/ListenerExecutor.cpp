@@ -0,0 +1,180 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ListenerExecutor.cpp
+ */
+
+#include "ListenerExecutor.h"
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps {
+
+class ListenerExecutor::Strand
+{
+    friend class ListenerExecutor;
+
+    //! Tasks waiting to run.
+    std::deque<std::function<void()>> tasks_;
+
+    //! Whether the strand is in the ready queue or one of its tasks is running.
+    bool scheduled_ = false;
+
+    //! Whether one of its tasks is running.
+    bool running_ = false;
+
+    //! Thread running the task, when running_ is set.
+    std::thread::id running_thread_;
+
+    //! Set when the strand was destroyed from its own running task.
+    bool destroyed_ = false;
+};
+
+ListenerExecutor::ListenerExecutor(
+        uint32_t thread_count)
+    : running_(true)
+{
+    thread_count = std::max(thread_count, 1u);
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        threads_.emplace_back(&ListenerExecutor::run, this);
+    }
+}
+
+ListenerExecutor::~ListenerExecutor()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        running_ = false;
+        ready_.clear();
+    }
+    ready_cv_.notify_all();
+
+    for (std::thread& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+ListenerExecutor::Strand* ListenerExecutor::create_strand()
+{
+    return new Strand();
+}
+
+void ListenerExecutor::destroy_strand(
+        Strand* strand)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    strand->tasks_.clear();
+
+    if (strand->running_)
+    {
+        if (strand->running_thread_ == std::this_thread::get_id())
+        {
+            // The thread running the task will delete it.
+            strand->destroyed_ = true;
+            return;
+        }
+
+        idle_cv_.wait(lock, [strand]()
+                {
+                    return !strand->running_;
+                });
+    }
+
+    if (strand->scheduled_)
+    {
+        auto it = std::find(ready_.begin(), ready_.end(), strand);
+        if (it != ready_.end())
+        {
+            ready_.erase(it);
+        }
+    }
+
+    delete strand;
+}
+
+void ListenerExecutor::post(
+        Strand* strand,
+        std::function<void()>&& task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    strand->tasks_.push_back(std::move(task));
+
+    if (!strand->scheduled_)
+    {
+        strand->scheduled_ = true;
+        ready_.push_back(strand);
+        lock.unlock();
+        ready_cv_.notify_one();
+    }
+}
+
+void ListenerExecutor::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        ready_cv_.wait(lock, [this]()
+                {
+                    return !running_ || !ready_.empty();
+                });
+
+        if (!running_)
+        {
+            return;
+        }
+
+        Strand* strand = ready_.front();
+        ready_.pop_front();
+
+        std::function<void()> task = std::move(strand->tasks_.front());
+        strand->tasks_.pop_front();
+        strand->running_ = true;
+        strand->running_thread_ = std::this_thread::get_id();
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        strand->running_ = false;
+
+        if (strand->destroyed_)
+        {
+            delete strand;
+            continue;
+        }
+
+        // Only one task of each strand is run at a time. The strand goes to the back of the queue so that the
+        // tasks of the other strands are not delayed.
+        if (strand->tasks_.empty())
+        {
+            strand->scheduled_ = false;
+        }
+        else
+        {
+            ready_.push_back(strand);
+            ready_cv_.notify_one();
+        }
+
+        idle_cv_.notify_all();
+    }
+}
+
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,107 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ListenerExecutor.h
+ */
+
+#ifndef _UTILS_LISTENEREXECUTOR_H_
+#define _UTILS_LISTENEREXECUTOR_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Pool of threads calling user listeners out of the threads that receive the data.
+ *
+ * Tasks are posted to strands. Tasks of the same strand run one at a time and in the order they were posted, while
+ * tasks of different strands may run concurrently on different threads.
+ */
+class ListenerExecutor
+{
+    public:
+
+        //! Serial queue of tasks
+        class Strand;
+
+        /**
+         * @param thread_count Number of threads of the pool. At least one thread is created.
+         */
+        explicit ListenerExecutor(
+                uint32_t thread_count);
+
+        //! Stops the threads. Pending tasks are discarded.
+        ~ListenerExecutor();
+
+        ListenerExecutor(
+                const ListenerExecutor&) = delete;
+
+        ListenerExecutor& operator =(
+                const ListenerExecutor&) = delete;
+
+        //! @return A new strand, which must be destroyed with destroy_strand.
+        Strand* create_strand();
+
+        /**
+         * Destroy a strand, discarding its pending tasks.
+         * When a task of the strand is running on other thread, waits for it to finish. When called from a task of
+         * the strand itself, the strand is destroyed once the task returns.
+         * @param strand Strand to destroy.
+         */
+        void destroy_strand(
+                Strand* strand);
+
+        /**
+         * Post a task to a strand.
+         * @param strand Strand where the task is queued.
+         * @param task Task to run.
+         */
+        void post(
+                Strand* strand,
+                std::function<void()>&& task);
+
+    private:
+
+        void run();
+
+        std::mutex mutex_;
+
+        //! Signaled when a strand has tasks ready or the executor is stopping.
+        std::condition_variable ready_cv_;
+
+        //! Signaled when a task finishes.
+        std::condition_variable idle_cv_;
+
+        //! Strands with pending tasks which are not running.
+        std::deque<Strand*> ready_;
+
+        std::vector<std::thread> threads_;
+
+        bool running_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
+#endif // _UTILS_LISTENEREXECUTOR_H_
@@ -0,0 +1,128 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Threading.cpp
+ */
+
+#include "Threading.h"
+
+#include <fastrtps/log/Log.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#endif
+
+namespace eprosima {
+namespace fastrtps {
+
+#if defined(_WIN32)
+
+void set_current_thread_settings(
+        const std::string& name,
+        const rtps::ThreadSettings& settings)
+{
+    // Thread names need SetThreadDescription, which is only available since Windows 10, so they are only used on
+    // the warnings.
+    if (settings.priority != rtps::c_ThreadSettingInherited)
+    {
+        if (!SetThreadPriority(GetCurrentThread(), settings.priority))
+        {
+            logWarning(THREADING, "Cannot set priority " << settings.priority << " of thread " << name <<
+                    " (error " << GetLastError() << ")");
+        }
+    }
+
+    if (settings.affinity != 0)
+    {
+        if (SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(settings.affinity)) == 0)
+        {
+            logWarning(THREADING, "Cannot set affinity of thread " << name << " (error " << GetLastError() << ")");
+        }
+    }
+}
+
+#else
+
+void set_current_thread_settings(
+        const std::string& name,
+        const rtps::ThreadSettings& settings)
+{
+    pthread_t self = pthread_self();
+
+#if defined(__APPLE__)
+    pthread_setname_np(name.substr(0, 15).c_str());
+#else
+    pthread_setname_np(self, name.substr(0, 15).c_str());
+#endif
+
+    if (settings.scheduling_policy != rtps::c_ThreadSettingInherited ||
+            settings.priority != rtps::c_ThreadSettingInherited)
+    {
+        int policy = 0;
+        sched_param param;
+        memset(&param, 0, sizeof(param));
+        int result = pthread_getschedparam(self, &policy, &param);
+        if (result == 0)
+        {
+            if (settings.scheduling_policy != rtps::c_ThreadSettingInherited)
+            {
+                policy = settings.scheduling_policy;
+            }
+            if (settings.priority != rtps::c_ThreadSettingInherited)
+            {
+                param.sched_priority = settings.priority;
+            }
+            result = pthread_setschedparam(self, policy, &param);
+        }
+
+        if (result != 0)
+        {
+            logWarning(THREADING, "Cannot set scheduling policy " << policy << " with priority " <<
+                    param.sched_priority << " on thread " << name << ": " << strerror(result));
+        }
+    }
+
+    if (settings.affinity != 0)
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (uint32_t cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if ((settings.affinity & (uint64_t(1) << cpu)) != 0)
+            {
+                CPU_SET(cpu, &cpu_set);
+            }
+        }
+
+        int result = pthread_setaffinity_np(self, sizeof(cpu_set), &cpu_set);
+        if (result != 0)
+        {
+            logWarning(THREADING, "Cannot set affinity of thread " << name << ": " << strerror(result));
+        }
+#else
+        logWarning(THREADING, "Thread affinity is not supported on this platform. Ignored for thread " << name);
+#endif
+    }
+}
+
+#endif
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
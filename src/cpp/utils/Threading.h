@@ -0,0 +1,46 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Threading.h
+ */
+
+#ifndef _UTILS_THREADING_H_
+#define _UTILS_THREADING_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/rtps/attributes/ThreadSettings.hpp>
+
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Names the calling thread and applies the given scheduling settings to it.
+ *
+ * Names longer than 15 characters are truncated, as that is the limit on Linux. Settings that cannot be applied are
+ * reported with a warning.
+ * @param name Name of the thread, as shown by debuggers and tools like top.
+ * @param settings Scheduling settings of the thread.
+ */
+void set_current_thread_settings(
+        const std::string& name,
+        const rtps::ThreadSettings& settings);
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS_PUBLIC */
+#endif /* _UTILS_THREADING_H_ */
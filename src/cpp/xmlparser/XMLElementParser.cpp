@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cstdlib>
 #include <cstring>
 #include <tinyxml2.h>
 #include <fastrtps/xmlparser/XMLParserCommon.h>
@@ -20,6 +21,10 @@
 #include <fastrtps/utils/IPLocator.h>
 #include <fastrtps/log/Log.h>
 
+#if !defined(_WIN32)
+#include <sched.h>
+#endif
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace eprosima::fastrtps::xmlparser;
@@ -225,6 +230,12 @@ XMLP_ret XMLParser::getXMLDiscoverySettings(tinyxml2::XMLElement* elem, rtps::Di
                     if (XMLP_ret::XML_OK != getXMLBool(p_aux1, &settings.m_simpleEDP.use_PublicationReaderANDSubscriptionWriter, ident + 1))
                         return XMLP_ret::XML_ERROR;
                 }
+                else if (strcmp(name, TOPIC_INTEREST_FILTER) == 0)
+                {
+                    // TOPIC_INTEREST_FILTER - boolType
+                    if (XMLP_ret::XML_OK != getXMLBool(p_aux1, &settings.m_simpleEDP.use_topic_interest_filter, ident + 1))
+                        return XMLP_ret::XML_ERROR;
+                }
                 else
                 {
                     logError(XMLPARSER, "Invalid element found into 'simpleEDP'. Name: " << name);
@@ -862,6 +873,14 @@ XMLP_ret XMLParser::getXMLWriterQosPolicies(tinyxml2::XMLElement *elem, WriterQo
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, BATCH) == 0)
+        {
+            // batch
+            if (XMLP_ret::XML_OK != getXMLBatchQos(p_aux0, qos.m_batch, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, DURABILITY_SRV) == 0 || strcmp(name, LATENCY_BUDGET) == 0 ||
                  strcmp(name, USER_DATA) == 0 || strcmp(name, TIME_FILTER) == 0 ||
                  strcmp(name, OWNERSHIP) == 0 || strcmp(name, OWNERSHIP_STRENGTH) == 0 ||
@@ -966,8 +985,16 @@ XMLP_ret XMLParser::getXMLReaderQosPolicies(tinyxml2::XMLElement *elem, ReaderQo
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, TIME_FILTER) == 0)
+        {
+            // timeBasedFilter
+            if (XMLP_ret::XML_OK != getXMLTimeBasedFilterQos(p_aux0, qos.m_timeBasedFilter, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, DURABILITY_SRV) == 0 || strcmp(name, LATENCY_BUDGET) == 0 ||
-                 strcmp(name, USER_DATA) == 0 || strcmp(name, TIME_FILTER) == 0 ||
+                 strcmp(name, USER_DATA) == 0 ||
                  strcmp(name, OWNERSHIP) == 0 || strcmp(name, OWNERSHIP_STRENGTH) == 0 ||
                  strcmp(name, DEST_ORDER) == 0 || strcmp(name, PRESENTATION) == 0 ||
                  strcmp(name, TOPIC_DATA) == 0 || strcmp(name, GROUP_DATA) == 0)
@@ -976,7 +1003,6 @@ XMLP_ret XMLParser::getXMLReaderQosPolicies(tinyxml2::XMLElement *elem, ReaderQo
             //if (nullptr != (p_aux = elem->FirstChildElement(    DURABILITY_SRV))) getXMLDurabilityServiceQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(    LATENCY_BUDGET))) getXMLLatencyBudgetQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(         USER_DATA))) getXMLUserDataQos(p_aux, ident);
-            //if (nullptr != (p_aux = elem->FirstChildElement(       TIME_FILTER))) getXMLTimeBasedFilterQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(         OWNERSHIP))) getXMLOwnershipQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(        DEST_ORDER))) getXMLDestinationOrderQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(      PRESENTATION))) getXMLPresentationQos(p_aux, ident);
@@ -1428,6 +1454,146 @@ XMLP_ret XMLParser::getXMLDisablePositiveAcksQos(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLBatchQos(
+        tinyxml2::XMLElement* elem,
+        BatchQosPolicy& batch,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="batchQosPolicyType">
+            <xs:all>
+                <xs:element name="enabled" type="bool"/>
+                <xs:element name="max_data_bytes" type="uint32Type"/>
+                <xs:element name="max_samples" type="uint32Type"/>
+                <xs:element name="max_flush_delay" type="durationType"/>
+            </xs:all>
+        </xs:complexType>
+    */
+
+    tinyxml2::XMLElement *p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, ENABLED) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &batch.enabled, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_DATA_BYTES) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &batch.max_data_bytes, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_SAMPLES) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &batch.max_samples, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, MAX_FLUSH_DELAY) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, batch.max_flush_delay, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else
+        {
+            logError(XMLPARSER, "Node 'batchQosPolicyType' with unknown content");
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
+XMLP_ret XMLParser::getXMLThreadSettings(
+        tinyxml2::XMLElement* elem,
+        rtps::ThreadSettings& settings,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadSettingsType">
+            <xs:all>
+                <xs:element name="scheduling_policy" type="stringType" minOccurs="0"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
+                <xs:element name="affinity" type="uint64Type" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+    */
+
+    tinyxml2::XMLElement *p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, THREAD_SCHEDULING_POLICY) == 0)
+        {
+            // scheduling_policy - SCHED_OTHER, SCHED_FIFO, SCHED_RR or the value of the policy
+            const char* text = p_aux0->GetText();
+#if !defined(_WIN32)
+            if (nullptr != text && strcmp(text, "SCHED_OTHER") == 0)
+            {
+                settings.scheduling_policy = SCHED_OTHER;
+            }
+            else if (nullptr != text && strcmp(text, "SCHED_FIFO") == 0)
+            {
+                settings.scheduling_policy = SCHED_FIFO;
+            }
+            else if (nullptr != text && strcmp(text, "SCHED_RR") == 0)
+            {
+                settings.scheduling_policy = SCHED_RR;
+            }
+            else
+#endif
+            {
+                int policy = 0;
+                if (nullptr == text || XMLP_ret::XML_OK != getXMLInt(p_aux0, &policy, ident))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                settings.scheduling_policy = policy;
+            }
+        }
+        else if (strcmp(name, THREAD_PRIORITY) == 0)
+        {
+            // priority - int32Type
+            int priority = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &priority, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.priority = priority;
+        }
+        else if (strcmp(name, THREAD_AFFINITY) == 0)
+        {
+            // affinity - uint64Type, which may be written in hexadecimal
+            const char* text = p_aux0->GetText();
+            char* end = nullptr;
+            unsigned long long affinity = (nullptr == text) ? 0 : strtoull(text, &end, 0);
+            if (nullptr == text || end == text || *end != '\0')
+            {
+                logError(XMLPARSER, "<" << p_aux0->Value() << "> getXMLThreadSettings XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.affinity = static_cast<uint64_t>(affinity);
+        }
+        else
+        {
+            logError(XMLPARSER, "Node 'threadSettingsType' with unknown content");
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLTimeBasedFilterQos(tinyxml2::XMLElement *elem,
                                                     TimeBasedFilterQosPolicy &timeBasedFilter,
                                                     uint8_t ident)
@@ -1888,6 +2054,8 @@ XMLP_ret XMLParser::getXMLWriterTimes(tinyxml2::XMLElement *elem, WriterTimes &t
                 <xs:element name="heartbeatPeriod" type="durationType" minOccurs="0"/>
                 <xs:element name="nackResponseDelay" type="durationType" minOccurs="0"/>
                 <xs:element name="nackSupressionDuration" type="durationType" minOccurs="0"/>
+                <xs:element name="adaptiveReliability" type="boolType" minOccurs="0"/>
+                <xs:element name="minHeartbeatPeriod" type="durationType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -1920,6 +2088,18 @@ XMLP_ret XMLParser::getXMLWriterTimes(tinyxml2::XMLElement *elem, WriterTimes &t
             if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, times.nackSupressionDuration, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, ADAPTIVE_RELIABILITY) == 0)
+        {
+            // adaptiveReliability
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &times.adaptiveReliability, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, MIN_HEARTB_PERIOD) == 0)
+        {
+            // minHeartbeatPeriod
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, times.minHeartbeatPeriod, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'writerTimesType'. Name: " << name);
@@ -2240,6 +2420,7 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
                 <xs:enumeration value="PREALLOCATED"/>
                 <xs:enumeration value="PREALLOCATED_WITH_REALLOC"/>
                 <xs:enumeration value="DYNAMIC"/>
+                <xs:enumeration value="SLAB"/>
             </xs:restriction>
         </xs:simpleType>
     */
@@ -2255,6 +2436,8 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
         historyMemoryPolicy = MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
     else if (strcmp(text, DYNAMIC) == 0)
         historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE;
+    else if (strcmp(text, SLAB) == 0)
+        historyMemoryPolicy = MemoryManagementPolicy::SLAB_MEMORY_MODE;
     else
     {
         logError(XMLPARSER, "Node '" << KIND << "' bad content");
@@ -264,6 +264,9 @@ XMLP_ret XMLParser::parseXMLTransportData(tinyxml2::XMLElement* p_root)
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="accept_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="keep_alive_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
     */
@@ -393,6 +396,7 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(tinyxml2::XMLElement* p_root, sp
                 <xs:element name="logical_port_increment" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="metadata_logical_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="listening_ports" type="portListType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
     */
@@ -468,6 +472,12 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(tinyxml2::XMLElement* p_root, sp
                 }
             }
         }
+        else if (strcmp(name, RECEPTION_THREADS) == 0)
+        {
+            // reception_threads - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, pDesc->reception_threads, 0))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, TCP_WAN_ADDR) == 0 || strcmp(name, UDP_OUTPUT_PORT) == 0 ||
             strcmp(name, TRANSPORT_ID) == 0 || strcmp(name, TYPE) == 0 ||
             strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 || strcmp(name, KEEP_ALIVE_TIMEOUT) == 0 ||
@@ -475,7 +485,8 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(tinyxml2::XMLElement* p_root, sp
             strcmp(name, LOGICAL_PORT_INCREMENT) == 0 || strcmp(name, LISTENING_PORTS) == 0 ||
             strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
             strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TLS) == 0 ||
-            strcmp(name, NON_BLOCKING_SEND) == 0 )
+            strcmp(name, NON_BLOCKING_SEND) == 0 || strcmp(name, ACCEPT_THREAD) == 0 ||
+            strcmp(name, KEEP_ALIVE_THREAD) == 0)
         {
             // Parsed outside of this method
         }
@@ -507,6 +518,8 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(tinyxml2::XMLElement* p_root,
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="accept_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="keep_alive_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
     */
@@ -604,11 +617,25 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(tinyxml2::XMLElement* p_root,
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, ACCEPT_THREAD) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, pTCPDesc->accept_thread, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, KEEP_ALIVE_THREAD) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, pTCPDesc->keep_alive_thread, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, TCP_WAN_ADDR) == 0 || strcmp(name, TRANSPORT_ID) == 0 ||
                 strcmp(name, TYPE) == 0 || strcmp(name, SEND_BUFFER_SIZE) == 0 ||
                 strcmp(name, RECEIVE_BUFFER_SIZE) == 0 || strcmp(name, TTL) == 0 ||
                 strcmp(name, MAX_MESSAGE_SIZE) == 0 || strcmp(name, MAX_INITIAL_PEERS_RANGE) == 0 ||
-                strcmp(name, WHITE_LIST) == 0)
+                strcmp(name, WHITE_LIST) == 0 || strcmp(name, RECEPTION_THREADS) == 0)
             {
                 // Parsed Outside of this method
             }
@@ -2389,6 +2416,7 @@ XMLP_ret XMLParser::parseLogConfig(tinyxml2::XMLElement* p_root)
     <xs:element name="log">
       <xs:complexType>
         <xs:boolean name="use_default"/>
+        <xs:element name="thread_settings" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
         <xs:sequence>
           <xs:element maxOccurs="consumer">
             <xs:complexType>
@@ -2409,13 +2437,28 @@ XMLP_ret XMLParser::parseLogConfig(tinyxml2::XMLElement* p_root)
         p_aux0 = p_root;
     }
 
-    tinyxml2::XMLElement* p_element = p_aux0->FirstChildElement();
+    tinyxml2::XMLElement* p_element = p_aux0->FirstChildElement(THREAD_SETTINGS);
+    if (nullptr != p_element)
+    {
+        rtps::ThreadSettings thread_settings;
+        if (XMLP_ret::XML_OK != getXMLThreadSettings(p_element, thread_settings, 0))
+        {
+            return XMLP_ret::XML_ERROR;
+        }
+        Log::SetThreadSettings(thread_settings);
+    }
+
+    p_element = p_aux0->FirstChildElement();
     const char* tag = nullptr;
     while (nullptr != p_element)
     {
         if (nullptr != (tag = p_element->Value()))
         {
-            if (strcmp(tag, USE_DEFAULT) == 0)
+            if (strcmp(tag, THREAD_SETTINGS) == 0)
+            {
+                // Already parsed
+            }
+            else if (strcmp(tag, USE_DEFAULT) == 0)
             {
                 bool use_default = true;
                 std::string auxBool = p_element->GetText();
@@ -2628,6 +2671,9 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Parti
                 <xs:element name="useBuiltinTransports" type="boolType" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="name" type="stringType" minOccurs="0"/>
+                <xs:element name="timed_events_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="async_writer_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="flow_controller_thread" type="threadSettingsType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -2781,6 +2827,33 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Parti
             }
             participant_node.get()->rtps.setName(s.c_str());
         }
+        else if (strcmp(name, TIMED_EVENTS_THREAD) == 0)
+        {
+            // timed_events_thread
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.timed_events_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, ASYNC_WRITER_THREAD) == 0)
+        {
+            // async_writer_thread
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.async_writer_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, FLOW_CONTROLLER_THREAD) == 0)
+        {
+            // flow_controller_thread
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.flow_controller_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'rtpsParticipantAttributesType'. Name: " << name);
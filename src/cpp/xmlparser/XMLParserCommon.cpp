@@ -54,6 +54,9 @@ const char* METADATA_LOGICAL_PORT = "metadata_logical_port";
 const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
 const char* CHECK_CRC = "check_crc";
+const char* RECEPTION_THREADS = "reception_threads";
+const char* ACCEPT_THREAD = "accept_thread";
+const char* KEEP_ALIVE_THREAD = "keep_alive_thread";
 
 const char* QOS_PROFILE = "qos_profile";
 const char* APPLICATION = "application";
@@ -80,6 +83,9 @@ const char* THROUGHPUT_CONT = "throughputController";
 const char* USER_TRANS = "userTransports";
 const char* USE_BUILTIN_TRANS = "useBuiltinTransports";
 const char* PROPERTIES_POLICY = "propertiesPolicy";
+const char* TIMED_EVENTS_THREAD = "timed_events_thread";
+const char* ASYNC_WRITER_THREAD = "async_writer_thread";
+const char* FLOW_CONTROLLER_THREAD = "flow_controller_thread";
 const char* NAME = "name";
 const char* REMOTE_LOCATORS = "remote_locators";
 const char* MAX_UNICAST_LOCATORS = "max_unicast_locators";
@@ -113,6 +119,7 @@ const char* PROPAGATE = "propagate";
 const char* PREALLOCATED = "PREALLOCATED";
 const char* PREALLOCATED_WITH_REALLOC = "PREALLOCATED_WITH_REALLOC";
 const char* DYNAMIC = "DYNAMIC";
+const char* SLAB = "SLAB";
 const char* LOCATOR = "locator";
 const char* UDPv4_LOCATOR = "udpv4";
 const char* UDPv6_LOCATOR = "udpv6";
@@ -133,6 +140,8 @@ const char* INIT_HEARTB_DELAY = "initialHeartbeatDelay";
 const char* HEARTB_PERIOD = "heartbeatPeriod";
 const char* NACK_RESP_DELAY = "nackResponseDelay";
 const char* NACK_SUPRESSION = "nackSupressionDuration";
+const char* ADAPTIVE_RELIABILITY = "adaptiveReliability";
+const char* MIN_HEARTB_PERIOD = "minHeartbeatPeriod";
 const char* BY_NAME = "durationbyname";
 const char* BY_VAL = "durationbyval";
 const char* DURATION_INFINITY = "DURATION_INFINITY";
@@ -161,6 +170,9 @@ const char* TOPIC_DATA = "topicData";
 const char* GROUP_DATA = "groupData";
 const char* PUB_MODE = "publishMode";
 const char* DISABLE_POSITIVE_ACKS = "disablePositiveAcks";
+const char* BATCH = "batch";
+const char* MAX_DATA_BYTES = "max_data_bytes";
+const char* MAX_FLUSH_DELAY = "max_flush_delay";
 
 const char* SYNCHRONOUS = "SYNCHRONOUS";
 const char* ASYNCHRONOUS = "ASYNCHRONOUS";
@@ -232,6 +244,7 @@ const char* SIMPLE = "SIMPLE";
 const char* STATIC = "STATIC";
 const char* PUBWRITER_SUBREADER = "PUBWRITER_SUBREADER";
 const char* PUBREADER_SUBWRITER = "PUBREADER_SUBWRITER";
+const char* TOPIC_INTEREST_FILTER = "TOPIC_INTEREST_FILTER";
 const char* STATIC_ENDPOINT_XML = "staticEndpointXMLFilename";
 const char* READER_HIST_MEM_POLICY = "readerHistoryMemoryPolicy";
 const char* WRITER_HIST_MEM_POLICY = "writerHistoryMemoryPolicy";
@@ -321,6 +334,12 @@ const char* BASE_TYPE = "baseType";
 const char* USE_DEFAULT = "use_default";
 const char* CONSUMER = "consumer";
 const char* CLASS = "class";
+const char* THREAD_SETTINGS = "thread_settings";
+
+// Thread settings
+const char* THREAD_SCHEDULING_POLICY = "scheduling_policy";
+const char* THREAD_PRIORITY = "priority";
+const char* THREAD_AFFINITY = "affinity";
 
 // Allocation config
 const char* INITIAL = "initial";
@@ -196,6 +196,44 @@ TEST(BlackBox, EDPSlaveReaderAttachment)
     checker.block_until_discover_partition("othertest", 0);
 }
 
+TEST(BlackBox, EDPTopicInterestFilter)
+{
+    std::string other_topic = TEST_TOPIC_NAME + "_other";
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> other_writer(other_topic);
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+
+    writer.topic_interest_filter(true).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    other_writer.topic_interest_filter(true).init();
+
+    ASSERT_TRUE(other_writer.isInitialized());
+
+    // The reader participant is announced before its reader is created, so the endpoint data of the writer
+    // is filtered out at first and has to be sent again once the reader participant shows interest on the topic.
+    reader.topic_interest_filter(true).reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    // Participants only learn about endpoints on topics they have endpoints on.
+    writer.block_until_discover_topic(writer.topic_name(), 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_EQ(writer.get_discovered_topic_count(other_topic), 0);
+    EXPECT_EQ(other_writer.get_discovered_topic_count(writer.topic_name()), 0);
+    EXPECT_EQ(other_writer.get_discovered_topic_count(other_topic), 1);
+}
+
 // Used to detect Github issue #155
 TEST(BlackBox, EndpointRediscovery)
 {
@@ -539,6 +577,63 @@ TEST(Discovery, TwentyParticipants)
     }
 }
 
+//! Tests that resent participant announcements are only notified to the listener when they have changed
+TEST(Discovery, ParticipantAnnouncementChanges)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    std::atomic<unsigned int> changes(0);
+    reader.setOnDiscoveryFunction([&writer, &changes](const ParticipantDiscoveryInfo& info) -> bool{
+            if(info.info.m_guid == writer.participant_guid() &&
+                    info.status == ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT)
+            {
+                ++changes;
+            }
+
+            return false;
+        });
+
+    reader.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // With the topic interest filter, the announcement of the writer participant changes when it creates an
+    // endpoint on a new topic.
+    writer.topic_interest_filter(true).lease_duration({ 10, 0 }, { 0, 300000000 }).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    reader.wait_discovery();
+    writer.wait_discovery();
+
+    // Wait for the announcements sent while the writer was being created.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    changes = 0;
+
+    // Several identical announcements are resent
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    EXPECT_EQ(changes.load(), 0u);
+
+    // A changed announcement
+    SubscriberAttributes sub_attr;
+    sub_attr.topic.topicDataType = HelloWorldType().getName();
+    sub_attr.topic.topicName = TEST_TOPIC_NAME + "_other";
+    Subscriber* other_subscriber = Domain::createSubscriber(writer.getParticipant(), sub_attr);
+    ASSERT_NE(other_subscriber, nullptr);
+
+    for(int i = 0; i < 50 && changes.load() == 0u; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    // Its resends are identical again
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    EXPECT_EQ(changes.load(), 1u);
+
+    Domain::removeSubscriber(other_subscriber);
+}
+
 //! Regression for ROS2 #280 and #281
 TEST(Discovery, TwentyParticipantsSeveralEndpoints)
 {
@@ -124,3 +124,34 @@ TEST(LifespanQos, ShortLifespan)
     EXPECT_EQ(reader.takeNextData(&msg, &info), false);
     EXPECT_EQ(reader.takeNextData(&msg, &info), false);
 }
+
+TEST(LifespanQos, WritesFasterThanLifespan)
+{
+    // This test makes the writer send samples faster than the lifespan,
+    // and checks that the older samples are removed while the writer keeps writing
+
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // Write rate in milliseconds
+    uint32_t writer_sleep_ms = 20;
+    // Number of samples written by writer
+    uint32_t writer_samples = 30;
+    // Lifespan period in milliseconds
+    uint32_t lifespan_ms = 200;
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS)
+            .lifespan_period(lifespan_ms * 1e-3)
+            .init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    auto data = default_helloworld_data_generator(writer_samples);
+    writer.send(data, writer_sleep_ms);
+    ASSERT_TRUE(data.empty());
+
+    // Only the samples written during the last lifespan period should remain in the history
+    size_t removed_pub = 0;
+    writer.remove_all_changes(&removed_pub);
+    EXPECT_GT(removed_pub, 0u);
+    EXPECT_LT(removed_pub, writer_samples / 2);
+}
@@ -111,6 +111,68 @@ TEST(BlackBox, PubSubAsReliableHelloworld)
     reader.block_for_all();
 }
 
+TEST(BlackBox, PubSubAsReliableLoanedHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).take_loans(true).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data using loaned samples of a non plain type
+    writer.send_loaned(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+TEST(BlackBox, PubSubAsReliableLoanedFixedSized)
+{
+    PubSubReader<FixedSizedType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<FixedSizedType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        resource_limits_max_samples(10).resource_limits_allocated_samples(10).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).take_loans(true).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(10).
+        resource_limits_max_samples(10).resource_limits_allocated_samples(10).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_fixed_sized_data_generator();
+
+    reader.startReception(data);
+
+    // Send data using loaned samples placed on the history payloads
+    writer.send_loaned(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
 TEST(BlackBox, AsyncPubSubAsReliableHelloworld)
 {
     PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
@@ -143,6 +205,129 @@ TEST(BlackBox, AsyncPubSubAsReliableHelloworld)
     reader.block_for_all();
 }
 
+TEST(BlackBox, PubSubAsReliableBatchedHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // The last samples do not complete a batch and are sent by the flush.
+    writer.history_depth(100).batch(0, 4).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    writer.flush();
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+TEST(BlackBox, PubSubAsNonReliableBatchedWithFlushDelayHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // The samples are only sent when the flush delay expires.
+    writer.history_depth(100).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+        batch(0, 0, eprosima::fastrtps::Duration_t(0, 100000000)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+TEST(BlackBox, PubSubAsReliableHelloworldBatchTake)
+{
+    // The reader only reads the samples, so they are kept in its history
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME, false);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    auto expected_data = data;
+    uint32_t num_samples = static_cast<uint32_t>(data.size());
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    reader.startReception(expected_data);
+    reader.block_for_all();
+
+    std::vector<HelloWorld> msgs(num_samples);
+    std::vector<void*> samples;
+    for (HelloWorld& msg : msgs)
+    {
+        samples.push_back(&msg);
+    }
+    std::vector<eprosima::fastrtps::SampleInfo_t> infos(num_samples);
+
+    // Every sample was already read
+    EXPECT_EQ(reader.read(samples.data(), infos.data(), num_samples, eprosima::fastrtps::NOT_READ_SAMPLE_STATE), 0u);
+    EXPECT_EQ(reader.read(samples.data(), infos.data(), num_samples), num_samples);
+
+    uint32_t first = reader.take(samples.data(), infos.data(), 4);
+    ASSERT_EQ(first, 4u);
+    uint32_t second = reader.take(&samples[first], &infos[first], num_samples);
+    ASSERT_EQ(first + second, num_samples);
+    EXPECT_EQ(reader.take(samples.data(), infos.data(), num_samples), 0u);
+
+    auto it = expected_data.begin();
+    for (uint32_t i = 0; i < num_samples; ++i, ++it)
+    {
+        EXPECT_EQ(msgs[i], *it);
+        if (i > 0)
+        {
+            EXPECT_LT(infos[i - 1].sample_identity.sequence_number(), infos[i].sample_identity.sequence_number());
+        }
+    }
+}
+
 TEST(BlackBox, ReqRepAsReliableHelloworld)
 {
     ReqRepAsReliableHelloWorldRequester requester;
@@ -258,3 +443,73 @@ TEST(BlackBox, PubSubAsReliableHelloworldMulticastDisabled)
     reader.block_for_all();
 }
 
+
+TEST(BlackBox, PubSubParticipantStatistics)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    PropertyPolicy property_policy;
+    property_policy.properties().emplace_back(Property("fastrtps.statistics", "true"));
+
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.property_policy(property_policy).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Statistics are disabled by default.
+    ParticipantStatistics stats;
+    ASSERT_FALSE(reader.getParticipant()->get_statistics(stats));
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    size_t samples = data.size();
+
+    reader.startReception(data);
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    ASSERT_TRUE(writer.getParticipant()->get_statistics(stats));
+
+    // Builtin endpoints have their entity kind on the highest bits.
+    const WriterStatistics* user_writer = nullptr;
+    for (const WriterStatistics& writer_stats : stats.writers)
+    {
+        if ((writer_stats.guid.entityId.value[3] & 0xC0) == 0)
+        {
+            user_writer = &writer_stats;
+        }
+    }
+
+    ASSERT_NE(user_writer, nullptr);
+    ASSERT_GE(user_writer->data_sent, samples);
+    ASSERT_GT(user_writer->bytes_sent, 0u);
+    ASSERT_GT(user_writer->message_sizes.count, 0u);
+    ASSERT_EQ(user_writer->pool_exhausted, 0u);
+
+    uint64_t datagrams = 0;
+    for (const TransportStatistics& transport_stats : stats.transports)
+    {
+        datagrams += transport_stats.datagrams_sent;
+    }
+    ASSERT_GT(datagrams, 0u);
+
+    // Builtin readers of the writer participant have received the discovery data of the reader.
+    uint64_t builtin_samples = 0;
+    for (const ReaderStatistics& reader_stats : stats.readers)
+    {
+        builtin_samples += reader_stats.samples_received;
+        ASSERT_EQ(reader_stats.reception_latency_us.count, reader_stats.samples_received);
+    }
+    ASSERT_GT(builtin_samples, 0u);
+}
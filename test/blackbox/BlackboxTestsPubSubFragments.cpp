@@ -25,38 +25,56 @@ using namespace eprosima::fastrtps::rtps;
 
 TEST(BlackBox, PubSubAsNonReliableData300kb)
 {
-    // Mutes an expected error
-    Log::SetErrorStringFilter(std::regex("^((?!Big data).)*$"));
-
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
     PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
 
+    reader.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
     writer.reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
 
     ASSERT_TRUE(writer.isInitialized());
 
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
     auto data = default_data300kb_data_generator(1);
     // Send data
     writer.send(data);
-    // In this test data is not sent.
-    ASSERT_FALSE(data.empty());
+    // In this test all data should be sent. The synchronous writer fragments the sample.
+    ASSERT_TRUE(data.empty());
 }
 
 TEST(BlackBox, PubSubAsReliableData300kb)
 {
-    // Mutes an expected error
-    Log::SetErrorStringFilter(std::regex("^((?!Big data).)*$"));
-
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
     PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
 
-    writer.init();
+    reader.history_depth(5).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(5).init();
 
     ASSERT_TRUE(writer.isInitialized());
 
-    auto data = default_data300kb_data_generator(1);
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator(5);
+
+    reader.startReception(data);
+
     // Send data
     writer.send(data);
-    // In this test data is not sent.
-    ASSERT_FALSE(data.empty());
+    // In this test all data should be sent. The synchronous writer fragments the samples.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout. Lost fragments are repaired through NACK_FRAG.
+    reader.block_for_all();
 }
 
 TEST(BlackBox, AsyncPubSubAsNonReliableData300kb)
@@ -19,6 +19,7 @@
 #include "PubSubReader.hpp"
 #include "PubSubWriter.hpp"
 #include "PubSubWriterReader.hpp"
+#include "PubSubParticipant.hpp"
 
 #include <fastrtps/transport/test_UDPv4Transport.h>
 
@@ -232,6 +233,62 @@ TEST(BlackBox, BuiltinAuthenticationPlugin_PKIDH_lossy_conditions)
     reader.wait_discovery();
 }
 
+// Checks several secured participants, all of them started at the same time, authenticate each other and match
+// their endpoints within a bound when handshakes run on the worker pool with pre-generated DH keys.
+// The speedup against inline handshakes is measured by the DiscoveryTest performance test.
+TEST(BlackBox, BuiltinAuthenticationPlugin_PKIDH_time_to_full_match)
+{
+    const unsigned int num_participants = 10;
+    const std::chrono::milliseconds timeout(30000);
+
+    PropertyPolicy property_policy;
+
+    property_policy.properties().emplace_back(Property("dds.sec.auth.plugin",
+        "builtin.PKI-DH"));
+    property_policy.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.identity_ca",
+        "file://" + std::string(certs_path) + "/maincacert.pem"));
+    property_policy.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.identity_certificate",
+        "file://" + std::string(certs_path) + "/mainpubcert.pem"));
+    property_policy.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.private_key",
+        "file://" + std::string(certs_path) + "/mainpubkey.pem"));
+    property_policy.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.preallocated_dh_keys",
+        std::to_string(num_participants)));
+    property_policy.properties().emplace_back(Property("dds.sec.auth.handshake_threads", "2"));
+
+    std::vector<std::unique_ptr<PubSubParticipant<HelloWorldType>>> participants;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < num_participants; ++i)
+    {
+        participants.emplace_back(new PubSubParticipant<HelloWorldType>(1u, 1u, num_participants, num_participants));
+        PubSubParticipant<HelloWorldType>& participant = *participants.back();
+        participant.property_policy(property_policy).
+            pub_topic_name(TEST_TOPIC_NAME).
+            sub_topic_name(TEST_TOPIC_NAME).
+            reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+
+        ASSERT_TRUE(participant.init_participant());
+        ASSERT_TRUE(participant.init_publisher(0u));
+        ASSERT_TRUE(participant.init_subscriber(0u));
+    }
+
+    for (auto& participant : participants)
+    {
+        auto remaining = timeout - std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+        ASSERT_GT(remaining.count(), 0) << "Participants did not fully match within " << timeout.count() << " ms";
+        ASSERT_TRUE(participant->pub_wait_discovery(remaining)) <<
+            "Publishers did not fully match within " << timeout.count() << " ms";
+        ASSERT_TRUE(participant->sub_wait_discovery(remaining)) <<
+            "Subscribers did not fully match within " << timeout.count() << " ms";
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Time to full match of " << num_participants << " secured participants: " <<
+        elapsed.count() << " ms" << std::endl;
+}
+
 TEST(BlackBox, BuiltinAuthenticationAndCryptoPlugin_besteffort_rtps_ok)
 {
     PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
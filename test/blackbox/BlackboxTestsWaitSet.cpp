@@ -0,0 +1,263 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/subscriber/Subscriber.h>
+#include <fastrtps/subscriber/SubscriberListener.h>
+#include <fastrtps/subscriber/WaitSet.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+TEST(WaitSet, WakesUpOnNewData)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+    writer.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    WaitSet waitset;
+    ASSERT_TRUE(waitset.attach(reader.get_native_subscriber(), DATA_AVAILABLE_STATUS));
+
+    bool ret = false;
+    std::vector<WaitSet::ActiveSubscriber> active;
+    std::thread waiting_thread([&]()
+            {
+                ret = waitset.wait(active, Duration_t(10, 0));
+            });
+
+    // Let the thread block on the wait
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto data = default_helloworld_data_generator(1);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    waiting_thread.join();
+
+    ASSERT_TRUE(ret);
+    ASSERT_EQ(active.size(), 1u);
+    EXPECT_EQ(active[0].subscriber, reader.get_native_subscriber());
+    EXPECT_EQ(active[0].statuses, static_cast<uint32_t>(DATA_AVAILABLE_STATUS));
+}
+
+TEST(WaitSet, Timeout)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+
+    reader.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    WaitSet waitset;
+    ASSERT_TRUE(waitset.attach(reader.get_native_subscriber(), DATA_AVAILABLE_STATUS));
+
+    std::vector<WaitSet::ActiveSubscriber> active;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(waitset.wait(active, Duration_t(0, 200000000)));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(active.empty());
+    EXPECT_GE(elapsed, std::chrono::milliseconds(200));
+}
+
+TEST(WaitSet, DetachWhileWaiting)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+    writer.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    WaitSet waitset;
+    ASSERT_TRUE(waitset.attach(reader.get_native_subscriber(), DATA_AVAILABLE_STATUS));
+
+    bool ret = true;
+    std::vector<WaitSet::ActiveSubscriber> active;
+    std::thread waiting_thread([&]()
+            {
+                ret = waitset.wait(active, Duration_t(1, 0));
+            });
+
+    // Let the thread block on the wait
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ASSERT_TRUE(waitset.detach(reader.get_native_subscriber()));
+    EXPECT_FALSE(waitset.detach(reader.get_native_subscriber()));
+
+    // Data on a detached subscriber should not wake up the wait
+    auto data = default_helloworld_data_generator(1);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    waiting_thread.join();
+
+    EXPECT_FALSE(ret);
+    EXPECT_TRUE(active.empty());
+}
+
+TEST(WaitSet, SubscriberRemovedWhileWaiting)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+
+    reader.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    WaitSet waitset;
+    ASSERT_TRUE(waitset.attach(reader.get_native_subscriber()));
+
+    bool ret = true;
+    std::vector<WaitSet::ActiveSubscriber> active;
+    std::thread waiting_thread([&]()
+            {
+                ret = waitset.wait(active, Duration_t(1, 0));
+            });
+
+    // Let the thread block on the wait
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The subscriber detaches itself, and the wait keeps blocking on the remaining ones
+    reader.destroy_subscriber();
+
+    waiting_thread.join();
+
+    EXPECT_FALSE(ret);
+    EXPECT_TRUE(active.empty());
+}
+
+TEST(WaitSet, DetachFromListener)
+{
+    class DetachingListener : public SubscriberListener
+    {
+        public:
+
+            DetachingListener(
+                    WaitSet& waitset)
+                : waitset_(waitset)
+                , matched_(false)
+                , detached_(false)
+            {
+            }
+
+            void onNewDataMessage(
+                    Subscriber* sub) override
+            {
+                // Called with the reader mutex taken
+                bool detached = waitset_.detach(sub);
+                std::lock_guard<std::mutex> guard(mutex_);
+                detached_ = detached_ || detached;
+                cv_.notify_all();
+            }
+
+            void onSubscriptionMatched(
+                    Subscriber*,
+                    rtps::MatchingInfo& info) override
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                matched_ = info.status == rtps::MATCHED_MATCHING;
+                cv_.notify_all();
+            }
+
+            bool wait_matched()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                return cv_.wait_for(lock, std::chrono::seconds(10), [this]()
+                        {
+                            return matched_;
+                        });
+            }
+
+            bool wait_detached()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                return cv_.wait_for(lock, std::chrono::seconds(10), [this]()
+                        {
+                            return detached_;
+                        });
+            }
+
+        private:
+
+            WaitSet& waitset_;
+            std::mutex mutex_;
+            std::condition_variable cv_;
+            bool matched_;
+            bool detached_;
+    };
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.init();
+    writer.reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    WaitSet waitset;
+    DetachingListener listener(waitset);
+
+    SubscriberAttributes sub_attr;
+    sub_attr.topic.topicDataType = HelloWorldType().getName();
+    sub_attr.topic.topicName = TEST_TOPIC_NAME;
+    Subscriber* subscriber = Domain::createSubscriber(reader.getParticipant(), sub_attr, &listener);
+    ASSERT_NE(subscriber, nullptr);
+    ASSERT_TRUE(listener.wait_matched());
+
+    ASSERT_TRUE(waitset.attach(subscriber));
+
+    std::vector<WaitSet::ActiveSubscriber> active;
+    std::thread waiting_thread([&]()
+            {
+                // Keeps checking the subscriber until it is detached and the wait times out
+                while (waitset.wait(active, Duration_t(0, 100000000)))
+                {
+                }
+            });
+
+    auto data = default_helloworld_data_generator(1);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    // Detaching from the listener must not wait for the wait thread
+    EXPECT_TRUE(listener.wait_detached());
+
+    waiting_thread.join();
+    EXPECT_TRUE(Domain::removeSubscriber(subscriber));
+}
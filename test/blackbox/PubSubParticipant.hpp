@@ -242,40 +242,46 @@ public:
         publishers_[index]->assert_liveliness();
     }
 
-    void pub_wait_discovery(std::chrono::seconds timeout = std::chrono::seconds::zero())
+    bool pub_wait_discovery(std::chrono::milliseconds timeout = std::chrono::milliseconds::zero())
     {
         std::unique_lock<std::mutex> lock(pub_mutex_);
 
         std::cout << "Publisher is waiting discovery..." << std::endl;
 
-        if(timeout == std::chrono::seconds::zero())
+        bool ret = true;
+
+        if(timeout == std::chrono::milliseconds::zero())
         {
             pub_cv_.wait(lock, [&](){ return pub_matched_ == num_expected_publishers_; });
         }
         else
         {
-            pub_cv_.wait_for(lock, timeout, [&](){return pub_matched_ == num_expected_publishers_;});
+            ret = pub_cv_.wait_for(lock, timeout, [&](){return pub_matched_ == num_expected_publishers_;});
         }
 
         std::cout << "Publisher discovery finished " << std::endl;
+        return ret;
     }
 
-    void sub_wait_discovery(std::chrono::seconds timeout = std::chrono::seconds::zero())
+    bool sub_wait_discovery(std::chrono::milliseconds timeout = std::chrono::milliseconds::zero())
     {
         std::unique_lock<std::mutex> lock(sub_mutex_);
 
         std::cout << "Subscriber is waiting discovery..." << std::endl;
 
-        if(timeout == std::chrono::seconds::zero())
+        bool ret = true;
+
+        if(timeout == std::chrono::milliseconds::zero())
         {
             sub_cv_.wait(lock, [&](){ return sub_matched_ == num_expected_subscribers_; });
         }
         else
         {
-            sub_cv_.wait_for(lock, timeout, [&](){return sub_matched_ == num_expected_subscribers_;});
+            ret = sub_cv_.wait_for(lock, timeout, [&](){return sub_matched_ == num_expected_subscribers_;});
         }
 
         std::cout << "Subscriber discovery finished " << std::endl;
+        return ret;
     }
 
     void pub_wait_liveliness_lost(unsigned int times = 1)
@@ -296,6 +302,12 @@ public:
         sub_liveliness_cv_.wait(lock, [&]() { return sub_times_liveliness_lost_ == num_lost;  });
     }
 
+    PubSubParticipant& property_policy(const eprosima::fastrtps::rtps::PropertyPolicy property_policy)
+    {
+        participant_attr_.rtps.properties = property_policy;
+        return *this;
+    }
+
     PubSubParticipant& pub_topic_name(std::string topicName)
     {
         publisher_attr_.topic.topicDataType = type_.getName();
@@ -219,6 +219,7 @@ public:
         , discovery_result_(false)
         , onDiscovery_(nullptr)
         , take_(take)
+        , loan_(false)
 #if HAVE_SECURITY
         , authorized_(0)
         , unauthorized_(0)
@@ -274,6 +275,25 @@ public:
 
     bool isInitialized() const { return initialized_; }
 
+    eprosima::fastrtps::Participant* getParticipant()
+    {
+        return participant_;
+    }
+
+    eprosima::fastrtps::Subscriber* get_native_subscriber() const
+    {
+        return subscriber_;
+    }
+
+    void destroy_subscriber()
+    {
+        if(subscriber_ != nullptr)
+        {
+            eprosima::fastrtps::Domain::removeSubscriber(subscriber_);
+            subscriber_ = nullptr;
+        }
+    }
+
     void destroy()
     {
         if(participant_ != nullptr)
@@ -533,6 +553,12 @@ public:
         return *this;
     }
 
+    PubSubReader& take_loans(bool loan)
+    {
+        loan_ = loan;
+        return *this;
+    }
+
     PubSubReader& expect_no_allocs()
     {
         // TODO(Mcc): Add no allocations check code when feature is completely ready
@@ -693,6 +719,12 @@ public:
         return *this;
     }
 
+    PubSubReader& topic_interest_filter(bool enabled)
+    {
+        participant_attr_.rtps.builtin.discovery_config.m_simpleEDP.use_topic_interest_filter = enabled;
+        return *this;
+    }
+
     PubSubReader& load_participant_attr(const std::string& xml)
     {
         std::unique_ptr<eprosima::fastrtps::xmlparser::BaseNode> root;
@@ -775,6 +807,28 @@ public:
         return false;
     }
 
+    uint32_t read(
+            void** samples,
+            eprosima::fastrtps::SampleInfo_t* infos,
+            uint32_t max_samples,
+            uint32_t sample_states = eprosima::fastrtps::ANY_SAMPLE_STATE)
+    {
+        return subscriber_->read(samples, infos, max_samples, eprosima::fastrtps::rtps::c_InstanceHandle_Unknown,
+                sample_states);
+    }
+
+    uint32_t take(
+            void** samples,
+            eprosima::fastrtps::SampleInfo_t* infos,
+            uint32_t max_samples,
+            uint32_t sample_states = eprosima::fastrtps::ANY_SAMPLE_STATE)
+    {
+        uint32_t count = subscriber_->take(samples, infos, max_samples,
+                eprosima::fastrtps::rtps::c_InstanceHandle_Unknown, sample_states);
+        current_received_count_ += count;
+        return count;
+    }
+
     unsigned int missed_deadlines() const
     {
         return listener_.missed_deadlines();
@@ -842,9 +896,25 @@ private:
         type data;
         eprosima::fastrtps::SampleInfo_t info;
 
-        bool success = take_ ?
+        bool success = false;
+        if (loan_)
+        {
+            const void* sample = nullptr;
+            success = subscriber->take_loan(sample, &info);
+            if (success)
+            {
+                data = *static_cast<const type*>(sample);
+                ASSERT_TRUE(subscriber->return_loan(sample));
+                ASSERT_EQ(sample, nullptr);
+            }
+        }
+        else
+        {
+            success = take_ ?
                     subscriber->takeNextData((void*)&data, &info) :
                     subscriber->readNextData((void*)&data, &info);
+        }
+
         if (success)
         {
             returnedValue = true;
@@ -941,6 +1011,9 @@ private:
     //! True to take data from history. False to read
     bool take_;
 
+    //! True to take data using loans
+    bool loan_;
+
 #if HAVE_SECURITY
     std::mutex mutexAuthentication_;
     std::condition_variable cvAuthentication_;
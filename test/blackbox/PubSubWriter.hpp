@@ -318,6 +318,29 @@ class PubSubWriter
         }
     }
 
+    void send_loaned(std::list<type>& msgs)
+    {
+        auto it = msgs.begin();
+
+        while(it != msgs.end())
+        {
+            void* sample = nullptr;
+            if(!publisher_->loan_sample(sample))
+            {
+                break;
+            }
+
+            *static_cast<type*>(sample) = *it;
+            if(publisher_->write(sample))
+            {
+                default_send_print<type>(*it);
+                it = msgs.erase(it);
+            }
+            else
+                break;
+        }
+    }
+
     bool send_sample(type& msg)
     {
         return publisher_->write((void*)&msg);
@@ -413,6 +436,11 @@ class PubSubWriter
                 return publisher_->wait_for_all_acked(eprosima::fastrtps::Time_t((int32_t)max_wait.count(), 0));
             }
 
+    void flush()
+    {
+        publisher_->flush();
+    }
+
     void block_until_discover_topic(const std::string& topicName, int repeatedTimes)
     {
         std::unique_lock<std::mutex> lock(mutexEntitiesInfoList_);
@@ -424,6 +452,12 @@ class PubSubWriter
                 });
     }
 
+    int get_discovered_topic_count(const std::string& topicName)
+    {
+        std::unique_lock<std::mutex> lock(mutexEntitiesInfoList_);
+        return mapTopicCountList_.count(topicName) == 0 ? 0 : mapTopicCountList_[topicName];
+    }
+
     void block_until_discover_partition(const std::string& partition, int repeatedTimes)
     {
         std::unique_lock<std::mutex> lock(mutexEntitiesInfoList_);
@@ -508,6 +542,18 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& batch(
+            uint32_t max_data_bytes,
+            uint32_t max_samples,
+            const eprosima::fastrtps::Duration_t& max_flush_delay = eprosima::fastrtps::c_TimeInfinite)
+    {
+        publisher_attr_.qos.m_batch.enabled = true;
+        publisher_attr_.qos.m_batch.max_data_bytes = max_data_bytes;
+        publisher_attr_.qos.m_batch.max_samples = max_samples;
+        publisher_attr_.qos.m_batch.max_flush_delay = max_flush_delay;
+        return *this;
+    }
+
     PubSubWriter& history_kind(const eprosima::fastrtps::HistoryQosPolicyKind kind)
     {
         publisher_attr_.topic.historyQos.kind = kind;
@@ -719,6 +765,12 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& topic_interest_filter(bool enabled)
+    {
+        participant_attr_.rtps.builtin.discovery_config.m_simpleEDP.use_topic_interest_filter = enabled;
+        return *this;
+    }
+
     PubSubWriter& load_participant_attr(const std::string& xml)
     {
         std::unique_ptr<eprosima::fastrtps::xmlparser::BaseNode> root;
@@ -20,6 +20,8 @@
 #include <memory>
 #include <gmock/gmock.h>
 
+#include <fastrtps/rtps/attributes/ThreadSettings.hpp>
+
 /**
  * eProsima log mock.
  */
@@ -59,6 +61,8 @@ class Log
 
         static std::function<void()> ClearConsumersFunc;
         static void ClearConsumers() { ClearConsumersFunc(); }
+
+        static void SetThreadSettings(const rtps::ThreadSettings&) {}
 };
 
 using ::testing::_;
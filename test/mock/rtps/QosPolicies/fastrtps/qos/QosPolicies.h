@@ -757,6 +757,28 @@ class PublishModeQosPolicy : public QosPolicy {
         }
 };
 
+/**
+ * Class BatchQosPolicy, groups consecutive samples of a writer so they are sent together in the same messages.
+ * enabled: Default value false.
+ */
+class BatchQosPolicy : public QosPolicy {
+    public:
+        bool enabled;
+        uint32_t max_data_bytes;
+        uint32_t max_samples;
+        Duration_t max_flush_delay;
+        RTPS_DllAPI BatchQosPolicy() : enabled(false), max_data_bytes(32768), max_samples(0),
+            max_flush_delay(c_TimeInfinite){};
+        virtual RTPS_DllAPI ~BatchQosPolicy(){};
+        bool operator == (const BatchQosPolicy& other) const
+        {
+            return other.enabled == enabled &&
+                other.max_data_bytes == max_data_bytes &&
+                other.max_samples == max_samples &&
+                other.max_flush_delay == max_flush_delay;
+        }
+};
+
 /**
 * Enum DataRepresentationId, different kinds of topic data representation
 */
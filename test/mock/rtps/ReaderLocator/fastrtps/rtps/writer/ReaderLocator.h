@@ -28,6 +28,7 @@
 #include <fastrtps/rtps/common/SequenceNumber.h>
 #include <fastrtps/rtps/messages/RTPSMessageGroup.h>
 #include <fastrtps/rtps/common/LocatorSelectorEntry.hpp>
+#include <fastrtps/rtps/writer/TimeBasedFilter.h>
 
 
 namespace eprosima {
@@ -66,6 +67,11 @@ class ReaderLocator : public RTPSMessageSenderInterface
             return nullptr;
         }
 
+        TimeBasedFilter& time_based_filter()
+        {
+            return time_based_filter_;
+        }
+
         /**
          * Try to start using this object for a new matched reader.
          *
@@ -172,6 +178,7 @@ class ReaderLocator : public RTPSMessageSenderInterface
     private:
 
         GUID_t remote_guid_;
+        TimeBasedFilter time_based_filter_;
         std::vector<GuidPrefix_t> guid_prefix_as_vector_;
         std::vector<GUID_t> guid_as_vector_;
 };
@@ -21,6 +21,7 @@
 
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
+#include <fastrtps/rtps/writer/IReaderDataFilter.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -52,6 +53,10 @@ class StatefulWriter : public RTPSWriter
 
         SequenceNumber_t get_seq_num_min() { return SequenceNumber_t(0, 0); }
 
+        const IReaderDataFilter* reader_data_filter() const { return nullptr; }
+
+        uint32_t max_instances() const { return 0; }
+
     private:
 
         friend class ReaderProxy;
@@ -165,6 +165,11 @@ typedef struct TCPTransportDescriptor : public SocketTransportDescriptor
 
     TLSConfig tls_config;
 
+    //! Settings of the thread accepting and connecting the TCP sockets.
+    ThreadSettings accept_thread;
+    //! Settings of the thread sending the keep alive requests.
+    ThreadSettings keep_alive_thread;
+
     void add_listener_port(uint16_t port)
     {
         listening_ports.push_back(port);
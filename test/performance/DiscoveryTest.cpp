@@ -0,0 +1,514 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryTest.cpp
+ *
+ */
+
+#include "DiscoveryTest.h"
+
+#include <fastrtps/log/Log.h>
+#include <fastrtps/rtps/messages/RTPS_messages.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using std::cout;
+using std::endl;
+
+// Guid prefix of the server used on DiscoveryKind::SERVER runs.
+static const char* c_server_prefix = "44.49.53.43.4f.56.45.52.59.00.00.01";
+
+namespace {
+
+//! Process CPU time (user + system) in milliseconds.
+double process_cpu_ms()
+{
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    {
+        return 0.0;
+    }
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    // FILETIME is expressed in 100 ns units.
+    return static_cast<double>(k.QuadPart + u.QuadPart) / 10000.0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0.0;
+    }
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+#endif
+}
+
+//! Resident set size of the process in bytes. Zero when it cannot be obtained.
+uint64_t process_rss_bytes()
+{
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0;
+    uint64_t resident = 0;
+    if (statm >> size >> resident)
+    {
+        return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+} // namespace
+
+#if !defined(_WIN32)
+TransportInterface* CountingUDPv4TransportDescriptor::create_transport() const
+{
+    return new CountingUDPv4Transport(*this);
+}
+
+bool CountingUDPv4Transport::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        eProsimaUDPSocket& socket,
+        const Locator_t& remote_locator,
+        bool only_multicast_purpose,
+        const std::chrono::microseconds& timeout)
+{
+    std::atomic<uint64_t>* counter = &traffic_->other_bytes;
+
+    // Classify the datagram with the writer of its first submessage that carries one.
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+    while (pos + 4 <= send_buffer_size)
+    {
+        octet id = send_buffer[pos];
+        bool little_endian = (send_buffer[pos + 1] & 0x01) != 0;
+        uint16_t length = little_endian ?
+                static_cast<uint16_t>(send_buffer[pos + 2] | (send_buffer[pos + 3] << 8)) :
+                static_cast<uint16_t>((send_buffer[pos + 2] << 8) | send_buffer[pos + 3]);
+        pos += 4;
+
+        uint32_t writer_id_offset = 0;
+        switch (id)
+        {
+            // Offsets are relative to the end of the submessage header.
+            case DATA:
+            case DATA_FRAG:
+                // extraFlags, octetsToInlineQos and readerId come first.
+                writer_id_offset = 8;
+                break;
+            case HEARTBEAT:
+            case ACKNACK:
+            case GAP:
+                // readerId comes first.
+                writer_id_offset = 4;
+                break;
+            default:
+                break;
+        }
+
+        if (writer_id_offset != 0 && pos + writer_id_offset + 4 <= send_buffer_size)
+        {
+            EntityId_t writer_id;
+            memcpy(writer_id.value, &send_buffer[pos + writer_id_offset], 4);
+            if (writer_id == c_EntityId_SPDPWriter)
+            {
+                counter = &traffic_->pdp_bytes;
+            }
+            else if (writer_id == c_EntityId_SEDPPubWriter || writer_id == c_EntityId_SEDPSubWriter)
+            {
+                counter = &traffic_->edp_bytes;
+            }
+            break;
+        }
+
+        if (length == 0)
+        {
+            break;
+        }
+        pos += length;
+    }
+
+    *counter += send_buffer_size;
+
+    return UDPv4Transport::send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose,
+            timeout);
+}
+#endif
+
+DiscoveryTest::DiscoveryTest()
+    : n_participants_(0)
+    , n_endpoints_(0)
+    , kind_(DiscoveryKind::SIMPLE)
+    , pid_(0)
+    , timeout_seconds_(60)
+    , export_csv_(false)
+    , time_to_match_(0)
+    , cpu_ms_per_participant_(0)
+    , bytes_per_remote_proxy_(0)
+    , pdp_bytes_(0)
+    , edp_bytes_(0)
+    , traffic_available_(false)
+    , matched_count_(0)
+    , expected_matches_(0)
+    , listener_(this)
+{
+}
+
+DiscoveryTest::~DiscoveryTest()
+{
+    for (Participant* participant : participants_)
+    {
+        Domain::removeParticipant(participant);
+    }
+    participants_.clear();
+
+    if (!static_xml_file_.empty())
+    {
+        std::remove(static_xml_file_.c_str());
+    }
+}
+
+bool DiscoveryTest::init(
+        int n_participants,
+        int n_endpoints,
+        DiscoveryKind kind,
+        uint32_t pid,
+        int timeout_seconds,
+        bool export_csv,
+        const std::string& export_prefix)
+{
+    n_participants_ = n_participants;
+    n_endpoints_ = n_endpoints;
+    kind_ = kind;
+    pid_ = pid;
+    timeout_seconds_ = timeout_seconds;
+    export_csv_ = export_csv;
+    export_prefix_ = export_prefix;
+
+    if (n_participants_ <= 0 || n_endpoints_ <= 0)
+    {
+        cout << "At least one participant with one endpoint is needed" << endl;
+        return false;
+    }
+
+    // Every endpoint matches the opposite endpoint on its topic on every participant, including its own.
+    expected_matches_ = 2 * n_endpoints_ * n_participants_ * n_participants_;
+
+    if (kind_ == DiscoveryKind::STATIC)
+    {
+        // Static endpoint ids are unique on the whole XML file and have to fit on an octet.
+        if (2 * n_endpoints_ * n_participants_ > 254)
+        {
+            cout << "Static discovery supports up to 254 endpoints in total" << endl;
+            return false;
+        }
+
+        return write_static_xml();
+    }
+
+    return true;
+}
+
+bool DiscoveryTest::run()
+{
+    double cpu_start = process_cpu_ms();
+    uint64_t rss_start = process_rss_bytes();
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < n_participants_; ++i)
+    {
+        if (!create_participant(i))
+        {
+            cout << "Error creating participant " << i << endl;
+            return false;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_for(lock, std::chrono::seconds(timeout_seconds_), [this]()
+                {
+                    return matched_count_ >= expected_matches_;
+                }))
+        {
+            cout << "Timeout waiting for discovery: " << matched_count_ << " of " << expected_matches_ <<
+                " matches" << endl;
+            return false;
+        }
+    }
+
+    time_to_match_ = std::chrono::steady_clock::now() - t_start;
+    cpu_ms_per_participant_ = (process_cpu_ms() - cpu_start) / n_participants_;
+
+    // Each participant holds a proxy for every other participant and for each of their endpoints.
+    uint64_t rss_end = process_rss_bytes();
+    uint64_t remote_proxies = static_cast<uint64_t>(n_participants_) * (n_participants_ - 1) *
+            (1 + 2 * n_endpoints_);
+    if (remote_proxies > 0 && rss_end > rss_start)
+    {
+        bytes_per_remote_proxy_ = static_cast<double>(rss_end - rss_start) / remote_proxies;
+    }
+
+    pdp_bytes_ = traffic_.pdp_bytes;
+    edp_bytes_ = traffic_.edp_bytes;
+
+    // Discovery cannot have finished without traffic, so no bytes means datagrams are being misclassified.
+    if (traffic_available_ && (pdp_bytes_ == 0 || (kind_ != DiscoveryKind::STATIC && n_endpoints_ > 0 &&
+            edp_bytes_ == 0)))
+    {
+        cout << "Discovery traffic not classified: " << pdp_bytes_ << " PDP bytes, " << edp_bytes_ <<
+            " EDP bytes" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+void DiscoveryTest::export_results()
+{
+    const char* kind_names[] = { "simple", "server", "static" };
+    const char* kind_name = kind_names[static_cast<int>(kind_)];
+
+    std::ostringstream header;
+    std::ostringstream values;
+    header << "\"Participants\",\"Endpoints per participant\",\"Time to full match (ms)\","
+           << "\"CPU per participant (ms)\",\"Memory per remote proxy (bytes)\",\"PDP bytes sent\",\"EDP bytes sent\"";
+    values << n_participants_ << "," << n_endpoints_ << "," << time_to_match_.count() << ","
+           << cpu_ms_per_participant_ << "," << bytes_per_remote_proxy_ << ",";
+    if (traffic_available_)
+    {
+        values << pdp_bytes_ << "," << edp_bytes_;
+    }
+    else
+    {
+        values << ",";
+    }
+
+    cout << "Discovery (" << kind_name << "): " << n_participants_ << " participants with " << n_endpoints_ <<
+        " publishers and subscribers each" << endl;
+    cout << "    Time to full match:      " << time_to_match_.count() << " ms" << endl;
+    cout << "    CPU per participant:     " << cpu_ms_per_participant_ << " ms" << endl;
+    cout << "    Memory per remote proxy: " << bytes_per_remote_proxy_ << " bytes" << endl;
+    if (traffic_available_)
+    {
+        cout << "    PDP bytes sent:          " << pdp_bytes_ << endl;
+        cout << "    EDP bytes sent:          " << edp_bytes_ << endl;
+    }
+
+    if (export_csv_)
+    {
+        std::string prefix = export_prefix_;
+        if (prefix.length() == 0)
+        {
+            prefix = "perf_DiscoveryTest";
+        }
+
+        std::ofstream outFile;
+        outFile.open(prefix + "_" + kind_name + ".csv");
+        outFile << header.str() << endl << values.str() << endl;
+        outFile.close();
+    }
+}
+
+bool DiscoveryTest::create_participant(
+        int index)
+{
+    ParticipantAttributes PParam;
+    PParam.rtps.builtin.domainId = pid_ % 230;
+    PParam.rtps.setName(participant_name(index).c_str());
+    PParam.rtps.properties = participant_properties_;
+
+#if !defined(_WIN32)
+    PParam.rtps.useBuiltinTransports = false;
+    PParam.rtps.userTransports.push_back(std::make_shared<CountingUDPv4TransportDescriptor>(&traffic_));
+    traffic_available_ = true;
+#endif
+
+    DiscoverySettings& discovery = PParam.rtps.builtin.discovery_config;
+    Locator_t server_locator;
+    IPLocator::setIPv4(server_locator, 127, 0, 0, 1);
+    server_locator.port = static_cast<uint16_t>(10000 + pid_ % 20000);
+
+    switch (kind_)
+    {
+        case DiscoveryKind::SERVER:
+            if (index == 0)
+            {
+                discovery.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+                PParam.rtps.ReadguidPrefix(c_server_prefix);
+                PParam.rtps.builtin.metatrafficUnicastLocatorList.push_back(server_locator);
+            }
+            else
+            {
+                discovery.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+                RemoteServerAttributes server;
+                server.ReadguidPrefix(c_server_prefix);
+                server.metatrafficUnicastLocatorList.push_back(server_locator);
+                discovery.m_DiscoveryServers.push_back(server);
+            }
+            break;
+        case DiscoveryKind::STATIC:
+            discovery.use_SIMPLE_EndpointDiscoveryProtocol = false;
+            discovery.use_STATIC_EndpointDiscoveryProtocol = true;
+            discovery.setStaticEndpointXMLFilename(static_xml_file_.c_str());
+            break;
+        default:
+            break;
+    }
+
+    Participant* participant = Domain::createParticipant(PParam);
+    if (participant == nullptr)
+    {
+        return false;
+    }
+    participants_.push_back(participant);
+
+    Domain::registerType(participant, &type_);
+
+    for (int e = 0; e < n_endpoints_; ++e)
+    {
+        PublisherAttributes PubParam;
+        PubParam.topic.topicDataType = type_.getName();
+        PubParam.topic.topicKind = NO_KEY;
+        PubParam.topic.topicName = topic_name(e);
+        PubParam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        PubParam.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+
+        SubscriberAttributes SubParam;
+        SubParam.topic.topicDataType = type_.getName();
+        SubParam.topic.topicKind = NO_KEY;
+        SubParam.topic.topicName = topic_name(e);
+        SubParam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        SubParam.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+
+        if (kind_ == DiscoveryKind::STATIC)
+        {
+            uint8_t writer_id = static_cast<uint8_t>(2 * (index * n_endpoints_ + e) + 1);
+            uint8_t reader_id = static_cast<uint8_t>(writer_id + 1);
+            PubParam.setUserDefinedID(writer_id);
+            PubParam.setEntityID(writer_id);
+            SubParam.setUserDefinedID(reader_id);
+            SubParam.setEntityID(reader_id);
+        }
+
+        if (Domain::createPublisher(participant, PubParam, &listener_) == nullptr ||
+                Domain::createSubscriber(participant, SubParam, &listener_) == nullptr)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DiscoveryTest::write_static_xml()
+{
+    std::ostringstream file_name;
+    file_name << "DiscoveryTest_" << pid_ << "_static.xml";
+    static_xml_file_ = file_name.str();
+
+    std::ofstream xml(static_xml_file_);
+    if (!xml.is_open())
+    {
+        cout << "Cannot create " << static_xml_file_ << endl;
+        static_xml_file_.clear();
+        return false;
+    }
+
+    xml << "<staticdiscovery>" << endl;
+    for (int p = 0; p < n_participants_; ++p)
+    {
+        xml << "    <participant>" << endl;
+        xml << "        <name>" << participant_name(p) << "</name>" << endl;
+        for (int e = 0; e < n_endpoints_; ++e)
+        {
+            int writer_id = 2 * (p * n_endpoints_ + e) + 1;
+            const char* endpoint_tags[] = { "writer", "reader" };
+            for (int r = 0; r < 2; ++r)
+            {
+                xml << "        <" << endpoint_tags[r] << ">" << endl;
+                xml << "            <userId>" << writer_id + r << "</userId>" << endl;
+                xml << "            <entityID>" << writer_id + r << "</entityID>" << endl;
+                xml << "            <topicName>" << topic_name(e) << "</topicName>" << endl;
+                xml << "            <topicDataType>" << type_.getName() << "</topicDataType>" << endl;
+                xml << "            <topicKind>NO_KEY</topicKind>" << endl;
+                xml << "            <reliabilityQos>RELIABLE_RELIABILITY_QOS</reliabilityQos>" << endl;
+                xml << "            <durabilityQos>VOLATILE_DURABILITY_QOS</durabilityQos>" << endl;
+                xml << "        </" << endpoint_tags[r] << ">" << endl;
+            }
+        }
+        xml << "    </participant>" << endl;
+    }
+    xml << "</staticdiscovery>" << endl;
+
+    return true;
+}
+
+std::string DiscoveryTest::topic_name(
+        int endpoint) const
+{
+    std::ostringstream name;
+    name << "DiscoveryTest_" << pid_ << "_" << endpoint;
+    return name.str();
+}
+
+std::string DiscoveryTest::participant_name(
+        int index) const
+{
+    std::ostringstream name;
+    name << "DiscoveryTest_" << pid_ << "_participant_" << index;
+    return name.str();
+}
+
+void DiscoveryTest::matched(
+        bool matching)
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        matched_count_ += matching ? 1 : -1;
+    }
+    cv_.notify_one();
+}
+
+void DiscoveryTest::MatchListener::onPublicationMatched(
+        Publisher* /*pub*/,
+        MatchingInfo& info)
+{
+    test_->matched(info.status == MATCHED_MATCHING);
+}
+
+void DiscoveryTest::MatchListener::onSubscriptionMatched(
+        Subscriber* /*sub*/,
+        MatchingInfo& info)
+{
+    test_->matched(info.status == MATCHED_MATCHING);
+}
@@ -0,0 +1,202 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryTest.h
+ *
+ */
+
+#ifndef DISCOVERYTEST_H_
+#define DISCOVERYTEST_H_
+
+#include "LatencyTestTypes.h"
+
+#include <fastrtps/rtps/attributes/PropertyPolicy.h>
+#include <fastrtps/transport/UDPv4Transport.h>
+#include <fastrtps/transport/UDPv4TransportDescriptor.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class DiscoveryKind
+{
+    SIMPLE,
+    SERVER,
+    STATIC
+};
+
+/**
+ * Bytes sent by every participant of the test, classified by the builtin writer that sent them.
+ */
+struct DiscoveryTraffic
+{
+    DiscoveryTraffic()
+        : pdp_bytes(0)
+        , edp_bytes(0)
+        , other_bytes(0)
+    {
+    }
+
+    std::atomic<uint64_t> pdp_bytes;
+    std::atomic<uint64_t> edp_bytes;
+    std::atomic<uint64_t> other_bytes;
+};
+
+#if !defined(_WIN32)
+/**
+ * UDPv4 transport that accounts every datagram it sends on a DiscoveryTraffic object.
+ * Only available where UDPTransportInterface can be derived outside the library.
+ */
+class CountingUDPv4TransportDescriptor : public eprosima::fastrtps::rtps::UDPv4TransportDescriptor
+{
+    public:
+
+        CountingUDPv4TransportDescriptor(
+                DiscoveryTraffic* traffic)
+            : traffic_(traffic)
+        {
+        }
+
+        virtual ~CountingUDPv4TransportDescriptor() {}
+
+        virtual eprosima::fastrtps::rtps::TransportInterface* create_transport() const override;
+
+        DiscoveryTraffic* traffic_;
+};
+
+class CountingUDPv4Transport : public eprosima::fastrtps::rtps::UDPv4Transport
+{
+    public:
+
+        CountingUDPv4Transport(
+                const CountingUDPv4TransportDescriptor& descriptor)
+            : UDPv4Transport(descriptor)
+            , traffic_(descriptor.traffic_)
+        {
+        }
+
+        virtual bool send(
+                const eprosima::fastrtps::rtps::octet* send_buffer,
+                uint32_t send_buffer_size,
+                eprosima::fastrtps::rtps::eProsimaUDPSocket& socket,
+                const eprosima::fastrtps::rtps::Locator_t& remote_locator,
+                bool only_multicast_purpose,
+                const std::chrono::microseconds& timeout) override;
+
+    private:
+
+        DiscoveryTraffic* traffic_;
+};
+#endif
+
+class DiscoveryTest
+{
+    public:
+
+        DiscoveryTest();
+
+        virtual ~DiscoveryTest();
+
+        bool init(
+                int n_participants,
+                int n_endpoints,
+                DiscoveryKind kind,
+                uint32_t pid,
+                int timeout_seconds,
+                bool export_csv,
+                const std::string& export_prefix);
+
+        /**
+         * Create every participant and endpoint, and wait for all the endpoints to match.
+         * @return false if some entity could not be created or the timeout expired.
+         */
+        bool run();
+
+        void export_results();
+
+        int n_participants_;
+        int n_endpoints_;
+        DiscoveryKind kind_;
+        uint32_t pid_;
+        int timeout_seconds_;
+        bool export_csv_;
+        std::string export_prefix_;
+        //! Properties of every participant, e.g. to enable security.
+        eprosima::fastrtps::rtps::PropertyPolicy participant_properties_;
+
+        // Results
+        std::chrono::duration<double, std::milli> time_to_match_;
+        double cpu_ms_per_participant_;
+        double bytes_per_remote_proxy_;
+        uint64_t pdp_bytes_;
+        uint64_t edp_bytes_;
+        bool traffic_available_;
+
+    private:
+
+        class MatchListener : public eprosima::fastrtps::PublisherListener,
+                              public eprosima::fastrtps::SubscriberListener
+        {
+            public:
+
+                MatchListener(
+                        DiscoveryTest* test)
+                    : test_(test)
+                {
+                }
+
+                void onPublicationMatched(
+                        eprosima::fastrtps::Publisher* pub,
+                        eprosima::fastrtps::rtps::MatchingInfo& info) override;
+
+                void onSubscriptionMatched(
+                        eprosima::fastrtps::Subscriber* sub,
+                        eprosima::fastrtps::rtps::MatchingInfo& info) override;
+
+            private:
+
+                DiscoveryTest* test_;
+        };
+
+        bool create_participant(
+                int index);
+
+        bool write_static_xml();
+
+        std::string topic_name(
+                int endpoint) const;
+
+        std::string participant_name(
+                int index) const;
+
+        void matched(
+                bool matching);
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        int matched_count_;
+        int expected_matches_;
+
+        MatchListener listener_;
+        TestCommandDataType type_;
+        DiscoveryTraffic traffic_;
+        std::string static_xml_file_;
+        std::vector<eprosima::fastrtps::Participant*> participants_;
+};
+
+#endif /* DISCOVERYTEST_H_ */
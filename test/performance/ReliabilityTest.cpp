@@ -0,0 +1,335 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReliabilityTest.cpp
+ *
+ */
+
+#include "ReliabilityTest.h"
+
+#include <fastrtps/log/Log.h>
+#include <fastrtps/transport/test_UDPv4TransportDescriptor.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using std::cout;
+using std::endl;
+
+ReliabilityTest::ReliabilityTest()
+    : n_readers_(0)
+    , n_samples_(0)
+    , payload_(0)
+    , drop_percentage_(0)
+    , adaptive_(false)
+    , pid_(0)
+    , timeout_seconds_(60)
+    , export_csv_(false)
+    , time_to_deliver_(0)
+    , heartbeats_sent_(0)
+    , acknacks_received_(0)
+    , samples_resent_(0)
+    , bytes_sent_(0)
+    , matched_count_(0)
+    , received_count_(0)
+    , reader_listener_(this)
+    , writer_listener_(this)
+    , writer_participant_(nullptr)
+    , publisher_(nullptr)
+{
+}
+
+ReliabilityTest::~ReliabilityTest()
+{
+    if (writer_participant_ != nullptr)
+    {
+        Domain::removeParticipant(writer_participant_);
+    }
+
+    for (Participant* participant : reader_participants_)
+    {
+        Domain::removeParticipant(participant);
+    }
+    reader_participants_.clear();
+}
+
+bool ReliabilityTest::init(
+        int n_readers,
+        int n_samples,
+        uint32_t payload,
+        uint8_t drop_percentage,
+        bool adaptive,
+        uint32_t pid,
+        int timeout_seconds,
+        bool export_csv,
+        const std::string& export_prefix)
+{
+    n_readers_ = n_readers;
+    n_samples_ = n_samples;
+    payload_ = payload;
+    drop_percentage_ = drop_percentage;
+    adaptive_ = adaptive;
+    pid_ = pid;
+    timeout_seconds_ = timeout_seconds;
+    export_csv_ = export_csv;
+    export_prefix_ = export_prefix;
+
+    if (n_readers_ <= 0 || n_samples_ <= 0)
+    {
+        cout << "At least one reader and one sample are needed" << endl;
+        return false;
+    }
+
+    if (drop_percentage_ >= 100)
+    {
+        cout << "Drop percentage must be lower than 100" << endl;
+        return false;
+    }
+
+    sample_ = LatencyType(payload_);
+    return true;
+}
+
+bool ReliabilityTest::run()
+{
+    if (!create_entities())
+    {
+        cout << "Error creating entities" << endl;
+        return false;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_for(lock, std::chrono::seconds(timeout_seconds_), [this]()
+                {
+                    return matched_count_ >= 2 * n_readers_;
+                }))
+        {
+            cout << "Timeout waiting for discovery" << endl;
+            return false;
+        }
+    }
+
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < n_samples_; ++i)
+    {
+        sample_.seqnum = static_cast<uint32_t>(i);
+        publisher_->write(&sample_);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_for(lock, std::chrono::seconds(timeout_seconds_), [this]()
+                {
+                    return received_count_ >= n_readers_ * n_samples_;
+                }))
+        {
+            cout << "Timeout waiting for reception: " << received_count_ << " of " << n_readers_ * n_samples_ <<
+                " samples" << endl;
+            return false;
+        }
+    }
+
+    time_to_deliver_ = std::chrono::steady_clock::now() - t_start;
+
+    ParticipantStatistics stats;
+    if (writer_participant_->get_statistics(stats))
+    {
+        for (const WriterStatistics& writer_stats : stats.writers)
+        {
+            if (writer_stats.guid == publisher_->getGuid())
+            {
+                heartbeats_sent_ = writer_stats.heartbeats_sent;
+                acknacks_received_ = writer_stats.acknacks_received;
+                samples_resent_ = writer_stats.samples_resent;
+            }
+        }
+
+        for (const TransportStatistics& transport_stats : stats.transports)
+        {
+            bytes_sent_ += transport_stats.bytes_sent;
+        }
+    }
+
+    return true;
+}
+
+void ReliabilityTest::export_results()
+{
+    const char* mode_name = adaptive_ ? "adaptive" : "fixed";
+
+    std::ostringstream header;
+    std::ostringstream values;
+    header << "\"Readers\",\"Samples\",\"Payload (bytes)\",\"Drop (%)\",\"Time to deliver (ms)\","
+           << "\"Heartbeats sent\",\"Acknacks received\",\"Samples resent\",\"Bytes sent\"";
+    values << n_readers_ << "," << n_samples_ << "," << payload_ << "," << static_cast<uint32_t>(drop_percentage_) <<
+        "," << time_to_deliver_.count() << "," << heartbeats_sent_ << "," << acknacks_received_ << "," <<
+        samples_resent_ << "," << bytes_sent_;
+
+    cout << "Reliability (" << mode_name << "): " << n_samples_ << " samples of " << payload_ << " bytes to " <<
+        n_readers_ << " readers dropping " << static_cast<uint32_t>(drop_percentage_) << "% of DATA" << endl;
+    cout << "    Time to deliver:   " << time_to_deliver_.count() << " ms" << endl;
+    cout << "    Heartbeats sent:   " << heartbeats_sent_ << endl;
+    cout << "    Acknacks received: " << acknacks_received_ << endl;
+    cout << "    Samples resent:    " << samples_resent_ << endl;
+    cout << "    Bytes sent:        " << bytes_sent_ << endl;
+
+    if (export_csv_)
+    {
+        std::string prefix = export_prefix_;
+        if (prefix.length() == 0)
+        {
+            prefix = "perf_ReliabilityTest";
+        }
+
+        std::ofstream outFile;
+        outFile.open(prefix + "_" + mode_name + ".csv");
+        outFile << header.str() << endl << values.str() << endl;
+        outFile.close();
+    }
+}
+
+bool ReliabilityTest::create_entities()
+{
+    // Writer on a lossy link. Only the DATA of the user topic is dropped.
+    ParticipantAttributes PParam;
+    PParam.rtps.builtin.domainId = pid_ % 230;
+    PParam.rtps.setName("ReliabilityTest_writer");
+    PParam.rtps.properties.properties().emplace_back("fastrtps.statistics", "true");
+
+    auto transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    transport->dropDataMessagesPercentage = drop_percentage_;
+    PParam.rtps.useBuiltinTransports = false;
+    PParam.rtps.userTransports.push_back(transport);
+
+    writer_participant_ = Domain::createParticipant(PParam);
+    if (writer_participant_ == nullptr)
+    {
+        return false;
+    }
+    Domain::registerType(writer_participant_, &type_);
+
+    PublisherAttributes PubParam;
+    PubParam.topic.topicDataType = type_.getName();
+    PubParam.topic.topicKind = NO_KEY;
+    PubParam.topic.topicName = topic_name();
+    PubParam.topic.historyQos.kind = KEEP_ALL_HISTORY_QOS;
+    PubParam.topic.resourceLimitsQos.max_samples = n_samples_;
+    PubParam.topic.resourceLimitsQos.allocated_samples = n_samples_;
+    PubParam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    PubParam.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+    PubParam.times.adaptiveReliability = adaptive_;
+
+    publisher_ = Domain::createPublisher(writer_participant_, PubParam, &writer_listener_);
+    if (publisher_ == nullptr)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < n_readers_; ++i)
+    {
+        ParticipantAttributes RParam;
+        RParam.rtps.builtin.domainId = pid_ % 230;
+        RParam.rtps.setName("ReliabilityTest_reader");
+
+        Participant* participant = Domain::createParticipant(RParam);
+        if (participant == nullptr)
+        {
+            return false;
+        }
+        reader_participants_.push_back(participant);
+        Domain::registerType(participant, &type_);
+
+        SubscriberAttributes SubParam;
+        SubParam.topic.topicDataType = type_.getName();
+        SubParam.topic.topicKind = NO_KEY;
+        SubParam.topic.topicName = topic_name();
+        SubParam.topic.historyQos.kind = KEEP_ALL_HISTORY_QOS;
+        SubParam.topic.resourceLimitsQos.max_samples = n_samples_;
+        SubParam.topic.resourceLimitsQos.allocated_samples = n_samples_;
+        SubParam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        SubParam.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+
+        if (Domain::createSubscriber(participant, SubParam, &reader_listener_) == nullptr)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string ReliabilityTest::topic_name() const
+{
+    std::ostringstream name;
+    name << "ReliabilityTest_" << pid_;
+    return name.str();
+}
+
+void ReliabilityTest::ReaderListener::onSubscriptionMatched(
+        Subscriber* /*sub*/,
+        MatchingInfo& info)
+{
+    if (info.status == MATCHED_MATCHING)
+    {
+        {
+            std::lock_guard<std::mutex> guard(test_->mutex_);
+            ++test_->matched_count_;
+        }
+        test_->cv_.notify_one();
+    }
+}
+
+void ReliabilityTest::ReaderListener::onNewDataMessage(
+        Subscriber* sub)
+{
+    LatencyType data(test_->payload_);
+    SampleInfo_t info;
+    int taken = 0;
+    while (sub->takeNextData(&data, &info))
+    {
+        if (info.sampleKind == ALIVE)
+        {
+            ++taken;
+        }
+    }
+
+    if (taken > 0)
+    {
+        {
+            std::lock_guard<std::mutex> guard(test_->mutex_);
+            test_->received_count_ += taken;
+        }
+        test_->cv_.notify_one();
+    }
+}
+
+void ReliabilityTest::WriterListener::onPublicationMatched(
+        Publisher* /*pub*/,
+        MatchingInfo& info)
+{
+    if (info.status == MATCHED_MATCHING)
+    {
+        {
+            std::lock_guard<std::mutex> guard(test_->mutex_);
+            ++test_->matched_count_;
+        }
+        test_->cv_.notify_one();
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReliabilityTest.h
+ *
+ */
+
+#ifndef RELIABILITYTEST_H_
+#define RELIABILITYTEST_H_
+
+#include "LatencyTestTypes.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Measures how long a reliable writer needs to deliver a burst of samples to several readers
+ * when the link drops a percentage of the DATA submessages, and how much repair traffic it generates.
+ */
+class ReliabilityTest
+{
+    public:
+
+        ReliabilityTest();
+
+        virtual ~ReliabilityTest();
+
+        bool init(
+                int n_readers,
+                int n_samples,
+                uint32_t payload,
+                uint8_t drop_percentage,
+                bool adaptive,
+                uint32_t pid,
+                int timeout_seconds,
+                bool export_csv,
+                const std::string& export_prefix);
+
+        /**
+         * Create the writer and the readers, wait for them to match, and send every sample.
+         * @return false if some entity could not be created or the timeout expired.
+         */
+        bool run();
+
+        void export_results();
+
+        int n_readers_;
+        int n_samples_;
+        uint32_t payload_;
+        uint8_t drop_percentage_;
+        bool adaptive_;
+        uint32_t pid_;
+        int timeout_seconds_;
+        bool export_csv_;
+        std::string export_prefix_;
+
+        // Results
+        std::chrono::duration<double, std::milli> time_to_deliver_;
+        uint64_t heartbeats_sent_;
+        uint64_t acknacks_received_;
+        uint64_t samples_resent_;
+        uint64_t bytes_sent_;
+
+    private:
+
+        class ReaderListener : public eprosima::fastrtps::SubscriberListener
+        {
+            public:
+
+                ReaderListener(
+                        ReliabilityTest* test)
+                    : test_(test)
+                {
+                }
+
+                void onSubscriptionMatched(
+                        eprosima::fastrtps::Subscriber* sub,
+                        eprosima::fastrtps::rtps::MatchingInfo& info) override;
+
+                void onNewDataMessage(
+                        eprosima::fastrtps::Subscriber* sub) override;
+
+            private:
+
+                ReliabilityTest* test_;
+        };
+
+        class WriterListener : public eprosima::fastrtps::PublisherListener
+        {
+            public:
+
+                WriterListener(
+                        ReliabilityTest* test)
+                    : test_(test)
+                {
+                }
+
+                void onPublicationMatched(
+                        eprosima::fastrtps::Publisher* pub,
+                        eprosima::fastrtps::rtps::MatchingInfo& info) override;
+
+            private:
+
+                ReliabilityTest* test_;
+        };
+
+        bool create_entities();
+
+        std::string topic_name() const;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        int matched_count_;
+        int received_count_;
+
+        ReaderListener reader_listener_;
+        WriterListener writer_listener_;
+        LatencyDataType type_;
+        LatencyType sample_;
+
+        eprosima::fastrtps::Participant* writer_participant_;
+        eprosima::fastrtps::Publisher* publisher_;
+        std::vector<eprosima::fastrtps::Participant*> reader_participants_;
+};
+
+#endif /* RELIABILITYTEST_H_ */
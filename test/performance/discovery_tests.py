@@ -0,0 +1,56 @@
+# Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import subprocess, os, re, sys
+
+command = os.environ.get("DISCOVERY_TEST_BIN")
+certs_path = os.environ.get("CERTS_PATH")
+
+participants = "10"
+endpoints = "5"
+
+result = 0
+
+for discovery in ["simple", "server", "static"]:
+    test_proc = subprocess.Popen([command, "--participants", participants, "--endpoints", endpoints,
+        "--discovery", discovery, "--seed", str(os.getpid()), "--export_csv"])
+    test_proc.communicate()
+    if test_proc.returncode != 0:
+        result = test_proc.returncode
+
+# Authentication handshakes on the worker pool should match secured participants faster than inline handshakes
+if certs_path:
+    times = {}
+    for handshake_threads in ["0", "2"]:
+        test_proc = subprocess.Popen([command, "--participants", participants, "--endpoints", endpoints,
+            "--discovery", "simple", "--seed", str(os.getpid()), "--export_csv",
+            "--export_prefix", "perf_DiscoveryTest_secure_" + handshake_threads + "_threads",
+            "--security=true", "--certs=" + certs_path, "--handshake_threads", handshake_threads],
+            stdout=subprocess.PIPE, universal_newlines=True)
+        output = test_proc.communicate()[0]
+        print(output)
+        if test_proc.returncode != 0:
+            result = test_proc.returncode
+            continue
+        match = re.search(r"Time to full match:\s*([0-9.]+) ms", output)
+        if match:
+            times[handshake_threads] = float(match.group(1))
+
+    if len(times) == 2:
+        print("Secured time to full match: %.1f ms inline, %.1f ms on the handshake pool" % (times["0"], times["2"]))
+        if times["2"] >= times["0"]:
+            print("Handshake pool did not reduce the time to full match")
+            result = 1
+
+sys.exit(result)
@@ -0,0 +1,310 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "DiscoveryTest.h"
+
+#include "optionparser.h"
+
+#include <stdio.h>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+#include <fastrtps/log/Log.h>
+#include <fastrtps/Domain.h>
+
+#if defined(_MSC_VER)
+#pragma warning (push)
+#pragma warning (disable:4512)
+#endif
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+struct Arg: public option::Arg
+{
+    static void printError(const char* msg1, const option::Option& opt, const char* msg2)
+    {
+        fprintf(stderr, "%s", msg1);
+        fwrite(opt.name, opt.namelen, 1, stderr);
+        fprintf(stderr, "%s", msg2);
+    }
+
+    static option::ArgStatus Unknown(const option::Option& option, bool msg)
+    {
+        if (msg) printError("Unknown option '", option, "'\n");
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Required(const option::Option& option, bool msg)
+    {
+        if (option.arg != 0 && option.arg[0] != 0)
+        return option::ARG_OK;
+
+        if (msg) printError("Option '", option, "' requires an argument\n");
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Numeric(const option::Option& option, bool msg)
+    {
+        char* endptr = 0;
+        if (option.arg != 0 && strtol(option.arg, &endptr, 10))
+        {
+        }
+        if (endptr != option.arg && *endptr == 0)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            printError("Option '", option, "' requires a numeric argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus String(const option::Option& option, bool msg)
+    {
+        if (option.arg != 0)
+        {
+            return option::ARG_OK;
+        }
+        if (msg)
+        {
+            printError("Option '", option, "' requires a string argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+};
+
+enum  optionIndex {
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    ENDPOINTS,
+    DISCOVERY,
+    SEED,
+    TIMEOUT,
+    EXPORT_CSV,
+    EXPORT_PREFIX,
+    USE_SECURITY,
+    CERTS_PATH,
+    HANDSHAKE_THREADS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0,"", "",                Arg::None,      "Usage: DiscoveryTest [options]\n\nGeneral options:" },
+    { HELP,    0,"h", "help",               Arg::None,      "  -h \t--help  \tProduce help message." },
+    { PARTICIPANTS,0,"n","participants",    Arg::Numeric,   "  -n <num>, \t--participants=<num>  \tNumber of participants (default 10)." },
+    { ENDPOINTS,0,"m","endpoints",          Arg::Numeric,   "  -m <num>, \t--endpoints=<num>  \tNumber of publishers and subscribers on each participant (default 5)." },
+    { DISCOVERY,0,"d","discovery",          Arg::Required,  "  -d <arg>, \t--discovery=<arg>  \tDiscovery mechanism (\"simple\"/\"server\"/\"static\")." },
+    { SEED,0,"","seed",                     Arg::Numeric,   "  \t--seed=<num>  \tSeed to calculate domain and topic, to isolate test." },
+    { TIMEOUT,0,"t","timeout",              Arg::Numeric,   "  -t <num>, \t--timeout=<num>  \tSeconds to wait for all the endpoints to match (default 60)." },
+    { EXPORT_CSV,0,"","export_csv",         Arg::None,      "\t--export_csv \tFlag to export a CSV file." },
+    { EXPORT_PREFIX,0,"","export_prefix",   Arg::String,    "\t--export_prefix \tFile prefix for the CSV file." },
+#if HAVE_SECURITY
+    { USE_SECURITY, 0, "", "security",      Arg::Required,  "  --security <arg>  \tAuthenticate participants (\"true\"/\"false\")." },
+    { CERTS_PATH, 0, "", "certs",           Arg::Required,  "  --certs <arg>  \tPath where located certificates." },
+    { HANDSHAKE_THREADS,0,"","handshake_threads", Arg::Numeric, "  \t--handshake_threads=<num>  \tThreads running authentication handshakes, with pre-generated DH keys (default 0)." },
+#endif
+
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(int argc, char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif
+
+    int n_participants = 10;
+    int n_endpoints = 5;
+    DiscoveryKind kind = DiscoveryKind::SIMPLE;
+    uint32_t seed = 80;
+    int timeout = 60;
+    bool export_csv = false;
+    std::string export_prefix = "";
+#if HAVE_SECURITY
+    bool use_security = false;
+    std::string certs_path;
+    int handshake_threads = 0;
+#endif
+
+    argc -= (argc > 0);
+    argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case PARTICIPANTS:
+                n_participants = strtol(opt.arg, nullptr, 10);
+                break;
+            case ENDPOINTS:
+                n_endpoints = strtol(opt.arg, nullptr, 10);
+                break;
+            case DISCOVERY:
+                if (strcmp(opt.arg, "simple") == 0)
+                {
+                    kind = DiscoveryKind::SIMPLE;
+                }
+                else if (strcmp(opt.arg, "server") == 0)
+                {
+                    kind = DiscoveryKind::SERVER;
+                }
+                else if (strcmp(opt.arg, "static") == 0)
+                {
+                    kind = DiscoveryKind::STATIC;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                break;
+            case SEED:
+                seed = strtol(opt.arg, nullptr, 10);
+                break;
+            case TIMEOUT:
+                timeout = strtol(opt.arg, nullptr, 10);
+                break;
+            case EXPORT_CSV:
+                export_csv = true;
+                break;
+            case EXPORT_PREFIX:
+                if (opt.arg != nullptr)
+                {
+                    export_prefix = opt.arg;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                break;
+#if HAVE_SECURITY
+            case USE_SECURITY:
+                if (strcmp(opt.arg, "true") == 0)
+                {
+                    use_security = true;
+                }
+                else if (strcmp(opt.arg, "false") == 0)
+                {
+                    use_security = false;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return -1;
+                }
+                break;
+            case CERTS_PATH:
+                certs_path = opt.arg;
+                break;
+            case HANDSHAKE_THREADS:
+                handshake_threads = strtol(opt.arg, nullptr, 10);
+                break;
+#endif
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 0;
+                break;
+        }
+    }
+
+    PropertyPolicy participant_properties;
+
+#if HAVE_SECURITY
+    if (use_security)
+    {
+        if (certs_path.empty())
+        {
+            option::printUsage(fwrite, stdout, usage, columns);
+            return -1;
+        }
+
+        participant_properties.properties().emplace_back(Property("dds.sec.auth.plugin",
+            "builtin.PKI-DH"));
+        participant_properties.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.identity_ca",
+            "file://" + certs_path + "/maincacert.pem"));
+        participant_properties.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.identity_certificate",
+            "file://" + certs_path + "/mainpubcert.pem"));
+        participant_properties.properties().emplace_back(Property("dds.sec.auth.builtin.PKI-DH.private_key",
+            "file://" + certs_path + "/mainpubkey.pem"));
+
+        if (handshake_threads > 0)
+        {
+            participant_properties.properties().emplace_back(Property("dds.sec.auth.handshake_threads",
+                std::to_string(handshake_threads)));
+            participant_properties.properties().emplace_back(Property(
+                "dds.sec.auth.builtin.PKI-DH.preallocated_dh_keys", std::to_string(n_participants)));
+        }
+    }
+#endif
+
+    int result = 0;
+
+    {
+        DiscoveryTest test;
+        test.participant_properties_ = participant_properties;
+        if (test.init(n_participants, n_endpoints, kind, seed, timeout, export_csv, export_prefix) && test.run())
+        {
+            test.export_results();
+        }
+        else
+        {
+            result = 1;
+        }
+    }
+
+    Log::Reset();
+    return result;
+}
+
+#if defined(_MSC_VER)
+#pragma warning (pop)
+#endif
@@ -0,0 +1,240 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ReliabilityTest.h"
+
+#include "optionparser.h"
+
+#include <stdio.h>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+#include <fastrtps/log/Log.h>
+#include <fastrtps/Domain.h>
+
+#if defined(_MSC_VER)
+#pragma warning (push)
+#pragma warning (disable:4512)
+#endif
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+struct Arg: public option::Arg
+{
+    static void printError(const char* msg1, const option::Option& opt, const char* msg2)
+    {
+        fprintf(stderr, "%s", msg1);
+        fwrite(opt.name, opt.namelen, 1, stderr);
+        fprintf(stderr, "%s", msg2);
+    }
+
+    static option::ArgStatus Unknown(const option::Option& option, bool msg)
+    {
+        if (msg) printError("Unknown option '", option, "'\n");
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Required(const option::Option& option, bool msg)
+    {
+        if (option.arg != 0 && option.arg[0] != 0)
+        return option::ARG_OK;
+
+        if (msg) printError("Option '", option, "' requires an argument\n");
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Numeric(const option::Option& option, bool msg)
+    {
+        char* endptr = 0;
+        if (option.arg != 0 && strtol(option.arg, &endptr, 10))
+        {
+        }
+        if (endptr != option.arg && *endptr == 0)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            printError("Option '", option, "' requires a numeric argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus String(const option::Option& option, bool msg)
+    {
+        if (option.arg != 0)
+        {
+            return option::ARG_OK;
+        }
+        if (msg)
+        {
+            printError("Option '", option, "' requires a string argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+};
+
+enum  optionIndex {
+    UNKNOWN_OPT,
+    HELP,
+    READERS,
+    SAMPLES,
+    PAYLOAD,
+    DROP,
+    ADAPTIVE,
+    SEED,
+    TIMEOUT,
+    EXPORT_CSV,
+    EXPORT_PREFIX
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0,"", "",                Arg::None,      "Usage: ReliabilityTest [options]\n\nGeneral options:" },
+    { HELP,    0,"h", "help",               Arg::None,      "  -h \t--help  \tProduce help message." },
+    { READERS,0,"n","readers",              Arg::Numeric,   "  -n <num>, \t--readers=<num>  \tNumber of reader participants (default 3)." },
+    { SAMPLES,0,"s","samples",              Arg::Numeric,   "  -s <num>, \t--samples=<num>  \tNumber of samples to deliver (default 200)." },
+    { PAYLOAD,0,"","payload",               Arg::Numeric,   "  \t--payload=<num>  \tPayload of each sample in bytes (default 1024)." },
+    { DROP,0,"","drop",                     Arg::Numeric,   "  \t--drop=<num>  \tPercentage of DATA submessages dropped by the writer (default 10)." },
+    { ADAPTIVE,0,"","adaptive",             Arg::None,      "  \t--adaptive  \tEnable adaptive heartbeat and NACK response pacing on the writer." },
+    { SEED,0,"","seed",                     Arg::Numeric,   "  \t--seed=<num>  \tSeed to calculate domain and topic, to isolate test." },
+    { TIMEOUT,0,"t","timeout",              Arg::Numeric,   "  -t <num>, \t--timeout=<num>  \tSeconds to wait for discovery and for the delivery (default 60)." },
+    { EXPORT_CSV,0,"","export_csv",         Arg::None,      "\t--export_csv \tFlag to export a CSV file." },
+    { EXPORT_PREFIX,0,"","export_prefix",   Arg::String,    "\t--export_prefix \tFile prefix for the CSV file." },
+
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(int argc, char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif
+
+    int n_readers = 3;
+    int n_samples = 200;
+    uint32_t payload = 1024;
+    uint8_t drop = 10;
+    bool adaptive = false;
+    uint32_t seed = 80;
+    int timeout = 60;
+    bool export_csv = false;
+    std::string export_prefix = "";
+
+    argc -= (argc > 0);
+    argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case READERS:
+                n_readers = strtol(opt.arg, nullptr, 10);
+                break;
+            case SAMPLES:
+                n_samples = strtol(opt.arg, nullptr, 10);
+                break;
+            case PAYLOAD:
+                payload = strtoul(opt.arg, nullptr, 10);
+                break;
+            case DROP:
+                drop = static_cast<uint8_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case ADAPTIVE:
+                adaptive = true;
+                break;
+            case SEED:
+                seed = strtol(opt.arg, nullptr, 10);
+                break;
+            case TIMEOUT:
+                timeout = strtol(opt.arg, nullptr, 10);
+                break;
+            case EXPORT_CSV:
+                export_csv = true;
+                break;
+            case EXPORT_PREFIX:
+                if (opt.arg != nullptr)
+                {
+                    export_prefix = opt.arg;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 0;
+                break;
+        }
+    }
+
+    int result = 0;
+
+    {
+        ReliabilityTest test;
+        if (test.init(n_readers, n_samples, payload, drop, adaptive, seed, timeout, export_csv, export_prefix) &&
+                test.run())
+        {
+            test.export_results();
+        }
+        else
+        {
+            result = 1;
+        }
+    }
+
+    Log::Reset();
+    return result;
+}
+
+#if defined(_MSC_VER)
+#pragma warning (pop)
+#endif
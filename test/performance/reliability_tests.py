@@ -0,0 +1,32 @@
+# Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import subprocess, os, sys
+
+command = os.environ.get("RELIABILITY_TEST_BIN")
+
+readers = "3"
+samples = "200"
+drop = "10"
+
+result = 0
+
+for mode in [[], ["--adaptive"]]:
+    test_proc = subprocess.Popen([command, "--readers", readers, "--samples", samples, "--drop", drop,
+        "--seed", str(os.getpid()), "--export_csv"] + mode)
+    test_proc.communicate()
+    if test_proc.returncode != 0:
+        result = test_proc.returncode
+
+sys.exit(result)
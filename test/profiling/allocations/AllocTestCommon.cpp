@@ -18,6 +18,7 @@
  */
 
 #include "AllocTestCommon.h"
+#include "AllocTestKeyedTypePubSubType.h"
 
 #include <atomic>
 #include <iostream>
@@ -52,12 +53,53 @@ static bool g_print_dealloc_traces = false;
 static std::atomic_size_t g_allocations[4];
 static std::atomic_size_t g_deallocations[4];
 
+static bool g_profiler_working = false;
+
 static std::atomic_size_t g_phase(0u);
 static std::atomic<std::atomic_size_t*> g_allocationsPtr(g_allocations);
 static std::atomic<std::atomic_size_t*> g_deallocationsPtr(g_deallocations);
 
 const std::regex is_fastrtps("fastrtps");
 
+static bool remove_modifier(
+        std::string& profile,
+        const std::string& modifier)
+{
+    size_t pos = profile.find(modifier);
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    profile.erase(pos, modifier.length());
+    return true;
+}
+
+ProfileOptions parse_profile(
+        const std::string& profile)
+{
+    ProfileOptions options;
+    options.xml_profile = profile;
+    options.keyed = remove_modifier(options.xml_profile, "_keyed");
+    options.async = remove_modifier(options.xml_profile, "_async");
+    return options;
+}
+
+void make_keyed(
+        eprosima::fastrtps::TopicAttributes& topic)
+{
+    const int32_t instances = static_cast<int32_t>(AllocTestKeyedTypePubSubType::NUM_INSTANCES);
+    int32_t samples_per_instance = topic.resourceLimitsQos.max_samples / instances;
+
+    topic.topicKind = eprosima::fastrtps::rtps::WITH_KEY;
+    topic.resourceLimitsQos.max_instances = instances;
+    topic.resourceLimitsQos.max_samples_per_instance = samples_per_instance;
+    if (topic.historyQos.depth > samples_per_instance)
+    {
+        topic.historyQos.depth = samples_per_instance;
+    }
+}
+
 static void allocation_account(MemoryToolsService & service)
 {
     // It makes no sense to track allocations if they don't come from our library
@@ -115,7 +157,8 @@ void entities_created(
     osrf_testing_tools_cpp::memory_tools::enable_monitoring_in_all_threads();
     EXPECT_NO_MEMORY_OPERATIONS_BEGIN();
 
-    if (!osrf_testing_tools_cpp::memory_tools::is_working())
+    g_profiler_working = osrf_testing_tools_cpp::memory_tools::is_working();
+    if (!g_profiler_working)
     {
         std::cerr << "Memory profiler not working!" << std::endl;
     }
@@ -200,4 +243,26 @@ void print_results(
     outFile.close();
 }
 
+/**
+ * Check no allocation was made after the first sample was exchanged.
+ */
+bool check_steady_state()
+{
+    if (!g_profiler_working)
+    {
+        std::cout << "Steady state not checked: memory profiler not working" << std::endl;
+        return false;
+    }
+
+    size_t allocs = g_allocations[2].load();
+    if (allocs > 0)
+    {
+        std::cout << "Steady state made " << allocs << " allocations" << std::endl;
+        return false;
+    }
+
+    std::cout << "Steady state made no allocations" << std::endl;
+    return true;
+}
+
 }   // namespace eprosima_profiling
@@ -20,11 +20,39 @@
 #ifndef FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
 #define FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
 
+#include <fastrtps/attributes/TopicAttributes.h>
+
 #include <string>
 
 namespace eprosima_profiling
 {
 
+/**
+ * Options of a test profile. Its name is the suffix of a profile of the XML file, like vo_re, which may be followed by
+ * the modifiers _keyed and _async, like vo_re_keyed_async.
+ */
+struct ProfileOptions
+{
+    //! Suffix of the profiles to load from the XML file.
+    std::string xml_profile;
+    //! Whether the topic has a key.
+    bool keyed = false;
+    //! Whether the publisher is asynchronous.
+    bool async = false;
+};
+
+/**
+ * Parse the name of a test profile.
+ */
+ProfileOptions parse_profile(
+        const std::string& profile);
+
+/**
+ * Make a topic keyed, spreading the samples of its history over the instances of AllocTestKeyedTypePubSubType.
+ */
+void make_keyed(
+        eprosima::fastrtps::TopicAttributes& topic);
+
 /**
  * Used to run callgrind with --zero-before=callgrind_zero_count.
  * See http://valgrind.org/docs/manual/cl-manual.html#cl-manual.options.activity
@@ -75,6 +103,13 @@ void print_results(
         const std::string& entity,
         const std::string& config);
 
+/**
+ * Check no allocation was made after the first sample was exchanged, reporting the result on the standard output.
+ *
+ * @return false when the steady state allocated memory or the memory profiler was not working.
+ */
+bool check_steady_state();
+
 }   // namespace eprosima_profiling
 
 #endif   // FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
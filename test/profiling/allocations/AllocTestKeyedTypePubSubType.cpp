@@ -0,0 +1,43 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AllocTestKeyedTypePubSubType.cpp
+ *
+ */
+
+#include "AllocTestKeyedTypePubSubType.h"
+
+#include <cstring>
+
+using namespace eprosima::fastrtps::rtps;
+
+AllocTestKeyedTypePubSubType::AllocTestKeyedTypePubSubType()
+{
+    m_isGetKeyDefined = true;
+}
+
+bool AllocTestKeyedTypePubSubType::getKey(
+        void* data,
+        InstanceHandle_t* handle,
+        bool /*force_md5*/)
+{
+    AllocTestType* p_type = static_cast<AllocTestType*>(data);
+    uint32_t instance = p_type->index() % NUM_INSTANCES;
+
+    // The key is small enough to be used as the instance handle itself.
+    memset(handle->value, 0, sizeof(handle->value));
+    memcpy(handle->value, &instance, sizeof(instance));
+    return true;
+}
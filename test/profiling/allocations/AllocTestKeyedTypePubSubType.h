@@ -0,0 +1,44 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AllocTestKeyedTypePubSubType.h
+ *
+ */
+
+#ifndef FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTKEYEDTYPEPUBSUBTYPE_H_
+#define FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTKEYEDTYPEPUBSUBTYPE_H_
+
+#include "AllocTestTypePubSubTypes.h"
+
+/**
+ * Keyed version of AllocTestType, used to profile the keyed topics.
+ * The samples are spread over a fixed number of instances, taken from their index.
+ */
+class AllocTestKeyedTypePubSubType : public AllocTestTypePubSubType
+{
+public:
+
+    //! Number of instances the samples are spread over.
+    static const uint32_t NUM_INSTANCES = 4;
+
+    AllocTestKeyedTypePubSubType();
+
+    bool getKey(
+            void* data,
+            eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+            bool force_md5) override;
+};
+
+#endif   // FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTKEYEDTYPEPUBSUBTYPE_H_
@@ -58,13 +58,38 @@ bool AllocTestPublisher::init(const char* profile, int domainId, const std::stri
     if (mp_participant == nullptr)
         return false;
 
+    eprosima_profiling::ProfileOptions options = eprosima_profiling::parse_profile(profile);
+
     //REGISTER THE TYPE
-    Domain::registerType(mp_participant, &m_type);
+    if (options.keyed)
+    {
+        Domain::registerType(mp_participant, &m_keyed_type);
+    }
+    else
+    {
+        Domain::registerType(mp_participant, &m_type);
+    }
 
     //CREATE THE PUBLISHER
     std::string prof("test_publisher_profile_");
-    prof.append(profile);
-    mp_publisher = Domain::createPublisher(mp_participant,prof,(PublisherListener*)&m_listener);
+    prof.append(options.xml_profile);
+    PublisherAttributes publisher_att;
+    if (eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK !=
+        eprosima::fastrtps::xmlparser::XMLProfileManager::fillPublisherAttributes(prof, publisher_att))
+    {
+        return false;
+    }
+
+    if (options.keyed)
+    {
+        eprosima_profiling::make_keyed(publisher_att.topic);
+    }
+    if (options.async)
+    {
+        publisher_att.qos.m_publishMode.kind = ASYNCHRONOUS_PUBLISH_MODE;
+    }
+
+    mp_publisher = Domain::createPublisher(mp_participant, publisher_att, (PublisherListener*)&m_listener);
     if(mp_publisher == nullptr)
         return false;
 
@@ -112,7 +137,7 @@ void AllocTestPublisher::PubListener::wait_unmatch()
     cv.wait(lock, [this]() { return n_matched <= 0; });
 }
 
-void AllocTestPublisher::run(uint32_t samples, bool wait_unmatch)
+bool AllocTestPublisher::run(uint32_t samples, bool wait_unmatch)
 {
     // Restart callgrind graph
     eprosima_profiling::callgrind_zero_count();
@@ -167,6 +192,7 @@ void AllocTestPublisher::run(uint32_t samples, bool wait_unmatch)
     eprosima_profiling::callgrind_dump();
     eprosima_profiling::undiscovery_finished();
     eprosima_profiling::print_results(m_outputFile, "publisher", m_profile);
+    return eprosima_profiling::check_steady_state();
 }
 
 bool AllocTestPublisher::publish()
@@ -21,6 +21,7 @@
 #define ALLOCTESTPUBLISHER_H_
 
 #include "AllocTestTypePubSubTypes.h"
+#include "AllocTestKeyedTypePubSubType.h"
 
 #include <fastrtps/fastrtps_fwd.h>
 #include <fastrtps/attributes/PublisherAttributes.h>
@@ -38,10 +39,11 @@ public:
     bool init(const char* profile, int domainId, const std::string& outputFile);
     //!Publish a sample
     bool publish();
-    //!Run for number samples
-    void run(uint32_t number, bool wait_unmatch = false);
+    //!Run for number samples. Returns false if the steady state allocated memory.
+    bool run(uint32_t number, bool wait_unmatch = false);
 private:
     AllocTestTypePubSubType m_type;
+    AllocTestKeyedTypePubSubType m_keyed_type;
     AllocTestType m_data;
     eprosima::fastrtps::Participant* mp_participant;
     eprosima::fastrtps::Publisher* mp_publisher;
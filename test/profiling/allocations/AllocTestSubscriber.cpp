@@ -53,13 +53,34 @@ bool AllocTestSubscriber::init(const char* profile, int domainId, const std::str
     if(mp_participant==nullptr)
         return false;
 
+    eprosima_profiling::ProfileOptions options = eprosima_profiling::parse_profile(profile);
+
     //REGISTER THE TYPE
-    Domain::registerType(mp_participant,&m_type);
+    if (options.keyed)
+    {
+        Domain::registerType(mp_participant, &m_keyed_type);
+    }
+    else
+    {
+        Domain::registerType(mp_participant, &m_type);
+    }
 
     //CREATE THE SUBSCRIBER
     std::string prof("test_subscriber_profile_");
-    prof.append(profile);
-    mp_subscriber = Domain::createSubscriber(mp_participant, prof, &m_listener);
+    prof.append(options.xml_profile);
+    SubscriberAttributes subscriber_att;
+    if (eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK !=
+        eprosima::fastrtps::xmlparser::XMLProfileManager::fillSubscriberAttributes(prof, subscriber_att))
+    {
+        return false;
+    }
+
+    if (options.keyed)
+    {
+        eprosima_profiling::make_keyed(subscriber_att.topic);
+    }
+
+    mp_subscriber = Domain::createSubscriber(mp_participant, subscriber_att, &m_listener);
 
     if(mp_subscriber == nullptr)
         return false;
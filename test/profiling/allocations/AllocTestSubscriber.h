@@ -21,6 +21,7 @@
 #define ALLOCTESTSUBSCRIBER_H_
 
 #include "AllocTestTypePubSubTypes.h"
+#include "AllocTestKeyedTypePubSubType.h"
 
 #include <fastrtps/fastrtps_fwd.h>
 #include <fastrtps/attributes/SubscriberAttributes.h>
@@ -71,6 +72,7 @@ public:
     }m_listener;
 private:
 	AllocTestTypePubSubType m_type;
+	AllocTestKeyedTypePubSubType m_keyed_type;
 };
 
 #endif /* ALLOCTESTSUBSCRIBER_H_ */
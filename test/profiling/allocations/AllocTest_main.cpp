@@ -25,6 +25,8 @@
 #include <fastrtps/utils/eClock.h>
 #include <fastrtps/log/Log.h>
 
+#include <cstdlib>
+
 using namespace eprosima;
 using namespace fastrtps;
 using namespace rtps;
@@ -32,6 +34,7 @@ using namespace rtps;
 int main(int argc, char** argv)
 {
     std::cout << "Starting "<< std::endl;
+    int result = 0;
     int type = 1;
     int domain = 1;
     bool wait_unmatch = false;
@@ -67,7 +70,10 @@ int main(int argc, char** argv)
             << "        tl_be: transient-local best-effort" << std::endl
             << "        tl_re: transient-local reliable" << std::endl
             << "        vo_be: volatile best-effort" << std::endl
-            << "        vo_re: volatile reliable" << std::endl;
+            << "        vo_re: volatile reliable" << std::endl
+            << "      optionally followed by:" << std::endl
+            << "        _keyed: keyed topic" << std::endl
+            << "        _async: asynchronous publisher" << std::endl;
         Log::Reset();
         return 0;
     }
@@ -78,9 +84,19 @@ int main(int argc, char** argv)
         case 1:
             {
                 AllocTestPublisher mypub;
+                // Only the publisher is checked, as the steady state check covers the write path.
+                // The check only fails the run when requested, as plain runs may not preload the memory profiler.
+                bool check_steady_state = std::getenv("ALLOCTEST_CHECK_STEADY_STATE") != nullptr;
                 if(mypub.init(profile, domain, outputFile))
                 {
-                    mypub.run(60, wait_unmatch);
+                    if(!mypub.run(60, wait_unmatch) && check_steady_state)
+                    {
+                        result = 1;
+                    }
+                }
+                else if(check_steady_state)
+                {
+                    result = 1;
                 }
                 break;
             }
@@ -98,5 +114,5 @@ int main(int argc, char** argv)
     Domain::stopAll();
     Log::Reset();
 
-    return 0;
+    return result;
 }
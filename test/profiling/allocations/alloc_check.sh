@@ -0,0 +1,40 @@
+#!/bin/sh
+
+## Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+##
+## Licensed under the Apache License, Version 2.0 (the "License");
+## you may not use this file except in compliance with the License.
+## You may obtain a copy of the License at
+##
+##     http:##www.apache.org/licenses/LICENSE-2.0
+##
+## Unless required by applicable law or agreed to in writing, software
+## distributed under the License is distributed on an "AS IS" BASIS,
+## WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+## See the License for the specific language governing permissions and
+## limitations under the License.
+
+############################################################################################
+# This script checks the publisher does not allocate memory once the first sample has been
+# sent. It launches a subscriber, and a publisher using the memory_tools_interpose library,
+# and fails when the publisher reports any allocation after the first sample.
+#
+# Usage: alloc_check.sh <profile> <domain> [libraries to preload]
+############################################################################################
+
+profile=$1
+domain=$2
+preload=${3:-/usr/local/lib/libmemory_tools_interpose.so:/usr/local/lib/libmemory_tools.so}
+
+./AllocationTest subscriber $profile false $domain alloc_check_subscriber_$profile.csv &
+subscriber=$!
+
+ALLOCTEST_CHECK_STEADY_STATE=1 LD_PRELOAD=$preload ./AllocationTest publisher $profile true $domain alloc_check_publisher_$profile.csv
+result=$?
+
+if [ $result -ne 0 ]; then
+    kill $subscriber 2>/dev/null
+fi
+wait $subscriber
+
+exit $result
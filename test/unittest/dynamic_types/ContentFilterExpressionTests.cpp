@@ -0,0 +1,194 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/log/Log.h>
+
+#include <types/ContentFilterExpression.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::types;
+
+class ContentFilterExpressionTests : public ::testing::Test
+{
+    protected:
+
+        void SetUp() override
+        {
+            DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+            DynamicTypeBuilder_ptr color_builder = factory->create_enum_builder();
+            color_builder->add_empty_member(0, "RED");
+            color_builder->add_empty_member(1, "GREEN");
+            color_builder->add_empty_member(2, "BLUE");
+            color_builder->set_name("Color");
+
+            DynamicTypeBuilder_ptr position_builder = factory->create_struct_builder();
+            position_builder->add_member(0, "x", factory->create_int32_type());
+            position_builder->add_member(1, "y", factory->create_float64_type());
+            position_builder->set_name("Position");
+
+            DynamicTypeBuilder_ptr sample_builder = factory->create_struct_builder();
+            sample_builder->add_member(0, "id", factory->create_int32_type());
+            sample_builder->add_member(1, "name", factory->create_string_type());
+            sample_builder->add_member(2, "color", color_builder.get());
+            sample_builder->add_member(3, "valid", factory->create_bool_type());
+            sample_builder->add_member(4, "position", position_builder.get());
+            sample_builder->set_name("Sample");
+            type_ = sample_builder->build();
+
+            data_ = DynamicDataFactory::get_instance()->create_data(type_);
+            set(7, "sensor_7", "GREEN", true, -3, 2.5);
+        }
+
+        void TearDown() override
+        {
+            DynamicDataFactory::get_instance()->delete_data(data_);
+            type_.reset();
+            DynamicDataFactory::delete_instance();
+            DynamicTypeBuilderFactory::delete_instance();
+            Log::KillThread();
+        }
+
+        void set(
+                int32_t id,
+                const std::string& name,
+                const std::string& color,
+                bool valid,
+                int32_t x,
+                double y)
+        {
+            data_->set_int32_value(id, 0);
+            data_->set_string_value(name, 1);
+            data_->set_enum_value(color, 2);
+            data_->set_bool_value(valid, 3);
+            DynamicData* position = data_->loan_value(4);
+            position->set_int32_value(x, 0);
+            position->set_float64_value(y, 1);
+            data_->return_loaned_value(position);
+        }
+
+        bool matches(
+                const std::string& expression,
+                const std::vector<std::string>& parameters = {})
+        {
+            ContentFilterExpression filter;
+            EXPECT_TRUE(filter.compile(expression, parameters, type_)) << expression;
+            return filter.evaluate(data_);
+        }
+
+        bool compiles(
+                const std::string& expression,
+                const std::vector<std::string>& parameters = {})
+        {
+            ContentFilterExpression filter;
+            return filter.compile(expression, parameters, type_);
+        }
+
+        DynamicType_ptr type_;
+
+        DynamicData* data_;
+};
+
+TEST_F(ContentFilterExpressionTests, comparisons)
+{
+    EXPECT_TRUE(matches("id = 7"));
+    EXPECT_FALSE(matches("id <> 7"));
+    EXPECT_TRUE(matches("id != 8"));
+    EXPECT_TRUE(matches("id > 6 AND id >= 7 AND id < 8 AND id <= 7"));
+    EXPECT_TRUE(matches("8 > id"));
+    EXPECT_TRUE(matches("id = 7.0"));
+    EXPECT_TRUE(matches("position.y > 2"));
+    EXPECT_TRUE(matches("position.x = -3"));
+    EXPECT_TRUE(matches("valid = TRUE"));
+    EXPECT_FALSE(matches("valid = false"));
+    EXPECT_TRUE(matches("name = 'sensor_7'"));
+    EXPECT_TRUE(matches("name > 'a' AND name < 'z'"));
+    EXPECT_FALSE(matches("name = 7"));
+}
+
+TEST_F(ContentFilterExpressionTests, logical_operators)
+{
+    EXPECT_TRUE(matches("id = 1 OR id = 7"));
+    EXPECT_FALSE(matches("id = 1 or valid = false"));
+    EXPECT_TRUE(matches("NOT id = 1"));
+    EXPECT_TRUE(matches("id = 1 OR id = 2 OR (id = 7 AND position.x < 0)"));
+    EXPECT_FALSE(matches("(id = 1 OR id = 7) AND NOT valid = TRUE"));
+    EXPECT_TRUE(matches("id BETWEEN 5 AND 10"));
+    EXPECT_FALSE(matches("id NOT BETWEEN 5 AND 10"));
+}
+
+TEST_F(ContentFilterExpressionTests, like)
+{
+    EXPECT_TRUE(matches("name LIKE 'sensor%'"));
+    EXPECT_TRUE(matches("name LIKE 'sensor__'"));
+    EXPECT_TRUE(matches("name LIKE '%_7'"));
+    EXPECT_FALSE(matches("name LIKE 'sensor_'"));
+    EXPECT_TRUE(matches("name NOT LIKE 'actuator%'"));
+}
+
+TEST_F(ContentFilterExpressionTests, enumerations)
+{
+    EXPECT_TRUE(matches("color = GREEN"));
+    EXPECT_TRUE(matches("color = 'GREEN'"));
+    EXPECT_TRUE(matches("color = 1"));
+    EXPECT_FALSE(matches("color = BLUE"));
+    EXPECT_TRUE(matches("color = %0", {"GREEN"}));
+}
+
+TEST_F(ContentFilterExpressionTests, parameters)
+{
+    EXPECT_TRUE(matches("id = %0 AND name = %1", {"7", "'sensor_7'"}));
+    EXPECT_TRUE(matches("position.y < %0", {"2.75"}));
+    EXPECT_TRUE(matches("valid = %0", {"TRUE"}));
+    EXPECT_FALSE(compiles("id = %1", {"7"}));
+}
+
+TEST_F(ContentFilterExpressionTests, reevaluation)
+{
+    ContentFilterExpression filter;
+    ASSERT_TRUE(filter.compile("position.x > %0", {"0"}, type_));
+    EXPECT_FALSE(filter.evaluate(data_));
+    set(7, "sensor_7", "GREEN", true, 3, 2.5);
+    EXPECT_TRUE(filter.evaluate(data_));
+}
+
+TEST_F(ContentFilterExpressionTests, invalid_expressions)
+{
+    EXPECT_FALSE(compiles(""));
+    EXPECT_FALSE(compiles("unknown = 1"));
+    EXPECT_FALSE(compiles("position = 1"));
+    EXPECT_FALSE(compiles("id.x = 1"));
+    EXPECT_FALSE(compiles("id = 1 AND"));
+    EXPECT_FALSE(compiles("(id = 1"));
+    EXPECT_FALSE(compiles("id = 1)"));
+    EXPECT_FALSE(compiles("name = 'open"));
+    EXPECT_FALSE(compiles("id == 1"));
+    EXPECT_FALSE(compiles("id ! 1"));
+    EXPECT_TRUE(compiles("id = 1", {}));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
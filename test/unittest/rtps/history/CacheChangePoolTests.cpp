@@ -16,7 +16,9 @@
 #include <fastrtps/rtps/history/CacheChangePool.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 
+#include <cstring>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastrtps::rtps;
 using namespace ::testing;
@@ -121,6 +123,11 @@ TEST_P(CacheChangePoolTests, reserve_cache)
             case MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE:
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
+            case MemoryManagementPolicy_t::SLAB_MEMORY_MODE:
+                ASSERT_GE(ch->serializedPayload.max_size, max(64U, data_size));
+                ASSERT_LT(ch->serializedPayload.max_size, max(128U, data_size * 2));
+                ASSERT_EQ(ch->serializedPayload.max_size & (ch->serializedPayload.max_size - 1), 0U);
+                break;
         }
 
         if (max_size > 0)
@@ -245,7 +252,79 @@ INSTANTIATE_TEST_CASE_P(
             Values(128, 256, 512, 1024),
             Values(MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
                    MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
-                   MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)), );
+                   MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
+                   MemoryManagementPolicy_t::SLAB_MEMORY_MODE)), );
+
+TEST(CacheChangePoolSlabTests, blocks_are_reused)
+{
+    CacheChangePool pool(10, 1024, 0, MemoryManagementPolicy_t::SLAB_MEMORY_MODE);
+    CacheChange_t* ch = nullptr;
+
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 100U));
+    ASSERT_EQ(ch->serializedPayload.max_size, 128U);
+    octet* block = ch->serializedPayload.data;
+    pool.release_Cache(ch);
+    ASSERT_EQ(ch->serializedPayload.data, nullptr);
+
+    // Same size class returns the same block.
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 120U));
+    ASSERT_EQ(ch->serializedPayload.data, block);
+    pool.release_Cache(ch);
+
+    // A different size class does not.
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 300U));
+    ASSERT_EQ(ch->serializedPayload.max_size, 512U);
+    ASSERT_NE(ch->serializedPayload.data, block);
+    pool.release_Cache(ch);
+}
+
+TEST(CacheChangePoolSlabTests, reserve_payload_keeps_contents)
+{
+    CacheChangePool pool(10, 1024, 0, MemoryManagementPolicy_t::SLAB_MEMORY_MODE);
+    CacheChange_t* ch = nullptr;
+
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 64U));
+    for (uint32_t i = 0; i < 64U; ++i)
+    {
+        ch->serializedPayload.data[i] = static_cast<octet>(i);
+    }
+    ch->serializedPayload.length = 64U;
+
+    ASSERT_TRUE(pool.reserve_payload(ch, 200U));
+    ASSERT_EQ(ch->serializedPayload.max_size, 256U);
+    ASSERT_EQ(ch->serializedPayload.length, 64U);
+    for (uint32_t i = 0; i < 64U; ++i)
+    {
+        ASSERT_EQ(ch->serializedPayload.data[i], static_cast<octet>(i));
+    }
+    pool.release_Cache(ch);
+}
+
+TEST(CacheChangePoolSlabTests, many_changes_of_one_class)
+{
+    CacheChangePool pool(10, 1024, 0, MemoryManagementPolicy_t::SLAB_MEMORY_MODE);
+    std::vector<CacheChange_t*> changes;
+
+    for (uint32_t i = 0; i < 200U; ++i)
+    {
+        CacheChange_t* ch = nullptr;
+        ASSERT_TRUE(pool.reserve_Cache(&ch, 1000U));
+        memset(ch->serializedPayload.data, static_cast<int>(i), 1000U);
+        changes.push_back(ch);
+    }
+
+    // Blocks do not overlap.
+    for (uint32_t i = 0; i < 200U; ++i)
+    {
+        ASSERT_EQ(changes[i]->serializedPayload.data[0], static_cast<octet>(i));
+        ASSERT_EQ(changes[i]->serializedPayload.data[999], static_cast<octet>(i));
+    }
+
+    for (CacheChange_t* ch : changes)
+    {
+        pool.release_Cache(ch);
+    }
+}
 
 int main(int argc, char **argv)
 {
@@ -16,7 +16,9 @@
 #include <fastrtps/rtps/attributes/PropertyPolicy.h>
 #include <fastrtps/rtps/history/CacheChangePool.h>
 
+#include <chrono>
 #include <climits>
+#include <thread>
 #include <gtest/gtest.h>
 
 using namespace eprosima::fastrtps::rtps;
@@ -165,6 +167,126 @@ TEST_F(PersistenceTest, Reader)
     ASSERT_EQ(seq_map_loaded, seq_map);
 }
 
+/*!
+* @fn TEST_F(PersistenceTest, WriterBatched)
+* @brief This test checks the writer persistence interface when operations are grouped on transactions.
+*/
+TEST_F(PersistenceTest, WriterBatched)
+{
+    const std::string persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", "test.db");
+    policy.properties().emplace_back("dds.persistence.sqlite3.batch_size", "100");
+    policy.properties().emplace_back("dds.persistence.sqlite3.batch_max_latency_ms", "10");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    CacheChangePool pool(20, 128, 0, MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE);
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    std::vector<CacheChange_t*> changes;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    // Add ten changes and remove seq = 1 before they are committed
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    change.sequenceNumber.low = 1;
+    ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+
+    // Loading commits pending operations and should return nine changes (seqs = 2 to 10)
+    changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, changes, &pool));
+    ASSERT_EQ(changes.size(), 9u);
+    uint32_t i = 1;
+    for (auto it : changes)
+    {
+        ++i;
+        ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+        pool.release_Cache(it);
+    }
+
+    // Remove a range of consecutive changes (seqs = 2 to 9)
+    for (i = 2; i <= 9; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+
+    // Wait for the committer and check from another connection that only seq = 10 remains
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    PropertyPolicy plain_policy;
+    plain_policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    plain_policy.properties().emplace_back("dds.persistence.sqlite3.filename", "test.db");
+    IPersistenceService* other_service = PersistenceFactory::create_persistence_service(plain_policy);
+    ASSERT_NE(other_service, nullptr);
+
+    changes.clear();
+    ASSERT_TRUE(other_service->load_writer_from_storage(persist_guid, guid, changes, &pool));
+    delete other_service;
+    ASSERT_EQ(changes.size(), 1u);
+    ASSERT_EQ((*changes.begin())->sequenceNumber, SequenceNumber_t(0, 10));
+}
+
+/*!
+* @fn TEST_F(PersistenceTest, ReaderBatched)
+* @brief This test checks the reader persistence interface when operations are grouped on transactions.
+*/
+TEST_F(PersistenceTest, ReaderBatched)
+{
+    const std::string persist_guid("TEST_READER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", "test.db");
+    policy.properties().emplace_back("dds.persistence.sqlite3.batch_size", "100");
+    policy.properties().emplace_back("dds.persistence.sqlite3.batch_max_latency_ms", "1000");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    IPersistenceService::map_allocator_t pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map(pool);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(pool);
+    GUID_t guid_1(GuidPrefix_t::unknown(), 1U);
+    GUID_t guid_2(GuidPrefix_t::unknown(), 2U);
+
+    // Several updates for the same writer before they are committed
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, i)));
+        ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_2, SequenceNumber_t(0, 2 * i)));
+    }
+    seq_map[guid_1] = SequenceNumber_t(0, 10);
+    seq_map[guid_2] = SequenceNumber_t(0, 20);
+
+    // Loading should return the last values
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+
+    // Pending updates are stored when the service is destroyed
+    ASSERT_TRUE(service->update_writer_seq_on_storage(persist_guid, guid_1, SequenceNumber_t(0, 100)));
+    seq_map[guid_1] = SequenceNumber_t(0, 100);
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy);
+    ASSERT_NE(service, nullptr);
+
+    seq_map_loaded.clear();
+    ASSERT_TRUE(service->load_reader_from_storage(persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded, seq_map);
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -478,6 +478,46 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+
+//! Tests that asserting liveliness of an alive writer renews its lease, and that the writer is lost once the
+//! assertions stop
+TEST_F(LivelinessManagerTests, LeaseRenewedByAssertions)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.2));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.3));
+
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.3));
+
+    // Keep the first writer alive for longer than both lease durations
+    for (int i = 0; i < 10; ++i)
+    {
+        liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.2));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 2));
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+    EXPECT_EQ(num_writers_recovered, 2u);
+
+    wait_liveliness_lost(2u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 1));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_TOPIC_LIVELINESS_QOS));
+}
 }
 }
 
@@ -133,6 +133,48 @@ TEST(ReaderProxyTests, are_there_gaps)
     ASSERT_FALSE(rproxy.are_there_gaps());
 }
 
+TEST(ReaderProxyTests, round_trip_time)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    ASSERT_EQ(rproxy.round_trip_time().count(), 0);
+    ASSERT_EQ(rproxy.retransmission_timeout().count(), 0);
+
+    // ACKNACK without a previous HEARTBEAT is not a sample.
+    ASSERT_FALSE(rproxy.acknack_received(t0));
+
+    // ACKNACK after a resent HEARTBEAT is ambiguous and is not a sample.
+    rproxy.heartbeat_sent(1, t0);
+    rproxy.heartbeat_sent(2, t0 + std::chrono::microseconds(500));
+    ASSERT_FALSE(rproxy.acknack_received(t0 + std::chrono::microseconds(1000)));
+    ASSERT_EQ(rproxy.round_trip_time().count(), 0);
+
+    // The same HEARTBEAT notified twice is not a resend.
+    rproxy.heartbeat_sent(3, t0 + std::chrono::microseconds(2000));
+    rproxy.heartbeat_sent(3, t0 + std::chrono::microseconds(2000));
+    ASSERT_TRUE(rproxy.acknack_received(t0 + std::chrono::microseconds(3000)));
+    ASSERT_EQ(rproxy.round_trip_time().count(), 1000);
+    ASSERT_EQ(rproxy.retransmission_timeout().count(), 3000);
+
+    // Second ACKNACK for the same HEARTBEAT is ignored.
+    ASSERT_FALSE(rproxy.acknack_received(t0 + std::chrono::microseconds(5000)));
+    ASSERT_EQ(rproxy.round_trip_time().count(), 1000);
+
+    std::chrono::steady_clock::time_point t1 = t0 + std::chrono::microseconds(10000);
+    rproxy.heartbeat_sent(4, t1);
+    ASSERT_TRUE(rproxy.acknack_received(t1 + std::chrono::microseconds(9000)));
+    ASSERT_EQ(rproxy.round_trip_time().count(), 2000);
+    ASSERT_EQ(rproxy.retransmission_timeout().count(), 2000 + 4 * 2375);
+
+    // Stopping the proxy forgets the estimation.
+    rproxy.stop();
+    ASSERT_EQ(rproxy.round_trip_time().count(), 0);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
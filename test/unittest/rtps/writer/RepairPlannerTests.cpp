@@ -0,0 +1,205 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/writer/RepairPlanner.h>
+
+#include <memory>
+
+using namespace eprosima::fastrtps::rtps;
+
+struct FakeReader
+{
+    FakeReader(
+            bool reliable,
+            uint16_t unicast_port,
+            uint16_t multicast_port)
+        : reliable_(reliable)
+        , entry_(1, 1)
+    {
+        Locator_t unicast(unicast_port);
+        entry_.unicast.push_back(unicast);
+        if (multicast_port != 0)
+        {
+            Locator_t multicast(multicast_port);
+            multicast.address[12] = 239;
+            entry_.multicast.push_back(multicast);
+        }
+    }
+
+    bool is_reliable() const
+    {
+        return reliable_;
+    }
+
+    LocatorSelectorEntry* locator_selector_entry()
+    {
+        return &entry_;
+    }
+
+    bool reliable_;
+    LocatorSelectorEntry entry_;
+};
+
+class RepairPlannerTests : public ::testing::Test
+{
+    protected:
+
+        void SetUp() override
+        {
+            for (uint32_t i = 1; i <= 4; ++i)
+            {
+                changes_[i - 1].sequenceNumber = SequenceNumber_t(0, i);
+            }
+        }
+
+        void add(
+                uint32_t seq,
+                FakeReader* reader)
+        {
+            collector_.add_change(&changes_[seq - 1], reader, FragmentNumberSet_t());
+        }
+
+        CacheChange_t changes_[4];
+        RTPSWriterCollector<FakeReader*> collector_;
+};
+
+TEST_F(RepairPlannerTests, groups_items_by_readers)
+{
+    FakeReader a(true, 7410, 0);
+    FakeReader b(true, 7411, 0);
+    std::vector<FakeReader*> matched = { &a, &b };
+
+    add(1, &a);
+    add(1, &b);
+    add(2, &a);
+    add(3, &a);
+    add(3, &b);
+
+    RepairPlanner<FakeReader*> planner;
+    planner.plan(collector_, matched);
+
+    ASSERT_TRUE(collector_.empty());
+    auto& batches = planner.batches();
+    ASSERT_EQ(2u, batches.size());
+    EXPECT_EQ(2u, batches[0].readers.size());
+    ASSERT_EQ(2u, batches[0].items.size());
+    EXPECT_EQ(SequenceNumber_t(0, 1), batches[0].items[0]->sequenceNumber);
+    EXPECT_EQ(SequenceNumber_t(0, 3), batches[0].items[1]->sequenceNumber);
+    ASSERT_EQ(1u, batches[1].items.size());
+    EXPECT_EQ(SequenceNumber_t(0, 2), batches[1].items[0]->sequenceNumber);
+}
+
+TEST_F(RepairPlannerTests, best_effort_keeps_order)
+{
+    FakeReader a(false, 7410, 0);
+    FakeReader b(true, 7411, 0);
+    std::vector<FakeReader*> matched = { &a, &b };
+
+    add(1, &a);
+    add(1, &b);
+    add(2, &a);
+    add(3, &a);
+    add(3, &b);
+
+    RepairPlanner<FakeReader*> planner;
+    planner.plan(collector_, matched);
+
+    auto& batches = planner.batches();
+    ASSERT_EQ(3u, batches.size());
+    EXPECT_EQ(SequenceNumber_t(0, 1), batches[0].items[0]->sequenceNumber);
+    EXPECT_EQ(SequenceNumber_t(0, 2), batches[1].items[0]->sequenceNumber);
+    EXPECT_EQ(SequenceNumber_t(0, 3), batches[2].items[0]->sequenceNumber);
+}
+
+TEST_F(RepairPlannerTests, multicast_coverage)
+{
+    std::vector<std::unique_ptr<FakeReader>> readers;
+    std::vector<FakeReader*> matched;
+    for (uint16_t i = 0; i < 6; ++i)
+    {
+        readers.emplace_back(new FakeReader(true, 7410 + i, 7400));
+        matched.push_back(readers.back().get());
+    }
+
+    // Half of the group requests the change: kept together to be sent by multicast.
+    for (size_t i = 0; i < 3; ++i)
+    {
+        add(1, matched[i]);
+    }
+    // Only two of six request the change: split to be sent by unicast.
+    add(2, matched[4]);
+    add(2, matched[5]);
+
+    RepairPlanner<FakeReader*> planner;
+    planner.plan(collector_, matched);
+
+    auto& batches = planner.batches();
+    ASSERT_EQ(3u, batches.size());
+    EXPECT_EQ(3u, batches[0].readers.size());
+    ASSERT_EQ(1u, batches[1].readers.size());
+    EXPECT_EQ(matched[4], batches[1].readers[0]);
+    ASSERT_EQ(1u, batches[1].items.size());
+    ASSERT_EQ(1u, batches[1].items[0]->remoteReaders.size());
+    EXPECT_EQ(matched[4], batches[1].items[0]->remoteReaders[0]);
+    ASSERT_EQ(1u, batches[2].readers.size());
+    EXPECT_EQ(matched[5], batches[2].readers[0]);
+}
+
+TEST_F(RepairPlannerTests, reuses_storage_between_plans)
+{
+    FakeReader a(true, 7410, 7400);
+    FakeReader b(true, 7411, 7400);
+    FakeReader c(true, 7412, 7400);
+    FakeReader d(true, 7413, 7400);
+    FakeReader e(true, 7414, 7400);
+    std::vector<FakeReader*> matched = { &a, &b, &c, &d, &e };
+    RepairPlanner<FakeReader*> planner;
+
+    // First plan splits a batch, so it needs more items and batches than the second one.
+    add(1, &a);
+    add(2, &b);
+    add(2, &c);
+    planner.plan(collector_, matched);
+    ASSERT_EQ(3u, planner.batches().size());
+
+    add(3, &d);
+    add(4, &d);
+    add(1, &d);
+    planner.plan(collector_, matched);
+
+    ASSERT_TRUE(collector_.empty());
+    auto& batches = planner.batches();
+    ASSERT_EQ(1u, batches.size());
+    ASSERT_EQ(1u, batches[0].readers.size());
+    EXPECT_EQ(&d, batches[0].readers[0]);
+    ASSERT_EQ(3u, batches[0].items.size());
+    EXPECT_EQ(SequenceNumber_t(0, 1), batches[0].items[0]->sequenceNumber);
+    EXPECT_EQ(SequenceNumber_t(0, 3), batches[0].items[1]->sequenceNumber);
+    EXPECT_EQ(SequenceNumber_t(0, 4), batches[0].items[2]->sequenceNumber);
+    for (const RepairPlanner<FakeReader*>::Item* item : batches[0].items)
+    {
+        ASSERT_EQ(1u, item->remoteReaders.size());
+        EXPECT_EQ(&d, item->remoteReaders[0]);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,162 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastrtps/rtps/writer/TimeBasedFilter.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+class TimeBasedFilterTests : public ::testing::Test
+{
+    protected:
+
+        CacheChange_t& change(
+                uint32_t seq,
+                int32_t milliseconds,
+                uint8_t instance = 0)
+        {
+            CacheChange_t& ch = changes_[seq];
+            ch.sequenceNumber = SequenceNumber_t(0, seq);
+            ch.sourceTimestamp.seconds(milliseconds / 1000);
+            ch.sourceTimestamp.nanosec(static_cast<uint32_t>(milliseconds % 1000) * 1000000u);
+            ch.instanceHandle.value[0] = instance;
+            return ch;
+        }
+
+        CacheChange_t changes_[16];
+        TimeBasedFilter filter_;
+};
+
+TEST_F(TimeBasedFilterTests, disabled_by_default)
+{
+    EXPECT_FALSE(filter_.enabled());
+    EXPECT_TRUE(filter_.pass(change(1, 0)));
+    EXPECT_TRUE(filter_.pass(change(2, 1)));
+}
+
+TEST_F(TimeBasedFilterTests, minimum_separation)
+{
+    EXPECT_TRUE(filter_.minimum_separation(Duration_t(0, 100000000u)));
+    EXPECT_FALSE(filter_.minimum_separation(Duration_t(0, 100000000u)));
+    ASSERT_TRUE(filter_.enabled());
+
+    EXPECT_TRUE(filter_.pass(change(1, 0)));
+    EXPECT_FALSE(filter_.pass(change(2, 50)));
+    EXPECT_FALSE(filter_.pass(change(3, 99)));
+    EXPECT_TRUE(filter_.pass(change(4, 100)));
+    EXPECT_FALSE(filter_.pass(change(5, 150)));
+    EXPECT_TRUE(filter_.pass(change(6, 250)));
+}
+
+TEST_F(TimeBasedFilterTests, checking_again_gives_same_result)
+{
+    filter_.minimum_separation(Duration_t(0, 100000000u));
+
+    EXPECT_TRUE(filter_.pass(change(1, 0)));
+    EXPECT_TRUE(filter_.pass(change(1, 0)));
+    EXPECT_FALSE(filter_.pass(change(2, 50)));
+    EXPECT_FALSE(filter_.pass(change(2, 50)));
+    EXPECT_TRUE(filter_.pass(change(3, 120)));
+    EXPECT_TRUE(filter_.pass(change(3, 120)));
+}
+
+TEST_F(TimeBasedFilterTests, per_instance)
+{
+    filter_.minimum_separation(Duration_t(0, 100000000u));
+
+    EXPECT_TRUE(filter_.pass(change(1, 0, 1)));
+    EXPECT_TRUE(filter_.pass(change(2, 10, 2)));
+    EXPECT_FALSE(filter_.pass(change(3, 20, 1)));
+    EXPECT_FALSE(filter_.pass(change(4, 30, 2)));
+    EXPECT_TRUE(filter_.pass(change(5, 105, 1)));
+}
+
+TEST_F(TimeBasedFilterTests, not_alive_changes_pass)
+{
+    filter_.minimum_separation(Duration_t(0, 100000000u));
+
+    EXPECT_TRUE(filter_.pass(change(1, 0)));
+    CacheChange_t& dispose = change(2, 10);
+    dispose.kind = NOT_ALIVE_DISPOSED;
+    EXPECT_TRUE(filter_.pass(dispose));
+}
+
+TEST_F(TimeBasedFilterTests, dispose_forgets_instance)
+{
+    filter_.minimum_separation(Duration_t(0, 100000000u));
+
+    EXPECT_TRUE(filter_.pass(change(1, 0, 1)));
+    EXPECT_TRUE(filter_.pass(change(2, 0, 2)));
+    EXPECT_EQ(filter_.instance_count(), 2u);
+
+    CacheChange_t& dispose = change(3, 10, 1);
+    dispose.kind = NOT_ALIVE_DISPOSED;
+    EXPECT_TRUE(filter_.pass(dispose));
+    EXPECT_EQ(filter_.instance_count(), 1u);
+
+    CacheChange_t& unregister = change(4, 10, 2);
+    unregister.kind = NOT_ALIVE_UNREGISTERED;
+    EXPECT_TRUE(filter_.pass(unregister));
+    EXPECT_EQ(filter_.instance_count(), 0u);
+
+    // A new change of a forgotten instance starts again
+    EXPECT_TRUE(filter_.pass(change(5, 20, 1)));
+    EXPECT_FALSE(filter_.pass(change(6, 30, 1)));
+}
+
+TEST_F(TimeBasedFilterTests, max_instances)
+{
+    filter_.minimum_separation(Duration_t(0, 100000000u));
+    filter_.max_instances(2);
+
+    EXPECT_TRUE(filter_.pass(change(1, 0, 1)));
+    EXPECT_TRUE(filter_.pass(change(2, 10, 2)));
+
+    // The instance that passed the filter the longest time ago is forgotten
+    EXPECT_TRUE(filter_.pass(change(3, 20, 3)));
+    EXPECT_EQ(filter_.instance_count(), 2u);
+    EXPECT_TRUE(filter_.pass(change(4, 30, 1)));
+    EXPECT_EQ(filter_.instance_count(), 2u);
+    EXPECT_FALSE(filter_.pass(change(5, 40, 3)));
+
+    // Instances that would not filter out new changes are forgotten first
+    EXPECT_TRUE(filter_.pass(change(6, 125, 4)));
+    EXPECT_EQ(filter_.instance_count(), 2u);
+    EXPECT_FALSE(filter_.pass(change(7, 126, 1)));
+    EXPECT_FALSE(filter_.pass(change(8, 127, 4)));
+}
+
+TEST_F(TimeBasedFilterTests, last_change_of_burst_is_not_sent)
+{
+    filter_.minimum_separation(Duration_t(0, 100000000u));
+
+    // Known limitation: the last change of the burst is filtered out and never sent afterwards.
+    EXPECT_TRUE(filter_.pass(change(1, 0)));
+    EXPECT_FALSE(filter_.pass(change(2, 10)));
+    EXPECT_FALSE(filter_.pass(change(3, 20)));
+    EXPECT_FALSE(filter_.pass(change(3, 20)));
+
+    // It is only superseded by a newer change passing the filter.
+    EXPECT_TRUE(filter_.pass(change(4, 500)));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../../../src/cpp/security/accesscontrol/ExpressionIndex.h"
+
+#include <fastrtps/utils/StringMatching.h>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+
+TEST(ExpressionIndexTests, empty_index)
+{
+    ExpressionIndex index;
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(ExpressionIndex::not_found, index.first_match("Square"));
+    ASSERT_EQ(ExpressionIndex::not_found, index.first_match(""));
+}
+
+TEST(ExpressionIndexTests, first_match_keeps_order)
+{
+    ExpressionIndex index;
+    index.add("Circle", 0);
+    index.add("Sq*", 1);
+    index.add("Square", 2);
+    index.add("*", 3);
+
+    ASSERT_EQ(0u, index.first_match("Circle"));
+    ASSERT_EQ(1u, index.first_match("Square"));
+    ASSERT_EQ(1u, index.first_match("Sq"));
+    ASSERT_EQ(3u, index.first_match("Triangle"));
+    ASSERT_EQ(3u, index.first_match(""));
+}
+
+TEST(ExpressionIndexTests, accept_filter)
+{
+    ExpressionIndex index;
+    index.add("Square", 0);
+    index.add("Sq*", 1);
+    index.add("Square", 2);
+
+    auto skip_first_two = [](size_t position)
+            {
+                return position >= 2;
+            };
+    auto skip_all = [](size_t)
+            {
+                return false;
+            };
+
+    ASSERT_EQ(2u, index.first_match("Square", skip_first_two));
+    ASSERT_EQ(ExpressionIndex::not_found, index.first_match("Square", skip_all));
+    ASSERT_EQ(ExpressionIndex::not_found, index.first_match("Sqr", skip_first_two));
+}
+
+TEST(ExpressionIndexTests, same_result_as_string_matching)
+{
+    const char* expressions[] = { "foo/bar/baz", "foo*", "*baz", "foo/*/baz", "foo/bar/ba?", "*ba?*", "[fg]oo",
+        "foo\\bar\\baz", "*bar", "qux" };
+    const char* names[] = { "foo/bar/baz", "foo", "goo", "xbaz", "qux", "quux", "", "foo/bar/bax", "f*", "*" };
+
+    ExpressionIndex index;
+    size_t num_expressions = sizeof(expressions) / sizeof(expressions[0]);
+    for (size_t i = 0; i < num_expressions; ++i)
+    {
+        index.add(expressions[i], i);
+    }
+
+    for (const char* name : names)
+    {
+        size_t expected = ExpressionIndex::not_found;
+        for (size_t i = 0; i < num_expressions; ++i)
+        {
+            if (StringMatching::matchString(expressions[i], name))
+            {
+                expected = i;
+                break;
+            }
+        }
+
+        EXPECT_EQ(expected, index.first_match(name)) << "Name: " << name;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
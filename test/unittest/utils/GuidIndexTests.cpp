@@ -0,0 +1,143 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/collections/GuidIndex.hpp>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+constexpr size_t NUM_ITEMS = 1000;
+
+class GuidIndexTests: public ::testing::Test
+{
+    public:
+
+        GuidIndexTests()
+        {
+            // Writers of a few participants, which only differ on the prefix host bytes and the entity key
+            for (size_t i = 0; i < NUM_ITEMS; ++i)
+            {
+                GUID_t guid;
+                guid.guidPrefix.value[0] = 0x01;
+                guid.guidPrefix.value[1] = 0x0F;
+                guid.guidPrefix.value[4] = static_cast<octet>(i % 10);
+                guid.entityId.value[1] = static_cast<octet>(i >> 8);
+                guid.entityId.value[2] = static_cast<octet>(i & 0xFF);
+                guid.entityId.value[3] = 0x02;
+                testbed.push_back(guid);
+            }
+        }
+
+        std::vector<GUID_t> testbed;
+};
+
+TEST_F(GuidIndexTests, insert_find_erase)
+{
+    GuidIndex<size_t> uut;
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.find(testbed[0]), nullptr);
+    ASSERT_FALSE(uut.erase(testbed[0]));
+
+    for (size_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_TRUE(uut.insert(testbed[i], i));
+    }
+    ASSERT_EQ(uut.size(), NUM_ITEMS);
+
+    // Keys are unique
+    ASSERT_FALSE(uut.insert(testbed[0], 0));
+    ASSERT_EQ(uut.size(), NUM_ITEMS);
+
+    for (size_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        size_t* value = uut.find(testbed[i]);
+        ASSERT_NE(value, nullptr);
+        ASSERT_EQ(*value, i);
+    }
+
+    // Remove the even ones
+    for (size_t i = 0; i < NUM_ITEMS; i += 2)
+    {
+        ASSERT_TRUE(uut.erase(testbed[i]));
+    }
+    ASSERT_EQ(uut.size(), NUM_ITEMS / 2);
+
+    for (size_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        size_t* value = uut.find(testbed[i]);
+        if (i % 2 == 0)
+        {
+            ASSERT_EQ(value, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(value, nullptr);
+            ASSERT_EQ(*value, i);
+        }
+    }
+
+    uut.clear();
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.find(testbed[1]), nullptr);
+}
+
+TEST_F(GuidIndexTests, random_operations)
+{
+    GuidIndex<size_t> uut(ResourceLimitedContainerConfig(16));
+    std::map<GUID_t, size_t> expected;
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<size_t> distribution(0, 99);
+
+    for (size_t n = 0; n < 20000; ++n)
+    {
+        size_t i = distribution(generator);
+        if (expected.count(testbed[i]) == 0)
+        {
+            ASSERT_TRUE(uut.insert(testbed[i], n));
+            expected[testbed[i]] = n;
+        }
+        else
+        {
+            ASSERT_TRUE(uut.erase(testbed[i]));
+            expected.erase(testbed[i]);
+        }
+
+        ASSERT_EQ(uut.size(), expected.size());
+    }
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        auto it = expected.find(testbed[i]);
+        size_t* value = uut.find(testbed[i]);
+        if (it == expected.end())
+        {
+            ASSERT_EQ(value, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(value, nullptr);
+            ASSERT_EQ(*value, it->second);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,99 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/IPFinder.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+TEST(IPFinderTests, locators_match_names)
+{
+    std::vector<IPFinder::info_IP> interfaces;
+    ASSERT_TRUE(IPFinder::getIPs(&interfaces, true));
+
+    for (const IPFinder::info_IP& info : interfaces)
+    {
+        if (info.type == IPFinder::IP4 || info.type == IPFinder::IP4_LOCAL)
+        {
+            Locator_t locator;
+            IPLocator::setIPv4(locator, info.name);
+            EXPECT_TRUE(IPLocator::compareAddress(locator, info.locator));
+            EXPECT_EQ(info.locator.kind, LOCATOR_KIND_UDPv4);
+        }
+        else
+        {
+            EXPECT_EQ(info.locator.kind, LOCATOR_KIND_UDPv6);
+        }
+    }
+}
+
+TEST(IPFinderTests, loopback_filter)
+{
+    std::vector<IPFinder::info_IP> all;
+    std::vector<IPFinder::info_IP> no_loopback;
+    ASSERT_TRUE(IPFinder::getIPs(&all, true));
+    ASSERT_TRUE(IPFinder::getIPs(&no_loopback, false));
+
+    size_t loopback = 0;
+    for (const IPFinder::info_IP& info : all)
+    {
+        if (info.type == IPFinder::IP4_LOCAL || info.type == IPFinder::IP6_LOCAL)
+        {
+            ++loopback;
+        }
+    }
+
+    EXPECT_EQ(all.size(), no_loopback.size() + loopback);
+    for (const IPFinder::info_IP& info : no_loopback)
+    {
+        EXPECT_NE(info.type, IPFinder::IP4_LOCAL);
+        EXPECT_NE(info.type, IPFinder::IP6_LOCAL);
+    }
+}
+
+TEST(IPFinderTests, results_are_appended)
+{
+    std::vector<IPFinder::info_IP> first;
+    ASSERT_TRUE(IPFinder::getIPs(&first, true));
+    size_t size = first.size();
+
+    ASSERT_TRUE(IPFinder::getIPs(&first, true));
+    EXPECT_EQ(first.size(), 2 * size);
+}
+
+TEST(IPFinderTests, repeated_queries_are_consistent)
+{
+    std::vector<IPFinder::info_IP> first;
+    std::vector<IPFinder::info_IP> second;
+    ASSERT_TRUE(IPFinder::getIPs(&first, true));
+    ASSERT_TRUE(IPFinder::getIPs(&second, true));
+
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        EXPECT_EQ(first[i].type, second[i].type);
+        EXPECT_EQ(first[i].name, second[i].name);
+        EXPECT_EQ(first[i].dev, second[i].dev);
+        EXPECT_EQ(first[i].locator, second[i].locator);
+    }
+
+    EXPECT_GT(IPFinder::getIPsVersion(), 0u);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
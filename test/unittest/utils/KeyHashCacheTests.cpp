@@ -0,0 +1,216 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <utils/KeyHashCache.h>
+#include <fastrtps/TopicDataType.h>
+
+#include <cstring>
+#include <string>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * Type whose samples are std::string, which are also their key.
+ */
+class StringKeyType : public TopicDataType
+{
+    public:
+
+        StringKeyType(
+                bool supports_serialize_key,
+                uint32_t max_key_size)
+            : supports_serialize_key_(supports_serialize_key)
+            , max_key_size_(max_key_size)
+        {
+            m_isGetKeyDefined = true;
+        }
+
+        bool serialize(
+                void*,
+                SerializedPayload_t*) override
+        {
+            return false;
+        }
+
+        bool deserialize(
+                SerializedPayload_t*,
+                void*) override
+        {
+            return false;
+        }
+
+        std::function<uint32_t()> getSerializedSizeProvider(
+                void*) override
+        {
+            return []()
+                   {
+                       return 0u;
+                   };
+        }
+
+        void* createData() override
+        {
+            return new std::string();
+        }
+
+        void deleteData(
+                void* data) override
+        {
+            delete static_cast<std::string*>(data);
+        }
+
+        bool getKey(
+                void* data,
+                InstanceHandle_t* handle,
+                bool force_md5) override
+        {
+            ++get_key_calls;
+
+            SerializedPayload_t key;
+            bool requires_md5 = false;
+            write_key(data, &key, &requires_md5);
+
+            memset(handle->value, 0, 16);
+            if (force_md5 || requires_md5)
+            {
+                MD5 md5;
+                md5.update(key.data, key.length);
+                md5.finalize();
+                memcpy(handle->value, md5.digest, 16);
+            }
+            else
+            {
+                memcpy(handle->value, key.data, key.length);
+            }
+            return true;
+        }
+
+        bool serializeKey(
+                void* data,
+                SerializedPayload_t* key,
+                bool* requires_md5) override
+        {
+            if (!supports_serialize_key_)
+            {
+                return false;
+            }
+
+            ++serialize_key_calls;
+            write_key(data, key, requires_md5);
+            return true;
+        }
+
+        int get_key_calls = 0;
+
+        int serialize_key_calls = 0;
+
+    private:
+
+        void write_key(
+                void* data,
+                SerializedPayload_t* key,
+                bool* requires_md5)
+        {
+            const std::string& str = *static_cast<std::string*>(data);
+            key->reserve(max_key_size_);
+            key->length = static_cast<uint32_t>(str.size());
+            memcpy(key->data, str.data(), str.size());
+            *requires_md5 = max_key_size_ > 16;
+        }
+
+        bool supports_serialize_key_;
+
+        uint32_t max_key_size_;
+};
+
+TEST(KeyHashCacheTests, same_handles_as_get_key)
+{
+    StringKeyType type(true, 64);
+    KeyHashCache cache(&type, 4);
+
+    for (std::string sample : {"first", "a key longer than sixteen bytes", "first", "third", "fourth", "fifth"})
+    {
+        for (bool force_md5 : {false, true})
+        {
+            InstanceHandle_t expected;
+            InstanceHandle_t handle;
+            ASSERT_TRUE(type.getKey(&sample, &expected, force_md5));
+            ASSERT_TRUE(cache.get_key(&sample, handle, force_md5));
+            EXPECT_EQ(expected, handle);
+        }
+    }
+
+    // Keys fitting on the handle are not hashed
+    StringKeyType short_type(true, 16);
+    KeyHashCache short_cache(&short_type);
+    std::string sample("short");
+    InstanceHandle_t expected;
+    InstanceHandle_t handle;
+    ASSERT_TRUE(short_type.getKey(&sample, &expected, false));
+    ASSERT_TRUE(short_cache.get_key(&sample, handle, false));
+    EXPECT_EQ(expected, handle);
+    EXPECT_EQ(0, memcmp(handle.value, "short", 5));
+}
+
+TEST(KeyHashCacheTests, repeated_keys_are_cached)
+{
+    StringKeyType type(true, 64);
+    KeyHashCache cache(&type);
+
+    std::string first("a key longer than sixteen bytes");
+    std::string second("another key longer than sixteen bytes");
+    InstanceHandle_t first_handle;
+    InstanceHandle_t second_handle;
+    InstanceHandle_t handle;
+
+    ASSERT_TRUE(cache.get_key(&first, first_handle, false));
+    ASSERT_TRUE(cache.get_key(&second, second_handle, false));
+    EXPECT_FALSE(first_handle == second_handle);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(cache.get_key(&first, handle, false));
+        EXPECT_EQ(first_handle, handle);
+        ASSERT_TRUE(cache.get_key(&second, handle, false));
+        EXPECT_EQ(second_handle, handle);
+    }
+
+    // The hash is never computed through the type
+    EXPECT_EQ(0, type.get_key_calls);
+    EXPECT_EQ(22, type.serialize_key_calls);
+}
+
+TEST(KeyHashCacheTests, falls_back_on_get_key)
+{
+    StringKeyType type(false, 64);
+    KeyHashCache cache(&type);
+
+    std::string sample("a key longer than sixteen bytes");
+    InstanceHandle_t handle;
+    ASSERT_TRUE(cache.get_key(&sample, handle, false));
+    ASSERT_TRUE(cache.get_key(&sample, handle, false));
+
+    EXPECT_EQ(2, type.get_key_calls);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,194 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <utils/ListenerExecutor.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+class Latch
+{
+    public:
+
+        void open()
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            open_ = true;
+            cv_.notify_all();
+        }
+
+        bool wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return cv_.wait_for(lock, std::chrono::seconds(5), [this]()
+                    {
+                        return open_;
+                    });
+        }
+
+    private:
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool open_ = false;
+};
+
+TEST(ListenerExecutorTests, strand_keeps_order)
+{
+    ListenerExecutor executor(4);
+    ListenerExecutor::Strand* strand = executor.create_strand();
+
+    std::vector<int> calls;
+    std::atomic<int> concurrent(0);
+    std::atomic<bool> overlapped(false);
+    Latch done;
+
+    const int num_tasks = 1000;
+    for (int i = 0; i < num_tasks; ++i)
+    {
+        executor.post(strand, [&, i]()
+                {
+                    if (++concurrent > 1)
+                    {
+                        overlapped = true;
+                    }
+                    calls.push_back(i);
+                    --concurrent;
+
+                    if (i == num_tasks - 1)
+                    {
+                        done.open();
+                    }
+                });
+    }
+
+    ASSERT_TRUE(done.wait());
+    executor.destroy_strand(strand);
+
+    EXPECT_FALSE(overlapped);
+    ASSERT_EQ(calls.size(), static_cast<size_t>(num_tasks));
+    for (int i = 0; i < num_tasks; ++i)
+    {
+        EXPECT_EQ(calls[i], i);
+    }
+}
+
+TEST(ListenerExecutorTests, strands_run_concurrently)
+{
+    ListenerExecutor executor(2);
+    ListenerExecutor::Strand* slow = executor.create_strand();
+    ListenerExecutor::Strand* fast = executor.create_strand();
+
+    Latch fast_called;
+    Latch slow_finished;
+
+    // The task of the slow strand does not finish until the task of the other one has run
+    executor.post(slow, [&]()
+            {
+                if (fast_called.wait())
+                {
+                    slow_finished.open();
+                }
+            });
+    executor.post(fast, [&]()
+            {
+                fast_called.open();
+            });
+
+    EXPECT_TRUE(slow_finished.wait());
+
+    executor.destroy_strand(slow);
+    executor.destroy_strand(fast);
+}
+
+TEST(ListenerExecutorTests, destroy_discards_pending_tasks)
+{
+    ListenerExecutor executor(1);
+    ListenerExecutor::Strand* strand = executor.create_strand();
+
+    Latch running;
+    Latch release;
+    std::atomic<int> calls(0);
+
+    executor.post(strand, [&]()
+            {
+                running.open();
+                release.wait();
+                ++calls;
+            });
+    executor.post(strand, [&]()
+            {
+                ++calls;
+            });
+
+    ASSERT_TRUE(running.wait());
+    std::thread releaser([&]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                release.open();
+            });
+
+    // Waits for the running task
+    executor.destroy_strand(strand);
+    EXPECT_EQ(calls, 1);
+
+    releaser.join();
+}
+
+TEST(ListenerExecutorTests, destroy_from_own_task)
+{
+    ListenerExecutor executor(1);
+    ListenerExecutor::Strand* strand = executor.create_strand();
+    ListenerExecutor::Strand* other = executor.create_strand();
+
+    std::atomic<int> calls(0);
+    Latch posted;
+    Latch done;
+
+    executor.post(strand, [&]()
+            {
+                posted.wait();
+                executor.destroy_strand(strand);
+            });
+    executor.post(strand, [&]()
+            {
+                ++calls;
+            });
+    executor.post(other, [&]()
+            {
+                done.open();
+            });
+    posted.open();
+
+    ASSERT_TRUE(done.wait());
+    EXPECT_EQ(calls, 0);
+
+    executor.destroy_strand(other);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
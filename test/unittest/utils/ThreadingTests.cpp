@@ -0,0 +1,102 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <utils/Threading.h>
+
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace eprosima::fastrtps;
+
+#if defined(__linux__)
+
+TEST(ThreadingTests, name_is_truncated)
+{
+    std::string name;
+    std::thread thread([&name]()
+            {
+                set_current_thread_settings("dds.test.thread.name", rtps::ThreadSettings());
+
+                char buffer[16] = {};
+                pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+                name = buffer;
+            });
+    thread.join();
+
+    EXPECT_EQ(name, "dds.test.thread");
+}
+
+TEST(ThreadingTests, default_settings_keep_scheduling)
+{
+    int policy_before = 0;
+    int policy_after = 0;
+    sched_param param_before;
+    sched_param param_after;
+
+    std::thread thread([&]()
+            {
+                pthread_getschedparam(pthread_self(), &policy_before, &param_before);
+                set_current_thread_settings("dds.test", rtps::ThreadSettings());
+                pthread_getschedparam(pthread_self(), &policy_after, &param_after);
+            });
+    thread.join();
+
+    EXPECT_EQ(policy_before, policy_after);
+    EXPECT_EQ(param_before.sched_priority, param_after.sched_priority);
+}
+
+TEST(ThreadingTests, affinity)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+
+    uint32_t cpu = 0;
+    while (cpu < 64 && !CPU_ISSET(cpu, &allowed))
+    {
+        ++cpu;
+    }
+    ASSERT_LT(cpu, 64u);
+
+    rtps::ThreadSettings settings;
+    settings.affinity = uint64_t(1) << cpu;
+
+    cpu_set_t applied;
+    CPU_ZERO(&applied);
+    std::thread thread([&]()
+            {
+                set_current_thread_settings("dds.test", settings);
+                pthread_getaffinity_np(pthread_self(), sizeof(applied), &applied);
+            });
+    thread.join();
+
+    EXPECT_EQ(CPU_COUNT(&applied), 1);
+    EXPECT_TRUE(CPU_ISSET(cpu, &applied));
+}
+
+#endif
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}